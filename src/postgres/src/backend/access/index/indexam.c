@@ -731,6 +731,13 @@ index_getnext(IndexScanDesc scan, ScanDirection direction)
 	HeapTuple	heapTuple;
 	ItemPointer tid;
 
+	/*
+	 * For YugaByte secondary indexes, the rows of the base table are looked up in batches
+	 * of index entries.
+	 */
+	if (IsYugaByteEnabled() && ybc_index_can_batch(scan, direction))
+		return ybc_index_getnext_batched(scan, direction);
+
 	for (;;)
 	{
 		if (scan->xs_continue_hot)
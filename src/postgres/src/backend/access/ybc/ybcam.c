@@ -42,6 +42,7 @@
 #include "utils/datum.h"
 #include "utils/rel.h"
 #include "utils/lsyscache.h"
+#include "utils/memutils.h"
 #include "utils/resowner_private.h"
 #include "utils/syscache.h"
 #include "utils/selfuncs.h"
@@ -924,6 +925,8 @@ static void ybcEndScan(YbScanDesc ybScan)
 		HandleYBStatus(YBCPgDeleteStatement(ybScan->handle));
 		ResourceOwnerForgetYugaByteStmt(ybScan->stmt_owner, ybScan->handle);
 	}
+	if (ybScan->batch_context)
+		MemoryContextDelete(ybScan->batch_context);
 	pfree(ybScan);
 }
 
@@ -1270,6 +1273,100 @@ void ybc_index_endscan(IndexScanDesc scan_desc)
 	ybcEndScan(ybscan);
 }
 
+bool ybc_index_can_batch(IndexScanDesc scan_desc, ScanDirection direction)
+{
+	return YBCGetMaxBatchYbctids() > 1 &&
+		   ScanDirectionIsForward(direction) &&
+		   !scan_desc->xs_want_itup &&
+		   !scan_desc->indexRelation->rd_index->indisprimary &&
+		   scan_desc->heapRelation != NULL &&
+		   IsYBRelation(scan_desc->heapRelation) &&
+		   !IsSystemRelation(scan_desc->heapRelation);
+}
+
+/*
+ * Read the next batch of index entries and look up their rows of the base table.
+ * Returns false when the index scan has no more entries.
+ */
+static bool ybcFetchIndexBatch(IndexScanDesc scan_desc, YbScanDesc ybscan, ScanDirection direction)
+{
+	int                  max_size    = YBCGetMaxBatchYbctids();
+	YBCPgExecParameters *exec_params = scan_desc->yb_exec_params;
+
+	/* Do not read ahead of the rows needed for a pushed down LIMIT. */
+	if (exec_params && !exec_params->limit_use_default && exec_params->limit_count > 0 &&
+		exec_params->limit_count + exec_params->limit_offset < (uint64_t) max_size)
+	{
+		max_size = (int) (exec_params->limit_count + exec_params->limit_offset);
+	}
+
+	if (ybscan->batch_context)
+		MemoryContextReset(ybscan->batch_context);
+	else
+		ybscan->batch_context = AllocSetContextCreate(GetMemoryChunkContext(ybscan),
+													  "YB index scan batch",
+													  ALLOCSET_DEFAULT_SIZES);
+	ybscan->batch_size = 0;
+	ybscan->batch_pos  = 0;
+
+	Datum *ybctids          = (Datum *) MemoryContextAlloc(ybscan->batch_context,
+														   max_size * sizeof(Datum));
+	ybscan->batch_rechecks  = (bool *) MemoryContextAlloc(ybscan->batch_context,
+														  max_size * sizeof(bool));
+	ybscan->batch_tuples    = (HeapTuple *) MemoryContextAlloc(ybscan->batch_context,
+															   max_size * sizeof(HeapTuple));
+
+	/* The entries of an index scan point to distinct rows. */
+	int n_ybctids = 0;
+	while (n_ybctids < max_size && index_getnext_tid(scan_desc, direction) != NULL)
+	{
+		MemoryContext oldcontext = MemoryContextSwitchTo(ybscan->batch_context);
+		ybctids[n_ybctids] = datumCopy(scan_desc->xs_ctup.t_ybctid, false, -1);
+		MemoryContextSwitchTo(oldcontext);
+
+		ybscan->batch_rechecks[n_ybctids] = scan_desc->xs_recheck;
+		n_ybctids++;
+	}
+	if (n_ybctids == 0)
+		return false;
+
+	MemoryContext oldcontext = MemoryContextSwitchTo(ybscan->batch_context);
+	YBCFetchTuples(scan_desc->heapRelation, ybctids, n_ybctids, ybscan->batch_tuples);
+	MemoryContextSwitchTo(oldcontext);
+
+	ybscan->batch_size = n_ybctids;
+	return true;
+}
+
+HeapTuple ybc_index_getnext_batched(IndexScanDesc scan_desc, ScanDirection direction)
+{
+	YbScanDesc ybscan = (YbScanDesc) scan_desc->opaque;
+	Assert(PointerIsValid(ybscan));
+
+	/*
+	 * The returned rows stay valid until the next batch is read, i.e. at least until the next
+	 * call, like the rows of a buffer page in a heap index scan.
+	 */
+	do
+	{
+		while (ybscan->batch_pos < ybscan->batch_size)
+		{
+			int       pos   = ybscan->batch_pos++;
+			HeapTuple tuple = ybscan->batch_tuples[pos];
+
+			/* Skip the entries whose rows do not exist. */
+			if (tuple)
+			{
+				scan_desc->xs_recheck = ybscan->batch_rechecks[pos];
+				scan_desc->xs_ctup.t_ybctid = tuple->t_ybctid;
+				return tuple;
+			}
+		}
+	} while (ybcFetchIndexBatch(scan_desc, ybscan, direction));
+
+	return NULL;
+}
+
 /* --------------------------------------------------------------------------------------------- */
 
 void ybcCostEstimate(RelOptInfo *baserel, Selectivity selectivity,
@@ -1356,28 +1453,14 @@ void ybcIndexCostEstimate(IndexPath *path, Selectivity *selectivity,
 	RelationClose(index);
 }
 
-HeapTuple YBCFetchTuple(Relation relation, Datum ybctid)
+/*
+ * Set up the targets of a fetch by ybctid. For index-based scan we need to return all "real"
+ * columns.
+ */
+static void ybcAppendFetchTargets(YBCPgStatement ybc_stmt, Relation relation)
 {
-	YBCPgStatement ybc_stmt;
-	TupleDesc      tupdesc = RelationGetDescr(relation);
-
-	HandleYBStatus(YBCPgNewSelect(YBCGetDatabaseOid(relation),
-								  RelationGetRelid(relation),
-								  InvalidOid,
-								  &ybc_stmt));
-
-	/* Bind ybctid to identify the current row. */
-	YBCPgExpr ybctid_expr = YBCNewConstant(ybc_stmt,
-										   BYTEAOID,
-										   ybctid,
-										   false);
-	HandleYBStmtStatus(YBCPgDmlBindColumn(ybc_stmt,
-										  YBTupleIdAttributeNumber,
-										  ybctid_expr), ybc_stmt);
+	TupleDesc tupdesc = RelationGetDescr(relation);
 
-	/*
-	 * Set up the scan targets. For index-based scan we need to return all "real" columns.
-	 */
 	if (RelationGetForm(relation)->relhasoids)
 	{
 		YBCPgTypeAttrs type_attrs = { 0 };
@@ -1396,6 +1479,45 @@ HeapTuple YBCFetchTuple(Relation relation, Datum ybctid)
 	YBCPgExpr   expr = YBCNewColumnRef(ybc_stmt, YBTupleIdAttributeNumber, InvalidOid,
 									   &type_attrs);
 	HandleYBStmtStatus(YBCPgDmlAppendTarget(ybc_stmt, expr), ybc_stmt);
+}
+
+static HeapTuple ybcFormFetchedTuple(Relation relation, Datum *values, bool *nulls,
+									 YBCPgSysColumns *syscols)
+{
+	HeapTuple tuple = heap_form_tuple(RelationGetDescr(relation), values, nulls);
+
+	if (syscols->oid != InvalidOid)
+	{
+		HeapTupleSetOid(tuple, syscols->oid);
+	}
+	if (syscols->ybctid != NULL)
+	{
+		tuple->t_ybctid = PointerGetDatum(syscols->ybctid);
+	}
+	tuple->t_tableOid = RelationGetRelid(relation);
+	return tuple;
+}
+
+HeapTuple YBCFetchTuple(Relation relation, Datum ybctid)
+{
+	YBCPgStatement ybc_stmt;
+	TupleDesc      tupdesc = RelationGetDescr(relation);
+
+	HandleYBStatus(YBCPgNewSelect(YBCGetDatabaseOid(relation),
+								  RelationGetRelid(relation),
+								  InvalidOid,
+								  &ybc_stmt));
+
+	/* Bind ybctid to identify the current row. */
+	YBCPgExpr ybctid_expr = YBCNewConstant(ybc_stmt,
+										   BYTEAOID,
+										   ybctid,
+										   false);
+	HandleYBStmtStatus(YBCPgDmlBindColumn(ybc_stmt,
+										  YBTupleIdAttributeNumber,
+										  ybctid_expr), ybc_stmt);
+
+	ybcAppendFetchTargets(ybc_stmt, relation);
 
 	/* Execute the select statement.
 	 * This select statement fetch the row for a specific YBCTID, LIMIT setting is not needed.
@@ -1420,17 +1542,7 @@ HeapTuple YBCFetchTuple(Relation relation, Datum ybctid)
 
 	if (has_data)
 	{
-		tuple = heap_form_tuple(tupdesc, values, nulls);
-
-		if (syscols.oid != InvalidOid)
-		{
-			HeapTupleSetOid(tuple, syscols.oid);
-		}
-		if (syscols.ybctid != NULL)
-		{
-			tuple->t_ybctid = PointerGetDatum(syscols.ybctid);
-		}
-		tuple->t_tableOid = RelationGetRelid(relation);
+		tuple = ybcFormFetchedTuple(relation, values, nulls, &syscols);
 	}
 	pfree(values);
 	pfree(nulls);
@@ -1440,3 +1552,70 @@ HeapTuple YBCFetchTuple(Relation relation, Datum ybctid)
 
 	return tuple;
 }
+
+static bool ybcYbctidEquals(Datum ybctid1, Datum ybctid2)
+{
+	return VARSIZE_ANY_EXHDR(ybctid1) == VARSIZE_ANY_EXHDR(ybctid2) &&
+		   memcmp(VARDATA_ANY(ybctid1), VARDATA_ANY(ybctid2), VARSIZE_ANY_EXHDR(ybctid1)) == 0;
+}
+
+void YBCFetchTuples(Relation relation, Datum *ybctids, int n_ybctids, HeapTuple *tuples)
+{
+	YBCPgStatement ybc_stmt;
+	TupleDesc      tupdesc = RelationGetDescr(relation);
+
+	HandleYBStatus(YBCPgNewSelect(YBCGetDatabaseOid(relation),
+								  RelationGetRelid(relation),
+								  InvalidOid,
+								  &ybc_stmt));
+
+	/* Bind the ybctids of the rows to look up. */
+	YBCPgExpr *ybctid_exprs = (YBCPgExpr *) palloc(n_ybctids * sizeof(YBCPgExpr));
+	for (int i = 0; i < n_ybctids; i++)
+	{
+		ybctid_exprs[i] = YBCNewConstant(ybc_stmt, BYTEAOID, ybctids[i], false);
+	}
+	HandleYBStmtStatus(YBCPgDmlBindYbctids(ybc_stmt, n_ybctids, ybctid_exprs), ybc_stmt);
+
+	ybcAppendFetchTargets(ybc_stmt, relation);
+
+	/* Execute the select statement. The rows are all read in one request per tablet. */
+	HandleYBStmtStatus(YBCPgExecSelect(ybc_stmt, NULL /* exec_params */), ybc_stmt);
+
+	Datum           *values = (Datum *) palloc0(tupdesc->natts * sizeof(Datum));
+	bool            *nulls  = (bool *) palloc(tupdesc->natts * sizeof(bool));
+	YBCPgSysColumns syscols;
+	bool            has_data = false;
+	int             pos = 0;
+
+	memset(tuples, 0, n_ybctids * sizeof(HeapTuple));
+
+	/* The rows are fetched in the order of their ybctids. Rows that do not exist are skipped. */
+	for (;;)
+	{
+		HandleYBStmtStatus(YBCPgDmlFetch(ybc_stmt,
+										 tupdesc->natts,
+										 (uint64_t *) values,
+										 nulls,
+										 &syscols,
+										 &has_data),
+						   ybc_stmt);
+		if (!has_data)
+			break;
+
+		HeapTuple tuple = ybcFormFetchedTuple(relation, values, nulls, &syscols);
+		while (pos < n_ybctids && !ybcYbctidEquals(ybctids[pos], tuple->t_ybctid))
+			pos++;
+		if (pos == n_ybctids)
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("unexpected row in batched lookup by ybctid")));
+		tuples[pos++] = tuple;
+	}
+	pfree(values);
+	pfree(nulls);
+	pfree(ybctid_exprs);
+
+	/* Complete execution */
+	HandleYBStatus(YBCPgDeleteStatement(ybc_stmt));
+}
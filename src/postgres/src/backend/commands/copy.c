@@ -2654,7 +2654,14 @@ CopyFrom(CopyState cstate)
 				 errhint("Non-transactional COPY is not supported on relations with "
 						 "secondary indices or triggers.")));
 
-	if (useYBMultiInsert)
+	/*
+	 * A non-transactional COPY is a bulk load: its rows are sorted by partition
+	 * key before being flushed so that each flush reaches few tablets with
+	 * large batches.
+	 */
+	if (useYBMultiInsert && useNonTxnInsert)
+		YBCStartBulkLoadWriteOperations();
+	else if (useYBMultiInsert)
 		YBCStartBufferingWriteOperations();
 
 	PG_TRY();
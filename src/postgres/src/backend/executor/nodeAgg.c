@@ -298,6 +298,8 @@ static int find_compatible_pertrans(AggState *aggstate, Aggref *newagg,
 						 List *transnos);
 static void yb_agg_pushdown_supported(AggState *aggstate);
 static void yb_agg_pushdown(AggState *aggstate);
+static void yb_agg_combine_partials(AggState *aggstate, TupleTableSlot *outerslot,
+									AggStatePerGroup pergroup);
 
 
 /*
@@ -1536,16 +1538,31 @@ yb_agg_pushdown_supported(AggState *aggstate)
 	/* Initially set pushdown supported to false. */
 	aggstate->yb_pushdown_supported = false;
 
-	/* Phase 0 is a dummy phase, so there should be two phases. */
-	if (aggstate->numphases != 2)
-		return;
+	if (aggstate->phase->aggstrategy == AGG_PLAIN)
+	{
+		/* Phase 0 is a dummy phase, so there should be two phases. */
+		if (aggstate->numphases != 2)
+			return;
 
-	/* Plain agg strategy. */
-	if (aggstate->phase->aggstrategy != AGG_PLAIN)
-		return;
+		/* No GROUP BY. */
+		if (aggstate->phase->numsets != 0)
+			return;
+	}
+	else if (aggstate->phase->aggstrategy == AGG_HASHED)
+	{
+		AggStatePerHash perhash = &aggstate->perhash[0];
 
-	/* No GROUP BY. */
-	if (aggstate->phase->numsets != 0)
+		/* A single hashed GROUP BY, without grouping sets. */
+		if (aggstate->numphases != 1 || aggstate->num_hashes != 1 ||
+			((Agg *) aggstate->ss.ps.plan)->groupingSets != NIL ||
+			perhash->numCols == 0)
+			return;
+
+		/* Only the GROUP BY columns are needed from the input rows. */
+		if (perhash->numhashGrpCols != perhash->numCols)
+			return;
+	}
+	else
 		return;
 
 	/* Foreign scan outer plan. */
@@ -1562,6 +1579,35 @@ yb_agg_pushdown_supported(AggState *aggstate)
 	if (scan_state->ss.ps.qual)
 		return;
 
+	/*
+	 * GROUP BY columns are columns of the scanned relation that the scan returns at their
+	 * attribute positions, without projection.
+	 */
+	if (aggstate->phase->aggstrategy == AGG_HASHED)
+	{
+		AggStatePerHash perhash = &aggstate->perhash[0];
+		List *scan_tlist = scan_state->ss.ps.plan->targetlist;
+		int i;
+
+		if (scan_state->ss.ps.ps_ProjInfo != NULL)
+			return;
+
+		for (i = 0; i < perhash->numCols; i++)
+		{
+			AttrNumber colno = perhash->hashGrpColIdxInput[i];
+			TargetEntry *tle = list_nth_node(TargetEntry, scan_tlist, colno - 1);
+			Var *var;
+
+			if (!IsA(tle->expr, Var))
+				return;
+
+			/* Only support types that are allowed to be YB keys, as for aggregate arguments. */
+			var = castNode(Var, tle->expr);
+			if (var->varattno != colno || !YBCDataTypeIsValidForKey(var->vartype))
+				return;
+		}
+	}
+
 	foreach(lc_agg, aggstate->aggs)
 	{
 		AggrefExprState *aggrefstate = (AggrefExprState *) lfirst(lc_agg);
@@ -1639,6 +1685,7 @@ yb_agg_pushdown(AggState *aggstate)
 {
 	ForeignScanState *scan_state = castNode(ForeignScanState, outerPlanState(aggstate));
 	List *pushdown_aggs = NIL;
+	List *pushdown_group_by = NIL;
 	int aggno;
 
 	for (aggno = 0; aggno < aggstate->numaggs; aggno++)
@@ -1648,6 +1695,65 @@ yb_agg_pushdown(AggState *aggstate)
 		pushdown_aggs = lappend(pushdown_aggs, aggref);
 	}
 	scan_state->yb_fdw_aggs = pushdown_aggs;
+
+	if (aggstate->phase->aggstrategy == AGG_HASHED)
+	{
+		AggStatePerHash perhash = &aggstate->perhash[0];
+		int i;
+
+		for (i = 0; i < perhash->numCols; i++)
+			pushdown_group_by = lappend_int(pushdown_group_by, perhash->hashGrpColIdxInput[i]);
+	}
+	scan_state->yb_fdw_group_by = pushdown_group_by;
+}
+
+/*
+ * Combines a tuple of partial aggregate results returned by YB into the given group.
+ *
+ * The partial results are the last values of the tuple, one for each aggno. With GROUP BY the
+ * tuple also holds the GROUP BY column values at their attribute positions.
+ */
+static void
+yb_agg_combine_partials(AggState *aggstate, TupleTableSlot *outerslot, AggStatePerGroup pergroup)
+{
+	AggStatePerAgg peragg = aggstate->peragg;
+	int offset = outerslot->tts_tupleDescriptor->natts - aggstate->numaggs;
+	int aggno;
+
+	Assert(offset >= 0);
+	slot_getallattrs(outerslot);
+
+	for (aggno = 0; aggno < aggstate->numaggs; aggno++)
+	{
+		MemoryContext oldContext;
+		int transno = peragg[aggno].transno;
+		Aggref *aggref = peragg[aggno].aggref;
+		char *func_name = get_func_name(aggref->aggfnoid);
+		AggStatePerGroup pergroupstate = &pergroup[transno];
+		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
+		FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
+		Datum value = outerslot->tts_values[offset + aggno];
+		bool isnull = outerslot->tts_isnull[offset + aggno];
+
+		if (strcmp(func_name, "count") == 0)
+		{
+			/*
+			 * Sum results from each response for COUNT. It is safe to do this
+			 * directly on the datum as it is guaranteed to be an int64.
+			 */
+			oldContext = MemoryContextSwitchTo(
+				aggstate->curaggcontext->ecxt_per_tuple_memory);
+			pergroupstate->transValue += value;
+			MemoryContextSwitchTo(oldContext);
+		}
+		else
+		{
+			/* Set slot result as argument, then advance the transition function. */
+			fcinfo->arg[1] = value;
+			fcinfo->argnull[1] = isnull;
+			advance_transition_function(aggstate, pertrans, pergroupstate);
+		}
+	}
 }
 
 /*
@@ -1730,7 +1836,6 @@ agg_retrieve_direct(AggState *aggstate)
 	int			nextSetSize;
 	int			numReset;
 	int			i;
-	int			aggno;
 
 	/*
 	 * get state info from node
@@ -1896,40 +2001,7 @@ agg_retrieve_direct(AggState *aggstate)
 					break;
 				}
 
-				Assert(aggstate->numaggs == outerslot->tts_nvalid);
-
-				for (aggno = 0; aggno < aggstate->numaggs; aggno++)
-				{
-					MemoryContext oldContext;
-					int transno = peragg[aggno].transno;
-					Aggref *aggref = aggstate->peragg[aggno].aggref;
-					char *func_name = get_func_name(aggref->aggfnoid);
-					AggStatePerGroup pergroup = pergroups[currentSet];
-					AggStatePerGroup pergroupstate = &pergroup[transno];
-					AggStatePerTrans pertrans = &aggstate->pertrans[transno];
-					FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
-					Datum value = outerslot->tts_values[aggno];
-					bool isnull = outerslot->tts_isnull[aggno];
-
-					if (strcmp(func_name, "count") == 0)
-					{
-						/*
-						 * Sum results from each response for COUNT. It is safe to do this
-						 * directly on the datum as it is guaranteed to be an int64.
-						 */
-						oldContext = MemoryContextSwitchTo(
-							aggstate->curaggcontext->ecxt_per_tuple_memory);
-						pergroupstate->transValue += value;
-						MemoryContextSwitchTo(oldContext);
-					}
-					else
-					{
-						/* Set slot result as argument, then advance the transition function. */
-						fcinfo->arg[1] = value;
-						fcinfo->argnull[1] = isnull;
-						advance_transition_function(aggstate, pertrans, pergroupstate);
-					}
-				}
+				yb_agg_combine_partials(aggstate, outerslot, pergroups[currentSet]);
 
 				/* Reset per-input-tuple context after each tuple */
 				ResetExprContext(tmpcontext);
@@ -2143,8 +2215,14 @@ agg_fill_hash_table(AggState *aggstate)
 		/* Find or build hashtable entries */
 		lookup_hash_entries(aggstate);
 
-		/* Advance the aggregates (or combine functions) */
-		advance_aggregates(aggstate);
+		/*
+		 * Advance the aggregates (or combine functions). Aggs pushed down to YB return
+		 * partial aggregate results for each group instead of rows.
+		 */
+		if (aggstate->yb_pushdown_supported)
+			yb_agg_combine_partials(aggstate, outerslot, aggstate->hash_pergroup[0]);
+		else
+			advance_aggregates(aggstate);
 
 		/*
 		 * Reset per-input-tuple context after each tuple, but note that the
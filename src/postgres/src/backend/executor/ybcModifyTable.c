@@ -885,6 +885,11 @@ void YBCFlushBufferedWriteOperations()
 	HandleYBStatus(YBCPgFlushBufferedWriteOperations());
 }
 
+void YBCStartBulkLoadWriteOperations()
+{
+	HandleYBStatus(YBCPgStartBulkLoadWriteOperations());
+}
+
 bool
 YBCRelInfoHasSecondaryIndices(ResultRelInfo *resultRelInfo)
 {
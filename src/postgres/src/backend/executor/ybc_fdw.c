@@ -32,9 +32,12 @@
 /*  TODO see which includes of this block are still needed. */
 #include "access/htup_details.h"
 #include "access/reloptions.h"
+#include "access/stratnum.h"
 #include "access/sysattr.h"
 #include "catalog/catalog.h"
+#include "catalog/pg_am.h"
 #include "catalog/pg_foreign_table.h"
+#include "catalog/pg_type.h"
 #include "commands/copy.h"
 #include "commands/defrem.h"
 #include "commands/explain.h"
@@ -43,15 +46,20 @@
 #include "foreign/foreign.h"
 #include "miscadmin.h"
 #include "nodes/makefuncs.h"
+#include "nodes/nodeFuncs.h"
 #include "optimizer/cost.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
 #include "optimizer/planmain.h"
 #include "optimizer/restrictinfo.h"
 #include "optimizer/var.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
 #include "utils/memutils.h"
+#include "utils/pg_locale.h"
 #include "utils/rel.h"
 #include "utils/sampling.h"
+#include "utils/selfuncs.h"
 
 /*  YB includes. */
 #include "commands/dbcommands.h"
@@ -289,6 +297,388 @@ ybcBeginForeignScan(ForeignScanState *node, int eflags)
 	                            ybc_state->stmt_owner);
 }
 
+/* -------------------------------------------------------------------------- */
+/*  WHERE clause pushdown */
+
+/*
+ * The quals of the scan are pushed down to DocDB as a pre-filter only: postgres still evaluates
+ * all of them on the returned rows. So a pushed down qual may be weaker than the original qual,
+ * but it must never reject a row that postgres would accept. DocDB compares values of the same
+ * datatype only and compares strings byte by byte, which limits the quals that can be pushed.
+ */
+
+/*
+ * Returns true if DocDB compares values of the given type the same way postgres does.
+ */
+static bool
+ybcIsPushdownType(Oid type_id)
+{
+	switch (type_id)
+	{
+		case BOOLOID:
+		case INT2OID:
+		case INT4OID:
+		case INT8OID:
+		case OIDOID:
+		case FLOAT4OID:
+		case FLOAT8OID:
+		case DATEOID:
+		case TIMESTAMPOID:
+		case TIMESTAMPTZOID:
+		case TEXTOID:
+		case BYTEAOID:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * Returns the user column referenced by the given expression or NULL.
+ */
+static Var *
+ybcGetColumnVar(Node *node)
+{
+	if (!IsA(node, Var))
+		return NULL;
+
+	Var *var = (Var *) node;
+	if (var->varattno <= 0 || var->varlevelsup != 0)
+		return NULL;
+	return var;
+}
+
+/*
+ * Returns the user column referenced by the given expression of the given type or NULL. A varchar
+ * column is relabeled as text by the parser; both types are stored as strings in DocDB.
+ */
+static Var *
+ybcGetPushdownVar(Node *node, Oid type_id)
+{
+	if (!ybcIsPushdownType(type_id) || exprType(node) != type_id)
+		return NULL;
+
+	if (IsA(node, RelabelType))
+	{
+		node = (Node *) ((RelabelType *) node)->arg;
+		if (type_id != TEXTOID || exprType(node) != VARCHAROID)
+			return NULL;
+	}
+	return ybcGetColumnVar(node);
+}
+
+static YBCPgExpr
+ybcNewQualOperator(YbFdwExecState *ybc_state, const char *opname)
+{
+	YBCPgExpr op_handle;
+	HandleYBStmtStatusWithOwner(YBCPgNewOperator(ybc_state->handle,
+												 opname,
+												 YBCDataTypeFromOidMod(InvalidAttrNumber, BOOLOID),
+												 &op_handle),
+								ybc_state->handle,
+								ybc_state->stmt_owner);
+	return op_handle;
+}
+
+static void
+ybcQualAppendArg(YbFdwExecState *ybc_state, YBCPgExpr op_handle, YBCPgExpr arg)
+{
+	HandleYBStmtStatusWithOwner(YBCPgOperatorAppendArg(op_handle, arg),
+								ybc_state->handle,
+								ybc_state->stmt_owner);
+}
+
+static YBCPgExpr
+ybcNewQualColumnRef(YbFdwExecState *ybc_state, Var *var)
+{
+	YBCPgTypeAttrs type_attrs = {var->vartypmod};
+	return YBCNewColumnRef(ybc_state->handle, var->varattno, var->vartype, &type_attrs);
+}
+
+/*
+ * Builds "column <opname> value".
+ */
+static YBCPgExpr
+ybcNewQualComparison(YbFdwExecState *ybc_state, const char *opname, Var *var,
+					 Oid value_type, Datum value)
+{
+	YBCPgExpr op_handle = ybcNewQualOperator(ybc_state, opname);
+	ybcQualAppendArg(ybc_state, op_handle, ybcNewQualColumnRef(ybc_state, var));
+	ybcQualAppendArg(ybc_state, op_handle,
+					 YBCNewConstant(ybc_state->handle, value_type, value, false /* is_null */));
+	return op_handle;
+}
+
+/*
+ * Returns the smallest string that is greater than all strings starting with the given prefix in
+ * byte order, or NULL if there is no such string.
+ */
+static text *
+ybcGetPrefixUpperBound(text *prefix)
+{
+	int len = VARSIZE_ANY_EXHDR(prefix);
+	unsigned char *data = (unsigned char *) VARDATA_ANY(prefix);
+
+	while (len > 0 && data[len - 1] == 0xFF)
+		len--;
+	if (len == 0)
+		return NULL;
+
+	text *result = cstring_to_text_with_len((char *) data, len);
+	((unsigned char *) VARDATA(result))[len - 1]++;
+	return result;
+}
+
+/*
+ * Translates "column LIKE 'prefix%...'" into "column >= 'prefix' AND column < 'prefiy'".
+ */
+static YBCPgExpr
+ybcBuildLikeQual(YbFdwExecState *ybc_state, Var *var, Const *pattern, Oid collation)
+{
+	Const *prefix = NULL;
+	Pattern_Prefix_Status status = pattern_fixed_prefix(pattern, Pattern_Type_Like, collation,
+														&prefix, NULL /* rest_selec */);
+	if (status == Pattern_Prefix_None)
+		return NULL;
+	if (status == Pattern_Prefix_Exact)
+		return ybcNewQualComparison(ybc_state, "=", var, TEXTOID, prefix->constvalue);
+
+	YBCPgExpr lower_bound = ybcNewQualComparison(ybc_state, ">=", var, TEXTOID,
+												 prefix->constvalue);
+	text *upper_value = ybcGetPrefixUpperBound(DatumGetTextPP(prefix->constvalue));
+	if (upper_value == NULL)
+		return lower_bound;
+
+	YBCPgExpr op_handle = ybcNewQualOperator(ybc_state, "and");
+	ybcQualAppendArg(ybc_state, op_handle, lower_bound);
+	ybcQualAppendArg(ybc_state, op_handle,
+					 ybcNewQualComparison(ybc_state, "<", var, TEXTOID,
+										  PointerGetDatum(upper_value)));
+	return op_handle;
+}
+
+/*
+ * Translates "column <op> constant" (or "constant <op> column") where <op> is a btree comparison
+ * operator or its negator.
+ */
+static YBCPgExpr
+ybcBuildOpExprQual(YbFdwExecState *ybc_state, OpExpr *opexpr)
+{
+	if (list_length(opexpr->args) != 2)
+		return NULL;
+
+	Oid lefttype;
+	Oid righttype;
+	op_input_types(opexpr->opno, &lefttype, &righttype);
+	if (lefttype != righttype)
+		return NULL;
+
+	/* A NULL constant is left to postgres: a comparison with NULL is never true. */
+	Node *left = (Node *) linitial(opexpr->args);
+	Node *right = (Node *) lsecond(opexpr->args);
+	bool var_on_left = IsA(right, Const);
+	Var *var = ybcGetPushdownVar(var_on_left ? left : right, lefttype);
+	Const *value = (Const *) (var_on_left ? right : left);
+	if (var == NULL || !IsA(value, Const) || value->constisnull || value->consttype != lefttype)
+		return NULL;
+
+	if (opexpr->opno == OID_TEXT_LIKE_OP)
+		return var_on_left ? ybcBuildLikeQual(ybc_state, var, value, opexpr->inputcollid) : NULL;
+
+	Oid opclass = GetDefaultOpClass(lefttype, BTREE_AM_OID);
+	if (!OidIsValid(opclass))
+		return NULL;
+	Oid opfamily = get_opclass_family(opclass);
+
+	const char *opname = NULL;
+	switch (get_op_opfamily_strategy(opexpr->opno, opfamily))
+	{
+		case BTLessStrategyNumber:
+			opname = var_on_left ? "<" : ">";
+			break;
+		case BTLessEqualStrategyNumber:
+			opname = var_on_left ? "<=" : ">=";
+			break;
+		case BTEqualStrategyNumber:
+			opname = "=";
+			break;
+		case BTGreaterEqualStrategyNumber:
+			opname = var_on_left ? ">=" : "<=";
+			break;
+		case BTGreaterStrategyNumber:
+			opname = var_on_left ? ">" : "<";
+			break;
+		default:
+			if (get_op_opfamily_strategy(get_negator(opexpr->opno), opfamily) ==
+				BTEqualStrategyNumber)
+				opname = "<>";
+			break;
+	}
+	if (opname == NULL)
+		return NULL;
+
+	/*
+	 * DocDB finds NaN equal to every value while postgres orders it above all other values, so
+	 * only equality, which may let extra rows through but never drops one, is pushed for floats.
+	 */
+	if ((lefttype == FLOAT4OID || lefttype == FLOAT8OID) && strcmp(opname, "=") != 0)
+		return NULL;
+
+	/* Strings are ordered byte by byte in DocDB, which matches the "C" collation only. */
+	if (lefttype == TEXTOID && strcmp(opname, "=") != 0 && strcmp(opname, "<>") != 0 &&
+		!lc_collate_is_c(opexpr->inputcollid))
+		return NULL;
+
+	return ybcNewQualComparison(ybc_state, opname, var, value->consttype, value->constvalue);
+}
+
+/*
+ * Translates "column = ANY ('{c1, c2, ...}')", which is how postgres represents
+ * "column IN (c1, c2, ...)", into an IN condition.
+ */
+static YBCPgExpr
+ybcBuildScalarArrayOpQual(YbFdwExecState *ybc_state, ScalarArrayOpExpr *saop)
+{
+	if (!saop->useOr || list_length(saop->args) != 2)
+		return NULL;
+
+	Oid lefttype;
+	Oid righttype;
+	op_input_types(saop->opno, &lefttype, &righttype);
+	if (lefttype != righttype)
+		return NULL;
+
+	Var *var = ybcGetPushdownVar((Node *) linitial(saop->args), lefttype);
+	Const *array = (Const *) lsecond(saop->args);
+	if (var == NULL || !IsA(array, Const) || array->constisnull ||
+		get_element_type(array->consttype) != lefttype)
+		return NULL;
+
+	Oid opclass = GetDefaultOpClass(lefttype, BTREE_AM_OID);
+	if (!OidIsValid(opclass) ||
+		get_op_opfamily_strategy(saop->opno, get_opclass_family(opclass)) != BTEqualStrategyNumber)
+		return NULL;
+
+	ArrayType *arr = DatumGetArrayTypeP(array->constvalue);
+	int16 elmlen;
+	bool elmbyval;
+	char elmalign;
+	Datum *elem_values;
+	bool *elem_nulls;
+	int num_elems;
+	get_typlenbyvalalign(lefttype, &elmlen, &elmbyval, &elmalign);
+	deconstruct_array(arr, lefttype, elmlen, elmbyval, elmalign,
+					  &elem_values, &elem_nulls, &num_elems);
+
+	/* NULL elements never match, so they are left out of the list. */
+	YBCPgExpr op_handle = NULL;
+	for (int i = 0; i < num_elems; i++)
+	{
+		if (elem_nulls[i])
+			continue;
+		if (op_handle == NULL)
+		{
+			op_handle = ybcNewQualOperator(ybc_state, "in");
+			ybcQualAppendArg(ybc_state, op_handle, ybcNewQualColumnRef(ybc_state, var));
+		}
+		ybcQualAppendArg(ybc_state, op_handle,
+						 YBCNewConstant(ybc_state->handle, lefttype, elem_values[i],
+										false /* is_null */));
+	}
+	return op_handle;
+}
+
+/*
+ * Translates the given qual into a YugaByte condition. Returns NULL if the qual cannot be pushed
+ * down. Expressions that were created for a qual that turns out not to be pushable are simply
+ * left unused; they are freed together with the statement.
+ */
+static YBCPgExpr
+ybcBuildQual(YbFdwExecState *ybc_state, Expr *qual)
+{
+	switch (nodeTag(qual))
+	{
+		case T_OpExpr:
+			return ybcBuildOpExprQual(ybc_state, (OpExpr *) qual);
+
+		case T_ScalarArrayOpExpr:
+			return ybcBuildScalarArrayOpQual(ybc_state, (ScalarArrayOpExpr *) qual);
+
+		case T_NullTest:
+		{
+			NullTest *ntest = (NullTest *) qual;
+			Var *var = ybcGetColumnVar((Node *) ntest->arg);
+			if (var == NULL || ntest->argisrow)
+				return NULL;
+
+			YBCPgExpr op_handle = ybcNewQualOperator(ybc_state,
+													 ntest->nulltesttype == IS_NULL
+														 ? "is_null"
+														 : "is_not_null");
+			ybcQualAppendArg(ybc_state, op_handle, ybcNewQualColumnRef(ybc_state, var));
+			return op_handle;
+		}
+
+		case T_BoolExpr:
+		{
+			BoolExpr *bexpr = (BoolExpr *) qual;
+			ListCell *lc;
+			List *args = NIL;
+
+			/* NOT is not pushed down: a weaker argument would make the negation stronger. */
+			if (bexpr->boolop == NOT_EXPR)
+				return NULL;
+
+			foreach(lc, bexpr->args)
+			{
+				YBCPgExpr arg = ybcBuildQual(ybc_state, (Expr *) lfirst(lc));
+				if (arg != NULL)
+					args = lappend(args, arg);
+				else if (bexpr->boolop == OR_EXPR)
+					return NULL;
+			}
+
+			/* An AND condition is pushed down with the subset of its arguments that can be. */
+			if (args == NIL)
+				return NULL;
+			if (list_length(args) == 1)
+				return (YBCPgExpr) linitial(args);
+
+			YBCPgExpr op_handle = ybcNewQualOperator(ybc_state,
+													 bexpr->boolop == AND_EXPR ? "and" : "or");
+			foreach(lc, args)
+				ybcQualAppendArg(ybc_state, op_handle, (YBCPgExpr) lfirst(lc));
+			return op_handle;
+		}
+
+		default:
+			return NULL;
+	}
+}
+
+/*
+ * Push down the quals of the scan to DocDB.
+ */
+static void
+ybcSetupScanQuals(ForeignScanState *node)
+{
+	YbFdwExecState *ybc_state = (YbFdwExecState *) node->fdw_state;
+	ListCell *lc;
+
+	MemoryContext oldcontext =
+		MemoryContextSwitchTo(node->ss.ps.ps_ExprContext->ecxt_per_query_memory);
+
+	foreach(lc, node->ss.ps.plan->qual)
+	{
+		YBCPgExpr qual = ybcBuildQual(ybc_state, (Expr *) lfirst(lc));
+		if (qual != NULL)
+			HandleYBStmtStatusWithOwner(YBCPgDmlAppendQual(ybc_state->handle, qual),
+										ybc_state->handle,
+										ybc_state->stmt_owner);
+	}
+	MemoryContextSwitchTo(oldcontext);
+}
+
 /*
  * Setup the scan targets (either columns or aggregates).
  */
@@ -437,13 +827,34 @@ ybcSetupScanTargets(ForeignScanState *node)
 										ybc_state->stmt_owner);
 		}
 
+		/* Set GROUP BY columns. */
+		foreach(lc, node->yb_fdw_group_by)
+		{
+			int attno = lfirst_int(lc);
+			Form_pg_attribute attr = TupleDescAttr(tupdesc, attno - 1);
+			YBCPgTypeAttrs type_attrs = {attr->atttypmod};
+
+			YBCPgExpr group_by = YBCNewColumnRef(ybc_state->handle,
+												 attno,
+												 attr->atttypid,
+												 &type_attrs);
+			HandleYBStmtStatusWithOwner(YBCPgDmlAppendGroupBy(ybc_state->handle, group_by),
+										ybc_state->handle,
+										ybc_state->stmt_owner);
+		}
+
 		/*
 		 * Setup the scan slot based on new tuple descriptor for the given targets. This is a dummy
 		 * tupledesc that only includes the number of attributes. Switch to per-query memory from
 		 * per-tuple memory so the slot persists across iterations.
+		 *
+		 * With GROUP BY, the GROUP BY column values are returned at their attribute positions and
+		 * the aggregate results follow the relation attributes.
 		 */
-		TupleDesc target_tupdesc = CreateTemplateTupleDesc(list_length(node->yb_fdw_aggs),
-														   false /* hasoid */);
+		int target_natts = list_length(node->yb_fdw_aggs);
+		if (node->yb_fdw_group_by != NIL)
+			target_natts += tupdesc->natts;
+		TupleDesc target_tupdesc = CreateTemplateTupleDesc(target_natts, false /* hasoid */);
 		ExecInitScanTupleSlot(estate, &node->ss, target_tupdesc);
 	}
 	MemoryContextSwitchTo(oldcontext);
@@ -469,6 +880,7 @@ ybcIterateForeignScan(ForeignScanState *node)
 	 */
 	if (!ybc_state->is_exec_done) {
 		ybcSetupScanTargets(node);
+		ybcSetupScanQuals(node);
 		HandleYBStmtStatusWithOwner(YBCPgExecSelect(ybc_state->handle, ybc_state->exec_params),
 																ybc_state->handle,
 																ybc_state->stmt_owner);
@@ -130,6 +130,7 @@ extern bool optimize_bounded_sort;
 
 static double yb_transaction_priority_lower_bound = 0.0;
 static double yb_transaction_priority_upper_bound = 1.0;
+static int	yb_select_parallelism = 1;
 
 static int	GUC_check_errcode_value;
 
@@ -202,6 +203,7 @@ static const char *show_data_directory_mode(void);
 
 extern void YBCAssignTransactionPriorityLowerBound(double newval, void* extra);
 extern void YBCAssignTransactionPriorityUpperBound(double newval, void* extra);
+extern void YBCAssignSelectParallelism(int newval, void* extra);
 
 /* Private functions in guc-file.l that need to be called from guc.c */
 static ConfigVariable *ProcessConfigFileInternal(GucContext context,
@@ -3085,6 +3087,18 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"yb_select_parallelism", PGC_USERSET, CLIENT_CONN_STATEMENT,
+			gettext_noop("Sets the number of concurrent sub-scans used by a full "
+						 "scan of a hash-partitioned table."),
+			gettext_noop("Each sub-scan reads a contiguous range of tablets. "
+						 "A value of 1 scans the tablets one at a time.")
+		},
+		&yb_select_parallelism,
+		1, 1, 256,
+		NULL, YBCAssignSelectParallelism, NULL
+	},
+
 	/* End-of-list marker */
 	{
 		{NULL, 0, 0, NULL, NULL}, NULL, 0, 0, 0, NULL, NULL, NULL
@@ -66,6 +66,16 @@ typedef struct YbScanDescData
 	 *   execution in YB tablet server.
 	 */
 	YBCPgExecParameters *exec_params;
+
+	/*
+	 * Rows of the base table that a secondary index scan has looked up ahead of time, with the
+	 * recheck flags of their index entries. See ybc_index_getnext_batched().
+	 */
+	MemoryContext batch_context;
+	HeapTuple    *batch_tuples;
+	bool         *batch_rechecks;
+	int           batch_size;
+	int           batch_pos;
 } YbScanDescData;
 
 typedef struct YbScanDescData *YbScanDesc;
@@ -116,6 +126,13 @@ extern void ybc_index_beginscan(Relation index,
 extern IndexTuple ybc_index_getnext(IndexScanDesc scan_desc, bool is_forward_scan);
 extern void ybc_index_endscan(IndexScanDesc scan_desc);
 
+/*
+ * Fetch the rows of the base table for a secondary index scan. The rows of up to
+ * ysql_max_batch_ybctids index entries are looked up in one batched read.
+ */
+extern bool ybc_index_can_batch(IndexScanDesc scan_desc, ScanDirection direction);
+extern HeapTuple ybc_index_getnext_batched(IndexScanDesc scan_desc, ScanDirection direction);
+
 /* Number of rows assumed for a YB table if no size estimates exist */
 #define YBC_DEFAULT_NUM_ROWS  1000
 
@@ -133,5 +150,11 @@ extern void ybcIndexCostEstimate(IndexPath *path, Selectivity *selectivity,
  */
 extern HeapTuple YBCFetchTuple(Relation relation, Datum ybctid);
 
+/*
+ * Fetch the tuples of distinct ybctids in one batched read. tuples[i] is set to the tuple of
+ * ybctids[i], or to NULL if it does not exist.
+ */
+extern void YBCFetchTuples(Relation relation, Datum *ybctids, int n_ybctids, HeapTuple *tuples);
+
 
 #endif							/* YBCAM_H */
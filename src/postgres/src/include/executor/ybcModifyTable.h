@@ -108,6 +108,7 @@ extern void YBCUpdateSysCatalogTuple(Relation rel,
 // Buffer write operations.
 extern void YBCStartBufferingWriteOperations();
 extern void YBCFlushBufferedWriteOperations();
+extern void YBCStartBulkLoadWriteOperations();
 
 //------------------------------------------------------------------------------
 // Utility methods.
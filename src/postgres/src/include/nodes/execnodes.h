@@ -1671,6 +1671,7 @@ typedef struct ForeignScanState
 
 	/* YB specific attributes. */
 	List	   *yb_fdw_aggs;	/* aggregate pushdown information */
+	List	   *yb_fdw_group_by;	/* attnos of the pushed down GROUP BY columns */
 } ForeignScanState;
 
 /* ----------------
@@ -560,6 +560,14 @@ YBPgsqlReadOp *YBPgsqlReadOp::NewSelect(const shared_ptr<YBTable>& table) {
   return op;
 }
 
+std::unique_ptr<YBPgsqlReadOp> YBPgsqlReadOp::DeepCopy() {
+  std::unique_ptr<YBPgsqlReadOp> result(new YBPgsqlReadOp(table_));
+  *result->read_request_ = *read_request_;
+  result->yb_consistency_level_ = yb_consistency_level_;
+  result->read_time_ = read_time_;
+  return result;
+}
+
 std::string YBPgsqlReadOp::ToString() const {
   return "PGSQL_READ " + read_request_->DebugString();
 }
@@ -604,6 +612,10 @@ Status YBPgsqlReadOp::GetPartitionKey(string* partition_key) const {
       const uint16 hash_code = VERIFY_RESULT(docdb::DocKey::DecodeHash(ybctid.binary_value()));
       read_request_->set_hash_code(hash_code);
       *partition_key = PartitionSchema::EncodeMultiColumnHashValue(hash_code);
+    } else if (read_request_->has_hash_code()) {
+      // Start the scan from the lower bound of the requested hash range.
+      uint16 hash_code = static_cast<uint16>(read_request_->hash_code());
+      *partition_key = PartitionSchema::EncodeMultiColumnHashValue(hash_code);
     } else {
       // Default to empty key, this will start a scan from the beginning.
       partition_key->clear();
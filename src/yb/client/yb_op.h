@@ -461,6 +461,10 @@ class YBPgsqlReadOp : public YBPgsqlOp {
 
   static YBPgsqlReadOp *NewSelect(const std::shared_ptr<YBTable>& table);
 
+  // Create a new read op on the same table with a copy of this op's request, consistency level
+  // and read time. Used to fan a scan out to several partition ranges.
+  std::unique_ptr<YBPgsqlReadOp> DeepCopy();
+
   // Note: to avoid memory copy, this PgsqlReadRequestPB is moved into tserver ReadRequestPB
   // when the request is sent to tserver. It is restored after response is received from tserver
   // (see ReadRpc's constructor).
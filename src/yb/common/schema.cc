@@ -96,6 +96,9 @@ void TableProperties::ToTablePropertiesPB(TablePropertiesPB *pb) const {
     pb->set_num_tablets(num_tablets_);
   }
   pb->set_is_ysql_catalog_table(is_ysql_catalog_table_);
+  if (compaction_style_ != TableCompactionStyle::UNIVERSAL_COMPACTION_STYLE) {
+    pb->set_compaction_style(compaction_style_);
+  }
 }
 
 TableProperties TableProperties::FromTablePropertiesPB(const TablePropertiesPB& pb) {
@@ -124,6 +127,9 @@ TableProperties TableProperties::FromTablePropertiesPB(const TablePropertiesPB&
   if (pb.has_is_ysql_catalog_table()) {
     table_properties.set_is_ysql_catalog_table(pb.is_ysql_catalog_table());
   }
+  if (pb.has_compaction_style()) {
+    table_properties.SetCompactionStyle(pb.compaction_style());
+  }
   return table_properties;
 }
 
@@ -160,6 +166,7 @@ void TableProperties::Reset() {
   use_mangled_column_name_ = false;
   num_tablets_ = 0;
   is_ysql_catalog_table_ = false;
+  compaction_style_ = TableCompactionStyle::UNIVERSAL_COMPACTION_STYLE;
 }
 
 string TableProperties::ToString() const {
@@ -172,6 +179,9 @@ string TableProperties::ToString() const {
   if (HasCopartitionTableId()) {
     result += Format("copartition_table_id: $0 ", copartition_table_id_);
   }
+  if (compaction_style_ != TableCompactionStyle::UNIVERSAL_COMPACTION_STYLE) {
+    result += Format("compaction_style: $0 ", TableCompactionStyle_Name(compaction_style_));
+  }
   return result + Format(
       "consistency_level: $0 is_ysql_catalog_table: $1 }",
       consistency_level_,
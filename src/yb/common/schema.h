@@ -454,6 +454,14 @@ class TableProperties {
     return is_ysql_catalog_table_;
   }
 
+  void SetCompactionStyle(TableCompactionStyle compaction_style) {
+    compaction_style_ = compaction_style;
+  }
+
+  TableCompactionStyle compaction_style() const {
+    return compaction_style_;
+  }
+
   void ToTablePropertiesPB(TablePropertiesPB *pb) const;
 
   static TableProperties FromTablePropertiesPB(const TablePropertiesPB& pb);
@@ -475,6 +483,7 @@ class TableProperties {
   bool use_mangled_column_name_ = false;
   int num_tablets_ = 0;
   bool is_ysql_catalog_table_ = false;
+  TableCompactionStyle compaction_style_ = TableCompactionStyle::UNIVERSAL_COMPACTION_STYLE;
 };
 
 // The schema for a set of rows.
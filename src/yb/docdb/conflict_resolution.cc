@@ -465,11 +465,14 @@ class TransactionConflictResolverContext : public ConflictResolverContext {
       // DB where the provisional record has already been removed.
       resolver->EnsureIntentIteratorCreated();
 
+      // An intent on the whole table conflicts with records of any filter key.
+      const bool whole_table = key_slice.starts_with(ValueTypeAsChar::kGroupEnd);
+
       // TODO(dtxn) reuse iterator
       auto value_iter = CreateRocksDBIterator(
           resolver->doc_db().regular,
           resolver->doc_db().key_bounds,
-          BloomFilterMode::USE_BLOOM_FILTER,
+          whole_table ? BloomFilterMode::DONT_USE_BLOOM_FILTER : BloomFilterMode::USE_BLOOM_FILTER,
           key_slice,
           rocksdb::kDefaultQueryId);
 
@@ -477,8 +480,7 @@ class TransactionConflictResolverContext : public ConflictResolverContext {
       KeyBytes buffer;
       // Inspect records whose doc keys are children of the intent's doc key.  If the intent's doc
       // key is empty, it signifies an intent on the whole table.
-      while (value_iter.Valid() && (key_slice.starts_with(ValueTypeAsChar::kGroupEnd) ||
-                                    value_iter.key().starts_with(key_slice))) {
+      while (value_iter.Valid() && (whole_table || value_iter.key().starts_with(key_slice))) {
         auto existing_key = value_iter.key();
         auto doc_ht = VERIFY_RESULT(DocHybridTime::DecodeFromEnd(&existing_key));
         VLOG(4) << "Check value overwrite: " << transaction_id_
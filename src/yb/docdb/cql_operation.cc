@@ -23,6 +23,7 @@
 
 #include "yb/docdb/doc_ql_scanspec.h"
 #include "yb/docdb/docdb_util.h"
+#include "yb/docdb/packed_row.h"
 #include "yb/docdb/primitive_value_util.h"
 
 #include "yb/util/bfpg/tserver_opcodes.h"
@@ -41,6 +42,11 @@ DEFINE_bool(ycql_consistent_transactional_paging, false,
             "be stale. The latter is preferable for long scans. The data returned for the first "
             "page of results is never stale regardless of this flag.");
 
+DEFINE_bool(ycql_enable_packed_row, false,
+            "Whether to store the columns of YCQL inserts that set every non-key column of a row "
+            "without a TTL or user timestamp as a single packed row value.");
+TAG_FLAG(ycql_enable_packed_row, advanced);
+
 DECLARE_bool(trace_docdb_calls);
 
 namespace yb {
@@ -685,6 +691,68 @@ Status QLWriteOperation::ApplyForRegularColumns(const QLColumnValuePB& column_va
   return Status::OK();
 }
 
+Result<bool> QLWriteOperation::ApplyPackedRow(const DocOperationApplyData& data,
+                                              const QLTableRow& existing_row,
+                                              QLTableRow* new_row) {
+  using yb::bfql::TSOpcode;
+
+  // Columns with a TTL or a user timestamp, collections and static columns are kept in separate
+  // key-values.
+  if (!FLAGS_ycql_enable_packed_row ||
+      request_.type() != QLWriteRequestPB::QL_STMT_INSERT || !encoded_pk_doc_key_ ||
+      request_.has_ttl() || request_.has_user_timestamp_usec() ||
+      static_cast<size_t>(request_.column_values_size()) !=
+          schema_.num_columns() - schema_.num_key_columns()) {
+    return false;
+  }
+  std::vector<bool> column_set(schema_.num_columns());
+  for (const auto& column_value : request_.column_values()) {
+    if (!column_value.has_column_id() ||
+        !column_value.json_args().empty() || !column_value.subscript_args().empty()) {
+      return false;
+    }
+    const int idx = schema_.find_column_by_id(ColumnId(column_value.column_id()));
+    if (idx == Schema::kColumnNotFound || idx < static_cast<int>(schema_.num_key_columns()) ||
+        column_set[idx]) {
+      return false;
+    }
+    const ColumnSchema& column = schema_.column(idx);
+    if (column.is_static() || column.is_counter() || column.type()->IsCollection() ||
+        column.type()->IsUserDefined()) {
+      return false;
+    }
+    const TSOpcode write_instr = GetTSWriteInstruction(column_value.expr());
+    if (write_instr != TSOpcode::kScalarInsert && write_instr != TSOpcode::kToJson) {
+      return false;
+    }
+    column_set[idx] = true;
+  }
+
+  RowPacker packer(request_.schema_version());
+  packer.AddColumn(PrimitiveValue::SystemColumnId(SystemColumnIds::kLivenessColumn),
+                   PrimitiveValue());
+  for (const auto& column_value : request_.column_values()) {
+    const ColumnId column_id(column_value.column_id());
+    const ColumnSchema& column = VERIFY_RESULT_REF(schema_.column_by_id(column_id));
+    QLValue expr_result;
+    RETURN_NOT_OK(EvalExpr(column_value.expr(), existing_row, &expr_result));
+    const SubDocument sub_doc = SubDocument::FromQLValuePB(
+        expr_result.value(), column.sorting_type(), GetTSWriteInstruction(column_value.expr()));
+    // Null columns are not stored, the packed row overwrites any earlier value of them.
+    if (sub_doc.value_type() != ValueType::kTombstone) {
+      packer.AddColumn(PrimitiveValue(column_id), sub_doc);
+    }
+    if (update_indexes_) {
+      new_row->AllocColumn(column_id, expr_result);
+    }
+  }
+
+  RETURN_NOT_OK(data.doc_write_batch->SetPrimitive(
+      DocPath(encoded_pk_doc_key_.as_slice()), Value(packer.Complete()), data.read_time,
+      data.deadline, request_.query_id()));
+  return true;
+}
+
 Status QLWriteOperation::Apply(const DocOperationApplyData& data) {
   QLTableRow existing_row;
   if (request_.has_if_expr()) {
@@ -762,6 +830,12 @@ Status QLWriteOperation::Apply(const DocOperationApplyData& data) {
       // We never use init markers for QL to ensure we perform writes without any reads to
       // ensure our write path is fast while complicating the read path a bit.
       auto is_insert = request_.type() == QLWriteRequestPB::QL_STMT_INSERT;
+      if (VERIFY_RESULT(ApplyPackedRow(data, existing_row, &new_row))) {
+        if (update_indexes_) {
+          RETURN_NOT_OK(UpdateIndexes(existing_row, new_row));
+        }
+        break;
+      }
       if (is_insert && encoded_pk_doc_key_) {
         const DocPath sub_path(encoded_pk_doc_key_.as_slice(),
                                PrimitiveValue::SystemColumnId(SystemColumnIds::kLivenessColumn));
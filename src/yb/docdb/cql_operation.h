@@ -87,6 +87,12 @@ class QLWriteOperation :
                                         const ColumnId& column_id,
                                         QLTableRow* new_row);
 
+  // Writes all the columns of an insert as a single packed row value at the DocKey of the row, if
+  // the insert sets every non-key column. Returns false if the row cannot be packed.
+  Result<bool> ApplyPackedRow(const DocOperationApplyData& data,
+                              const QLTableRow& existing_row,
+                              QLTableRow* new_row);
+
   const QLWriteRequestPB& request() const { return request_; }
   QLResponsePB* response() const { return response_; }
 
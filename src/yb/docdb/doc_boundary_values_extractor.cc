@@ -17,6 +17,12 @@
 
 #include "yb/docdb/consensus_frontier.h"
 #include "yb/docdb/doc_key.h"
+#include "yb/docdb/doc_ttl_util.h"
+#include "yb/docdb/value.h"
+
+#include "yb/gutil/endian.h"
+
+#include "yb/server/hybrid_clock.h"
 
 namespace yb {
 namespace docdb {
@@ -30,6 +36,13 @@ Status GetPrimitiveValue(const rocksdb::UserBoundaryValues& values,
 namespace {
 
 constexpr rocksdb::UserBoundaryTag kDocHybridTimeTag = 1;
+// Time at which the record expires: its write time plus its value-level TTL, its write time for a
+// tombstone, kMin if it expires with the TTL of the table and kMax if it never expires.
+constexpr rocksdb::UserBoundaryTag kExpirationTag = 2;
+// Write time of a record without a value-level TTL, i.e. expiring with the TTL of the table.
+constexpr rocksdb::UserBoundaryTag kTableTtlWriteTimeTag = 3;
+// Write time of a record changing the TTL of the record it is merged with.
+constexpr rocksdb::UserBoundaryTag kTtlMergeWriteTimeTag = 4;
 // Here we reserve some tags for future use.
 // Because Tag is persistent.
 constexpr rocksdb::UserBoundaryTag kRangeComponentsStart = 10;
@@ -80,6 +93,73 @@ class DocHybridTimeValue : public rocksdb::UserBoundaryValue {
   Slice encoded_;
 };
 
+// Wrapper for UserBoundaryValue that stores a HybridTime, used for the expiration tags.
+class HybridTimeBoundaryValue : public rocksdb::UserBoundaryValue {
+ public:
+  HybridTimeBoundaryValue(rocksdb::UserBoundaryTag tag, HybridTime hybrid_time)
+      : tag_(tag), hybrid_time_(hybrid_time) {
+    BigEndian::Store64(buffer_, hybrid_time.ToUint64());
+  }
+
+  static CHECKED_STATUS Create(rocksdb::UserBoundaryTag tag, Slice data,
+                               rocksdb::UserBoundaryValuePtr* value) {
+    CHECK_NOTNULL(value);
+    if (data.size() != sizeof(uint64_t)) {
+      return STATUS_SUBSTITUTE(Corruption, "Wrong size of encoded hybrid time: $0", data.size());
+    }
+    *value = std::make_shared<HybridTimeBoundaryValue>(
+        tag, HybridTime(BigEndian::Load64(data.data())));
+    return Status::OK();
+  }
+
+  virtual ~HybridTimeBoundaryValue() {}
+
+  rocksdb::UserBoundaryTag Tag() override {
+    return tag_;
+  }
+
+  Slice Encode() override {
+    return Slice(buffer_, sizeof(buffer_));
+  }
+
+  int CompareTo(const UserBoundaryValue& pre_rhs) override {
+    const auto* rhs = down_cast<const HybridTimeBoundaryValue*>(&pre_rhs);
+    return hybrid_time_.CompareTo(rhs->hybrid_time_);
+  }
+
+  HybridTime hybrid_time() const {
+    return hybrid_time_;
+  }
+
+ private:
+  rocksdb::UserBoundaryTag tag_;
+  HybridTime hybrid_time_;
+  char buffer_[sizeof(uint64_t)];
+};
+
+// Adds the expiration of a record written at write_time to values. Values that cannot be decoded
+// as DocDB values, such as intents, are considered to never expire.
+void ExtractExpiration(HybridTime write_time, Slice value, rocksdb::UserBoundaryValues* values) {
+  HybridTime expiration = HybridTime::kMax;
+  ValueType value_type;
+  MonoDelta ttl;
+  if (Value::DecodePrimitiveValueType(value, &value_type, nullptr /* merge_flags */, &ttl).ok()) {
+    if (IsMergeRecord(value)) {
+      values->push_back(
+          std::make_shared<HybridTimeBoundaryValue>(kTtlMergeWriteTimeTag, write_time));
+    } else if (value_type == ValueType::kTombstone) {
+      expiration = write_time;
+    } else if (ttl.Equals(Value::kMaxTtl)) {
+      values->push_back(
+          std::make_shared<HybridTimeBoundaryValue>(kTableTtlWriteTimeTag, write_time));
+      expiration = HybridTime::kMin;
+    } else if (!ttl.Equals(Value::kResetTtl)) {
+      expiration = server::HybridClock::AddPhysicalTimeToHybridTime(write_time, ttl);
+    }
+  }
+  values->push_back(std::make_shared<HybridTimeBoundaryValue>(kExpirationTag, expiration));
+}
+
 // Wrapper for UserBoundaryValue that stores PrimitiveValue with index.
 class PrimitiveBoundaryValue : public rocksdb::UserBoundaryValue {
  public:
@@ -147,6 +227,9 @@ class DocBoundaryValuesExtractor : public rocksdb::BoundaryValuesExtractor {
     if (tag == kDocHybridTimeTag) {
       return DocHybridTimeValue::Create(data, value);
     }
+    if (tag == kExpirationTag || tag == kTableTtlWriteTimeTag || tag == kTtlMergeWriteTimeTag) {
+      return HybridTimeBoundaryValue::Create(tag, data, value);
+    }
     if (tag >= kRangeComponentsStart) {
       return PrimitiveBoundaryValue::Create(tag - kRangeComponentsStart, data, value);
     }
@@ -177,6 +260,10 @@ class DocBoundaryValuesExtractor : public rocksdb::BoundaryValuesExtractor {
     RETURN_NOT_OK(DocHybridTimeValue::Create(slices.back(), &temp));
     values->push_back(std::move(temp));
 
+    DocHybridTime doc_ht;
+    RETURN_NOT_OK(doc_ht.FullyDecodeFrom(slices.back()));
+    ExtractExpiration(doc_ht.hybrid_time(), value, values);
+
     for (size_t i = 0; i != size; ++i) {
       RETURN_NOT_OK(PrimitiveBoundaryValue::Create(i, slices[i], &temp));
       values->push_back(std::move(temp));
@@ -252,6 +339,37 @@ Status GetDocHybridTime(const rocksdb::UserBoundaryValues& values, DocHybridTime
   return time_value->value(out);
 }
 
+namespace {
+
+HybridTime HybridTimeWithTag(const rocksdb::UserBoundaryValues& values,
+                             rocksdb::UserBoundaryTag tag) {
+  auto value = rocksdb::UserValueWithTag(values, tag);
+  return value ? down_cast<HybridTimeBoundaryValue*>(value.get())->hybrid_time()
+               : HybridTime::kInvalid;
+}
+
+} // namespace
+
+bool HasExpired(const rocksdb::UserBoundaryValues& largest, HybridTime history_cutoff,
+                MonoDelta table_ttl) {
+  // Files written before expirations were recorded are never considered expired.
+  const HybridTime expiration = HybridTimeWithTag(largest, kExpirationTag);
+  if (!history_cutoff.is_valid() || !expiration.is_valid() || expiration >= history_cutoff) {
+    return false;
+  }
+  const HybridTime table_ttl_write_time = HybridTimeWithTag(largest, kTableTtlWriteTimeTag);
+  if (!table_ttl_write_time.is_valid()) {
+    return true;
+  }
+  bool has_expired = false;
+  return HasExpiredTTL(table_ttl_write_time, table_ttl, history_cutoff, &has_expired).ok() &&
+         has_expired;
+}
+
+bool HasTtlMergeRecords(const rocksdb::UserBoundaryValues& largest) {
+  return HybridTimeWithTag(largest, kTtlMergeWriteTimeTag).is_valid();
+}
+
 rocksdb::UserBoundaryTag TagForRangeComponent(size_t index) {
   return PrimitiveBoundaryValue::TagForIndex(index);
 }
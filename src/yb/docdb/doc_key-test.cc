@@ -418,6 +418,52 @@ TEST_F(DocKeyTest, TestKeyMatching) {
   ASSERT_FALSE(may_match(EncodeSimpleSubDocKey(absent_key))) << "Key: " << absent_key;
 }
 
+TEST_F(DocKeyTest, RangeComponentsFilterKey) {
+  constexpr size_t kNumRangeComponents = 1;
+  auto encode = [](std::vector<PrimitiveValue> range_components) {
+    return DocKey(std::move(range_components)).Encode().ToStringBuffer();
+  };
+  const std::string key_a1 = encode({PrimitiveValue("a"), PrimitiveValue(1)});
+  const std::string key_a2 = encode({PrimitiveValue("a"), PrimitiveValue(2)});
+  const std::string key_a = encode({PrimitiveValue("a")});
+  const std::string key_b1 = encode({PrimitiveValue("b"), PrimitiveValue(1)});
+  const std::string key_b = encode({PrimitiveValue("b")});
+
+  auto filter_key_size = ASSERT_RESULT(FilterKeySize(key_a1, kNumRangeComponents));
+  ASSERT_TRUE(filter_key_size);
+  // The group end of a key with fewer range components is not part of its filter key.
+  ASSERT_EQ(key_a.size() - 1, *filter_key_size);
+  filter_key_size = ASSERT_RESULT(FilterKeySize(key_a, kNumRangeComponents));
+  ASSERT_TRUE(filter_key_size);
+  ASSERT_EQ(key_a.size() - 1, *filter_key_size);
+  // A key ending before its range components does not determine the filter key.
+  filter_key_size = ASSERT_RESULT(FilterKeySize(Slice(), kNumRangeComponents));
+  ASSERT_FALSE(filter_key_size);
+
+  ASSERT_TRUE(ASSERT_RESULT(FilterKeysEqual(key_a1, key_a2, kNumRangeComponents)));
+  ASSERT_FALSE(ASSERT_RESULT(FilterKeysEqual(key_a1, key_b1, kNumRangeComponents)));
+  ASSERT_TRUE(ASSERT_RESULT(FilterKeysEqual(key_a1, key_b1, 0)));
+
+  DocDbAwareFilterPolicy policy(
+      rocksdb::FilterPolicy::kDefaultFixedSizeFilterBits, nullptr, kNumRangeComponents);
+  ASSERT_STRNE("DocKeyHashedComponentsFilter", policy.Name());
+  std::unique_ptr<FilterBitsBuilder> builder(policy.GetFilterBitsBuilder());
+  ASSERT_NE(builder, nullptr);
+  builder->AddKey(policy.GetKeyTransformer()->Transform(key_a1));
+  std::unique_ptr<const char[]> buf;
+  rocksdb::Slice filter = builder->Finish(&buf);
+  std::unique_ptr<FilterBitsReader> reader(policy.GetFilterBitsReader(filter));
+
+  auto may_match = [&](const std::string& key) {
+    return reader->MayMatch(policy.GetKeyTransformer()->Transform(key));
+  };
+  ASSERT_TRUE(may_match(key_a1));
+  ASSERT_TRUE(may_match(key_a2));
+  ASSERT_TRUE(may_match(key_a));
+  ASSERT_FALSE(may_match(key_b1));
+  ASSERT_FALSE(may_match(key_b));
+}
+
 TEST_F(DocKeyTest, TestWriteId) {
   SubDocKey subdoc_key(DocKey({PrimitiveValue("a"), PrimitiveValue(135)}),
                        DocHybridTime(1000000, 4091, 135));
@@ -886,27 +886,78 @@ KeyBytes SubDocKey::AdvanceOutOfDocKeyPrefix() const {
 // DocDbAwareFilterPolicy
 // ------------------------------------------------------------------------------------------------
 
+Result<boost::optional<size_t>> FilterKeySize(Slice key, size_t num_range_components) {
+  const auto* begin = key.data();
+  DocKeyDecoder decoder(key);
+  RETURN_NOT_OK(decoder.DecodeCotableId());
+  auto* input = decoder.mutable_input();
+  if (VERIFY_RESULT(decoder.DecodeHashCode(AllowSpecial::kTrue))) {
+    while (VERIFY_RESULT(HasPrimitiveValue(input, AllowSpecial::kTrue))) {
+      RETURN_NOT_OK(PrimitiveValue::DecodeKey(input, nullptr /* out */));
+    }
+    return decoder.ConsumedSizeFrom(begin);
+  }
+
+  // The group end is not part of the filter key, so keys with fewer range components have the
+  // filter key ordered before the keys they are a prefix of, as required by the filter index.
+  for (size_t i = 0; i != num_range_components; ++i) {
+    if (input->empty()) {
+      return boost::none;
+    }
+    if (!VERIFY_RESULT(HasPrimitiveValue(input, AllowSpecial::kTrue))) {
+      // HasPrimitiveValue consumed the group end.
+      return decoder.ConsumedSizeFrom(begin) - 1;
+    }
+    RETURN_NOT_OK(PrimitiveValue::DecodeKey(input, nullptr /* out */));
+  }
+  return decoder.ConsumedSizeFrom(begin);
+}
+
+Result<bool> FilterKeysEqual(Slice lhs, Slice rhs, size_t num_range_components) {
+  // Keys between lhs and rhs start with the bytes lhs and rhs have in common. These include the
+  // filter key and, when the filter key ends with the range group, the group end. So these keys
+  // have the same filter key.
+  auto lhs_size = VERIFY_RESULT(FilterKeySize(lhs, num_range_components));
+  auto rhs_size = VERIFY_RESULT(FilterKeySize(rhs, num_range_components));
+  return lhs_size && rhs_size && *lhs_size == *rhs_size &&
+         strings::memeq(lhs.data(), rhs.data(), *lhs_size);
+}
+
 namespace {
 
-class HashedComponentsExtractor : public rocksdb::FilterPolicy::KeyTransformer {
+class FilterKeyExtractor : public rocksdb::FilterPolicy::KeyTransformer {
  public:
-  HashedComponentsExtractor() {}
-  HashedComponentsExtractor(const HashedComponentsExtractor&) = delete;
-  HashedComponentsExtractor& operator=(const HashedComponentsExtractor&) = delete;
-
-  static HashedComponentsExtractor& GetInstance() {
-    static HashedComponentsExtractor instance;
-    return instance;
-  }
+  explicit FilterKeyExtractor(size_t num_range_components)
+      : num_range_components_(num_range_components) {}
 
   Slice Transform(Slice key) const override {
-    auto size = CHECK_RESULT(DocKey::EncodedSize(key, DocKeyPart::HASHED_PART_ONLY));
-    return Slice(key.data(), size);
+    auto size = CHECK_RESULT(FilterKeySize(key, num_range_components_));
+    return Slice(key.data(), size ? *size : key.size());
   }
+
+ private:
+  const size_t num_range_components_;
 };
 
+std::string FilterPolicyName(size_t num_range_components) {
+  // Keep the name of the filter policy used before range components were taken into account.
+  return num_range_components == 0
+      ? "DocKeyHashedComponentsFilter"
+      : Format("DocKeyHashedOr$0RangeComponentsFilter", num_range_components);
+}
+
 } // namespace
 
+DocDbAwareFilterPolicy::DocDbAwareFilterPolicy(
+    size_t filter_block_size_bits, rocksdb::Logger* logger, size_t num_range_components)
+    : builtin_policy_(rocksdb::NewFixedSizeFilterPolicy(
+          filter_block_size_bits, rocksdb::FilterPolicy::kDefaultFixedSizeFilterErrorRate, logger)),
+      key_transformer_(std::make_unique<FilterKeyExtractor>(num_range_components)),
+      name_(FilterPolicyName(num_range_components)) {
+}
+
+DocDbAwareFilterPolicy::~DocDbAwareFilterPolicy() = default;
+
 
 void DocDbAwareFilterPolicy::CreateFilter(
     const rocksdb::Slice* keys, int n, std::string* dst) const {
@@ -933,7 +984,7 @@ rocksdb::FilterPolicy::FilterType DocDbAwareFilterPolicy::GetFilterType() const
 }
 
 const rocksdb::FilterPolicy::KeyTransformer* DocDbAwareFilterPolicy::GetKeyTransformer() const {
-  return &HashedComponentsExtractor::GetInstance();
+  return key_transformer_.get();
 }
 
 DocKeyEncoderAfterCotableIdStep DocKeyEncoder::CotableId(const Uuid& cotable_id) {
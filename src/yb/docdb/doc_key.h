@@ -18,6 +18,7 @@
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
+#include <boost/optional.hpp>
 
 #include "yb/rocksdb/env.h"
 #include "yb/rocksdb/filter_policy.h"
@@ -744,15 +745,29 @@ inline std::ostream& operator <<(std::ostream& out, const SubDocKey& subdoc_key)
 std::string BestEffortDocDBKeyToStr(const KeyBytes &key_bytes);
 std::string BestEffortDocDBKeyToStr(const rocksdb::Slice &slice);
 
-// This filter policy only takes into account hashed components of keys for filtering.
+// Returns the size of the filter key of key used by DocDbAwareFilterPolicy. It is the prefix of key
+// up to the end of its hashed components if key has them, and up to the end of its first
+// num_range_components range components otherwise. Returns none when key ends before its filter
+// key does, i.e. when keys starting with key could have different filter keys.
+Result<boost::optional<size_t>> FilterKeySize(Slice key, size_t num_range_components);
+
+// Returns true if all the keys between lhs and rhs, inclusive, have the same filter key for
+// DocDbAwareFilterPolicy with num_range_components range components.
+Result<bool> FilterKeysEqual(Slice lhs, Slice rhs, size_t num_range_components);
+
+// This filter policy only takes into account hashed components of keys for filtering. Keys without
+// hashed components, i.e. keys of range sharded tables, are filtered by their first
+// num_range_components range components. With 0 they all have the same filter key.
 class DocDbAwareFilterPolicy : public rocksdb::FilterPolicy {
  public:
-  explicit DocDbAwareFilterPolicy(size_t filter_block_size_bits, rocksdb::Logger* logger) {
-    builtin_policy_.reset(rocksdb::NewFixedSizeFilterPolicy(
-        filter_block_size_bits, rocksdb::FilterPolicy::kDefaultFixedSizeFilterErrorRate, logger));
-  }
+  DocDbAwareFilterPolicy(
+      size_t filter_block_size_bits, rocksdb::Logger* logger, size_t num_range_components = 0);
+
+  ~DocDbAwareFilterPolicy();
 
-  const char* Name() const override { return "DocKeyHashedComponentsFilter"; }
+  // The number of range components is part of the name, so files written with another number of
+  // range components are read without filter.
+  const char* Name() const override { return name_.c_str(); }
 
   void CreateFilter(const rocksdb::Slice* keys, int n, std::string* dst) const override;
 
@@ -768,6 +783,8 @@ class DocDbAwareFilterPolicy : public rocksdb::FilterPolicy {
 
  private:
   std::unique_ptr<const rocksdb::FilterPolicy> builtin_policy_;
+  std::unique_ptr<const KeyTransformer> key_transformer_;
+  const std::string name_;
 };
 
 // Optional inclusive lower bound and exclusive upper bound for keys served by DocDB.
@@ -121,11 +121,6 @@ DocPgsqlScanSpec::DocPgsqlScanSpec(const Schema& schema,
       lower_doc_key_(bound_key(schema, true)),
       upper_doc_key_(bound_key(schema, false)),
       is_forward_scan_(is_forward_scan) {
-  if (where_expr_) {
-    // Should never get here until WHERE clause is supported.
-    LOG(FATAL) << "DEVELOPERS: Add support for condition (where clause)";
-  }
-
   // If the hash key is fixed and we have range columns with IN condition, try to construct the
   // exact list of range options to scan for.
   if (!hashed_components_->empty() && schema_.num_range_key_columns() > 0 &&
@@ -17,6 +17,7 @@
 #include <string>
 
 #include "yb/rocksdb/db.h"
+#include "yb/rocksdb/db/version_edit.h"
 #include "yb/rocksdb/status.h"
 #include "yb/rocksdb/util/statistics.h"
 
@@ -27,6 +28,7 @@
 #include "yb/docdb/docdb_test_util.h"
 #include "yb/docdb/in_mem_docdb.h"
 #include "yb/docdb/intent.h"
+#include "yb/docdb/packed_row.h"
 #include "yb/gutil/stringprintf.h"
 #include "yb/rocksutil/yb_rocksdb.h"
 #include "yb/tablet/tablet_options.h"
@@ -61,6 +63,8 @@ using namespace std::chrono_literals;
 DECLARE_bool(use_docdb_aware_bloom_filter);
 DECLARE_int32(max_nexts_to_avoid_seek);
 DECLARE_bool(docdb_sort_weak_intents_in_tests);
+DECLARE_bool(delete_expired_sst_files);
+DECLARE_int32(rocksdb_level0_file_num_compaction_trigger);
 
 #define ASSERT_DOC_DB_DEBUG_DUMP_STR_EQ(str) ASSERT_NO_FATALS(AssertDocDbDebugDumpStrEq(str))
 
@@ -2444,6 +2448,98 @@ TEST_F_EX(DocDBTest, BoundaryValuesMultiFiles, DocDBTestBoundaryValues) {
   TestBoundaryValues(350);
 }
 
+TEST_F(DocDBTest, NumExpiredFiles) {
+  ASSERT_OK(DisableCompactions());
+  const DocKey doc_key(PrimitiveValues("k1"));
+  KeyBytes encoded_doc_key(doc_key.Encode());
+  ASSERT_OK(SetPrimitive(DocPath(encoded_doc_key, PrimitiveValue("s1")),
+      Value(PrimitiveValue("v1"), 1ms), 1000_usec_ht));
+  ASSERT_OK(FlushRocksDbAndWait());
+  ASSERT_OK(SetPrimitive(DocPath(encoded_doc_key, PrimitiveValue("s2")),
+      Value(PrimitiveValue("v2")), 2000_usec_ht));
+  ASSERT_OK(FlushRocksDbAndWait());
+  ASSERT_OK(SetPrimitive(DocPath(encoded_doc_key, PrimitiveValue("s3")),
+      Value(PrimitiveValue("v3"), 2ms), 3000_usec_ht));
+  ASSERT_OK(FlushRocksDbAndWait());
+
+  std::vector<rocksdb::LiveFileMetaData> live_files;
+  rocksdb()->GetLiveFilesMetaData(&live_files);
+  ASSERT_EQ(3U, live_files.size());
+  // Newest first, as the compaction picker passes them.
+  sort(live_files.begin(), live_files.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.name > rhs.name;
+  });
+  std::vector<rocksdb::FileMetaData> metas(live_files.size());
+  std::vector<rocksdb::FileMetaData*> files;
+  for (size_t i = 0; i != live_files.size(); ++i) {
+    metas[i].smallest.user_values = live_files[i].smallest.user_values;
+    metas[i].largest.user_values = live_files[i].largest.user_values;
+    files.push_back(&metas[i]);
+  }
+  auto& factory = *options().compaction_filter_factory;
+
+  // v2 has no TTL and the table has no TTL, so it never expires and keeps the newer file as well.
+  SetHistoryCutoffHybridTime(10000_usec_ht);
+  ASSERT_EQ(1U, factory.NumExpiredFiles(files));
+
+  SetTableTTL(1);
+  SetHistoryCutoffHybridTime(4000_usec_ht);
+  ASSERT_EQ(2U, factory.NumExpiredFiles(files));
+  SetHistoryCutoffHybridTime(10000_usec_ht);
+  ASSERT_EQ(3U, factory.NumExpiredFiles(files));
+  SetHistoryCutoffHybridTime(1500_usec_ht);
+  ASSERT_EQ(0U, factory.NumExpiredFiles(files));
+
+  FLAGS_delete_expired_sst_files = false;
+  SetHistoryCutoffHybridTime(10000_usec_ht);
+  ASSERT_EQ(0U, factory.NumExpiredFiles(files));
+}
+
+TEST_F(DocDBTest, DeleteExpiredFiles) {
+  ASSERT_OK(DisableCompactions());
+  const DocKey doc_key(PrimitiveValues("k1"));
+  KeyBytes encoded_doc_key(doc_key.Encode());
+  // All files but the newest one only have records that expire after 1ms, enough of them to
+  // trigger a universal compaction.
+  const size_t num_files = FLAGS_rocksdb_level0_file_num_compaction_trigger;
+  for (size_t i = 1; i <= num_files; ++i) {
+    const Value value = i == num_files
+        ? Value(PrimitiveValue(Format("v$0", i)))
+        : Value(PrimitiveValue(Format("v$0", i)), 1ms);
+    ASSERT_OK(SetPrimitive(DocPath(encoded_doc_key, PrimitiveValue(Format("s$0", i))),
+        value, HybridTime::FromMicros(1000 * i)));
+    ASSERT_OK(FlushRocksDbAndWait());
+  }
+
+  std::vector<rocksdb::LiveFileMetaData> live_files;
+  rocksdb()->GetLiveFilesMetaData(&live_files);
+  ASSERT_EQ(num_files, live_files.size());
+  const std::string newest_file = std::max_element(
+      live_files.begin(), live_files.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.name < rhs.name;
+      })->name;
+
+  // Advance the history cutoff past the expiration of the older records and let the compaction
+  // picker run.
+  SetHistoryCutoffHybridTime(HybridTime::FromMicros(1000 * (num_files + 10)));
+  ASSERT_OK(ReinitDBOptions());
+
+  ASSERT_OK(WaitFor([this] {
+    std::vector<rocksdb::LiveFileMetaData> files;
+    rocksdb()->GetLiveFilesMetaData(&files);
+    return files.size() == 1;
+  }, 30s, "Expired files deleted"));
+
+  // The expired files were deleted without compacting the newest file, which would rewrite it.
+  live_files.clear();
+  rocksdb()->GetLiveFilesMetaData(&live_files);
+  ASSERT_EQ(1U, live_files.size());
+  ASSERT_EQ(newest_file, live_files[0].name);
+  ASSERT_STR_EQ_VERBOSE_TRIMMED(Format(R"#(
+SubDocKey(DocKey([], ["k1"]), ["s$0"; HT{ physical: $1 }]) -> "v$0"
+      )#", num_files, 1000 * num_files), DocDBDebugDumpToStr());
+}
+
 TEST_F(DocDBTest, BloomFilterTest) {
   // Turn off "next instead of seek" optimization, because this test rely on DocDB to do seeks.
   FLAGS_max_nexts_to_avoid_seek = 0;
@@ -3009,6 +3105,70 @@ TEST_F(DocDBTest, TestBuildSubDocumentBounds) {
   EXPECT_FALSE(subdoc_found);
 }
 
+TEST_F(DocDBTest, PackedRow) {
+  const DocKey doc_key(PrimitiveValues("mydockey", 123456));
+  const KeyBytes encoded_doc_key(doc_key.Encode());
+
+  // A column written before the packed row, which overwrites it.
+  ASSERT_OK(SetPrimitive(DocPath(encoded_doc_key, PrimitiveValue("c")),
+                         Value(PrimitiveValue("c0")), 1000_usec_ht));
+  RowPacker packer(/* schema_version */ 0);
+  packer.AddColumn(PrimitiveValue("a"), PrimitiveValue("a1"));
+  packer.AddColumn(PrimitiveValue("b"), PrimitiveValue("b1"));
+  ASSERT_OK(SetPrimitive(DocPath(encoded_doc_key), Value(packer.Complete()), 2000_usec_ht));
+
+  // Columns written after the packed row override its values.
+  ASSERT_OK(SetPrimitive(DocPath(encoded_doc_key, PrimitiveValue("a")),
+                         Value(PrimitiveValue("a2")), 3000_usec_ht));
+  ASSERT_OK(SetPrimitive(DocPath(encoded_doc_key, PrimitiveValue("b")),
+                         Value(PrimitiveValue::kTombstone), 4000_usec_ht));
+
+  VerifySubDocument(SubDocKey(doc_key), 1500_usec_ht, R"#(
+{
+  "c": "c0"
+}
+      )#");
+  VerifySubDocument(SubDocKey(doc_key), 2500_usec_ht, R"#(
+{
+  "a": "a1",
+  "b": "b1"
+}
+      )#");
+  VerifySubDocument(SubDocKey(doc_key), 3500_usec_ht, R"#(
+{
+  "a": "a2",
+  "b": "b1"
+}
+      )#");
+  VerifySubDocument(SubDocKey(doc_key), 4500_usec_ht, R"#(
+{
+  "a": "a2"
+}
+      )#");
+
+  // Read the columns with a projection, as done for CQL rows.
+  const std::vector<PrimitiveValue> projection = {
+      PrimitiveValue("a"), PrimitiveValue("b"), PrimitiveValue("c")};
+  const auto read_projection = [&](HybridTime ht, SubDocument* row) {
+    auto iter = CreateIntentAwareIterator(
+        doc_db(), BloomFilterMode::USE_BLOOM_FILTER, encoded_doc_key.AsSlice(),
+        rocksdb::kDefaultQueryId, kNonTransactionalOperationContext, CoarseTimePoint::max(),
+        ReadHybridTime::SingleTime(ht));
+    bool doc_found = false;
+    GetSubDocumentData data = { encoded_doc_key, row, &doc_found };
+    ASSERT_OK(GetSubDocument(iter.get(), data, &projection, SeekFwdSuffices::kFalse));
+  };
+  SubDocument row;
+  read_projection(2500_usec_ht, &row);
+  ASSERT_EQ("a1", row.GetChild(PrimitiveValue("a"))->GetString());
+  ASSERT_EQ("b1", row.GetChild(PrimitiveValue("b"))->GetString());
+  ASSERT_EQ(ValueType::kInvalid, row.GetChild(PrimitiveValue("c"))->value_type());
+  read_projection(4500_usec_ht, &row);
+  ASSERT_EQ("a2", row.GetChild(PrimitiveValue("a"))->GetString());
+  ASSERT_EQ(ValueType::kInvalid, row.GetChild(PrimitiveValue("b"))->value_type());
+  ASSERT_EQ(ValueType::kInvalid, row.GetChild(PrimitiveValue("c"))->value_type());
+}
+
 TEST_F(DocDBTest, TestCompactionForCollectionsWithTTL) {
   DocKey collection_key(PrimitiveValues("collection"));
   SetUpCollectionWithTTL(collection_key, UseIntermediateFlushes::kFalse);
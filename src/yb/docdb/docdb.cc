@@ -34,6 +34,7 @@
 #include "yb/docdb/docdb_util.h"
 #include "yb/docdb/intent.h"
 #include "yb/docdb/intent_aware_iterator.h"
+#include "yb/docdb/packed_row.h"
 #include "yb/docdb/pgsql_operation.h"
 #include "yb/docdb/shared_lock_manager.h"
 #include "yb/docdb/subdocument.h"
@@ -722,6 +723,43 @@ void SeekToLowerBound(const SliceKeyBound& lower_bound, IntentAwareIterator* ite
   }
 }
 
+// Sets the remaining TTL and the write time of a primitive value written at write_time.
+void SetTtlAndWriteTime(
+    const GetSubDocumentData& data, const HybridTime& read_ht, const DocHybridTime& write_time,
+    const UserTimeMicros user_timestamp, PrimitiveValue* value) {
+  // TODO: the ttl_seconds in primitive value is currently only in use for CQL. At some
+  // point streamline by refactoring CQL to use the mutable Expiration in GetSubDocumentData.
+  if (data.exp.ttl == Value::kMaxTtl) {
+    value->SetTtl(-1);
+  } else {
+    int64_t time_since_write_seconds = (
+        server::HybridClock::GetPhysicalValueMicros(read_ht) -
+        server::HybridClock::GetPhysicalValueMicros(write_time.hybrid_time())) /
+        MonoTime::kMicrosecondsPerSecond;
+    int64_t ttl_seconds = std::max(static_cast<int64_t>(0),
+        data.exp.ttl.ToMilliseconds() /
+        MonoTime::kMillisecondsPerSecond - time_since_write_seconds);
+    value->SetTtl(ttl_seconds);
+  }
+  // Choose the user supplied timestamp if present.
+  value->SetWriteTime(
+      user_timestamp == Value::kInvalidUserTimestamp
+      ? write_time.hybrid_time().GetPhysicalValueMicros()
+      : user_timestamp);
+}
+
+// Decodes the columns of a packed row into an object, setting their TTL and write time.
+CHECKED_STATUS UnpackRowColumns(
+    const GetSubDocumentData& data, const HybridTime& read_ht, const DocHybridTime& write_time,
+    const Value& packed_row, SubDocument* result) {
+  *result = SubDocument();
+  RETURN_NOT_OK(UnpackRow(packed_row.primitive_value().GetPackedRow(), result));
+  for (auto& column : result->object_container()) {
+    SetTtlAndWriteTime(data, read_ht, write_time, packed_row.user_timestamp(), &column.second);
+  }
+  return Status::OK();
+}
+
 // This function does not assume that object init_markers are present. If no init marker is present,
 // or if a tombstone is found at some level, it still looks for subkeys inside it if they have
 // larger timestamps.
@@ -744,6 +782,8 @@ CHECKED_STATUS BuildSubDocument(
     int64* num_values_observed) {
   VLOG(3) << "BuildSubDocument data: " << data << " read_time: " << iter->read_time()
           << " low_ts: " << low_ts;
+  // Whether the columns of a packed row have been added to the result.
+  bool has_packed_row = false;
   while (iter->valid()) {
     if (data.deadline_info && data.deadline_info->CheckAndSetDeadlinePassed()) {
       return STATUS(Expired, "Deadline for query passed.");
@@ -808,6 +848,20 @@ CHECKED_STATUS BuildSubDocument(
         value_type = ValueType::kTombstone;
       }
 
+      if (value_type == ValueType::kPackedRow) {
+        // The packed row overwrites the columns written before it, while the columns written after
+        // it override its values below.
+        if (low_ts < write_time) {
+          low_ts = write_time;
+        }
+        RETURN_NOT_OK(UnpackRowColumns(
+            data, iter->read_time().read, write_time, doc_value, data.result));
+        has_packed_row = true;
+        VLOG(3) << "SeekPastSubKey: " << SubDocKey::DebugSliceToString(key);
+        iter->SeekPastSubKey(key);
+        continue;
+      }
+
       const bool is_collection = IsCollectionType(value_type);
       // We have found some key that matches our entire subdocument_key, i.e. we didn't skip ahead
       // to a lower level key (with optional object init markers).
@@ -817,6 +871,9 @@ CHECKED_STATUS BuildSubDocument(
         }
         if (is_collection) {
           *data.result = SubDocument(value_type);
+        } else {
+          // The result may hold the value of a packed row column, that is deleted by the tombstone.
+          *data.result = SubDocument(ValueType::kInvalid);
         }
 
         // If the subkey lower bound filters out the key we found, we want to skip to the lower
@@ -836,26 +893,8 @@ CHECKED_STATUS BuildSubDocument(
           return STATUS_FORMAT(Corruption,
               "Expected primitive value type, got $0", value_type);
         }
-        // TODO: the ttl_seconds in primitive value is currently only in use for CQL. At some
-        // point streamline by refactoring CQL to use the mutable Expiration in GetSubDocumentData.
-        if (data.exp.ttl == Value::kMaxTtl) {
-          doc_value.mutable_primitive_value()->SetTtl(-1);
-        } else {
-          int64_t time_since_write_seconds = (
-              server::HybridClock::GetPhysicalValueMicros(iter->read_time().read) -
-              server::HybridClock::GetPhysicalValueMicros(write_time.hybrid_time())) /
-              MonoTime::kMicrosecondsPerSecond;
-          int64_t ttl_seconds = std::max(static_cast<int64_t>(0),
-              data.exp.ttl.ToMilliseconds() /
-              MonoTime::kMillisecondsPerSecond - time_since_write_seconds);
-          doc_value.mutable_primitive_value()->SetTtl(ttl_seconds);
-        }
-        // Choose the user supplied timestamp if present.
-        const UserTimeMicros user_timestamp = doc_value.user_timestamp();
-        doc_value.mutable_primitive_value()->SetWriteTime(
-            user_timestamp == Value::kInvalidUserTimestamp
-            ? write_time.hybrid_time().GetPhysicalValueMicros()
-            : doc_value.user_timestamp());
+        SetTtlAndWriteTime(data, iter->read_time().read, write_time, doc_value.user_timestamp(),
+                           doc_value.mutable_primitive_value());
         if (!data.high_index->CanInclude(current_values_observed)) {
           iter->SeekOutOfSubDoc(&key_copy);
           return Status::OK();
@@ -869,7 +908,30 @@ CHECKED_STATUS BuildSubDocument(
         return Status::OK();
       }
     }
+    if (!data.low_subkey->CanInclude(key)) {
+      VLOG(3) << "Filtered by low_subkey: " << data.low_subkey->ToString()
+              << ", key: " << SubDocKey::DebugSliceToString(key);
+      // The value provided is lower than what we are looking for, seek to the lower bound. This is
+      // done before building the descendant, so that the values skipped are not counted towards
+      // the index bounds.
+      SeekToLowerBound(*data.low_subkey, iter);
+      continue;
+    }
+
     SubDocument descendant{PrimitiveValue(ValueType::kInvalid)};
+    if (has_packed_row) {
+      // A column of the packed row written again after it. Start from the packed value, which is
+      // kept unless overridden.
+      Slice subkey_slice = key;
+      subkey_slice.remove_prefix(data.subdocument_key.size());
+      PrimitiveValue subkey;
+      RETURN_NOT_OK(subkey.DecodeFromKey(&subkey_slice));
+      SubDocument* packed_column = subkey_slice.empty() ? data.result->GetChild(subkey) : nullptr;
+      if (packed_column != nullptr) {
+        descendant = std::move(*packed_column);
+        data.result->DeleteChild(subkey);
+      }
+    }
     // TODO: what if the key we found is the same as before?
     //       We'll get into an infinite recursion then.
     {
@@ -884,14 +946,6 @@ CHECKED_STATUS BuildSubDocument(
       continue;
     }
 
-    if (!data.low_subkey->CanInclude(key)) {
-      VLOG(3) << "Filtered by low_subkey: " << data.low_subkey->ToString()
-              << ", key: " << SubDocKey::DebugSliceToString(key);
-      // The value provided is lower than what we are looking for, seek to the lower bound.
-      SeekToLowerBound(*data.low_subkey, iter);
-      continue;
-    }
-
     // We use num_values_observed as a conservative figure for lower bound and
     // current_values_observed for upper bound so we don't lose any data we should be including.
     if (!data.low_index->CanInclude(*num_values_observed)) {
@@ -1126,6 +1180,21 @@ yb::Status GetSubDocument(
     }
     return Status::OK();
   }
+  // The columns of a packed row written at the DocKey, used for the projected columns that are not
+  // written again after it.
+  SubDocument packed_row(ValueType::kInvalid);
+  if (value_type == ValueType::kPackedRow && data.subdocument_key.size() == dockey_size &&
+      !data.exp.ttl.IsNegative()) {
+    const HybridTime write_ht = data.exp.write_ht == HybridTime::kMin
+        ? max_overwrite_ht.hybrid_time() : data.exp.write_ht;
+    bool has_expired;
+    RETURN_NOT_OK(HasExpiredTTL(write_ht, data.exp.ttl, db_iter->read_time().read, &has_expired));
+    if (!has_expired) {
+      RETURN_NOT_OK(UnpackRowColumns(
+          data, db_iter->read_time().read, max_overwrite_ht, doc_value, &packed_row));
+    }
+  }
+
   // Seed key_bytes with the subdocument key. For each subkey in the projection, build subdocument
   // and reuse key_bytes while appending the subkey.
   *data.result = SubDocument();
@@ -1144,6 +1213,10 @@ yb::Status GetSubDocument(
     IntentAwareIteratorPrefixScope prefix_scope(key_bytes, db_iter);
     db_iter->SeekForward(&key_bytes);
     SubDocument descendant(ValueType::kInvalid);
+    SubDocument* packed_column = packed_row.GetChild(subkey);
+    if (packed_column != nullptr) {
+      descendant = std::move(*packed_column);
+    }
     int64 num_values_observed = 0;
     RETURN_NOT_OK(BuildSubDocument(
         db_iter, data.Adjusted(key_bytes, &descendant), max_overwrite_ht,
@@ -15,18 +15,25 @@
 
 #include <memory>
 
+#include <gflags/gflags.h>
 #include <glog/logging.h>
 
 #include "yb/rocksdb/compaction_filter.h"
+#include "yb/rocksdb/db/version_edit.h"
 #include "yb/util/string_util.h"
 
 #include "yb/docdb/doc_key.h"
 #include "yb/docdb/doc_ttl_util.h"
 #include "yb/docdb/docdb-internal.h"
+#include "yb/docdb/packed_row.h"
 #include "yb/docdb/value.h"
 #include "yb/docdb/consensus_frontier.h"
 #include "yb/rocksutil/yb_rocksdb.h"
 
+DEFINE_bool(delete_expired_sst_files, true,
+            "Delete the oldest SST files of a tablet once all their records have expired, instead "
+            "of rewriting them in a compaction.");
+
 using std::shared_ptr;
 using std::unique_ptr;
 using std::unordered_set;
@@ -37,6 +44,11 @@ using rocksdb::FilterDecision;
 namespace yb {
 namespace docdb {
 
+Status GetDocHybridTime(const rocksdb::UserBoundaryValues& values, DocHybridTime* out);
+bool HasExpired(const rocksdb::UserBoundaryValues& largest, HybridTime history_cutoff,
+                MonoDelta table_ttl);
+bool HasTtlMergeRecords(const rocksdb::UserBoundaryValues& largest);
+
 // ------------------------------------------------------------------------------------------------
 
 DocDBCompactionFilter::DocDBCompactionFilter(
@@ -282,6 +294,17 @@ Result<FilterDecision> DocDBCompactionFilter::DoFilter(
     // We are reusing the existing encoded value without decoding/encoding it.
     value.EncodeAndAppend(new_value, &value_slice);
     within_merge_block_ = false;
+  } else if (value_type == ValueType::kPackedRow && !retention_.deleted_cols->empty()) {
+    // The columns deleted from the schema are removed from packed rows as well.
+    Value value;
+    RETURN_NOT_OK(value.Decode(existing_value));
+    std::string packed_row;
+    if (VERIFY_RESULT(RemoveColumnsFromPackedRow(
+            value.primitive_value().GetPackedRow(), *retention_.deleted_cols, &packed_row))) {
+      *value_changed = true;
+      *new_value = Value(PrimitiveValue::PackedRow(std::move(packed_row)), value.ttl(),
+                         value.user_timestamp()).Encode();
+    }
   }
 
   // Tombstones at or below the history cutoff hybrid_time can always be cleaned up on full (major)
@@ -324,10 +347,75 @@ unique_ptr<CompactionFilter> DocDBCompactionFilterFactory::CreateCompactionFilte
     const CompactionFilter::Context& context) {
   return std::make_unique<DocDBCompactionFilter>(
       retention_policy_->GetRetentionDirective(),
-      IsMajorCompaction(context.is_full_compaction),
+      // No older data is left for a delete marker or an expired value to hide once a compaction
+      // outputs to the bottommost level, as level compactions do without including every file.
+      IsMajorCompaction(context.is_full_compaction || context.is_bottommost_level),
       key_bounds_);
 }
 
+std::string DocDBCompactionFilterFactory::SubcompactionBoundary(const Slice& user_key) {
+  // The encoding of a DocKey is not a prefix of the encoding of any other DocKey, so all the keys
+  // of a document sort between its DocKey and the next one.
+  auto doc_key_size = DocKey::EncodedSize(user_key, DocKeyPart::WHOLE_DOC_KEY);
+  if (!doc_key_size.ok()) {
+    VLOG(3) << "Not splitting compaction at " << user_key.ToDebugHexString() << ": "
+            << doc_key_size.status();
+    return std::string();
+  }
+  return Slice(user_key.data(), *doc_key_size).ToBuffer();
+}
+
+size_t DocDBCompactionFilterFactory::NumExpiredFiles(
+    const std::vector<rocksdb::FileMetaData*>& files) {
+  if (!FLAGS_delete_expired_sst_files || files.empty()) {
+    return 0;
+  }
+  // Records changing the TTL of older records may extend the life of records in older files.
+  for (const auto* file : files) {
+    if (HasTtlMergeRecords(file->largest.user_values)) {
+      return 0;
+    }
+  }
+
+  // An expired record hides the older versions of its key, so a file is only deleted along with
+  // all the files older than it.
+  const HistoryRetentionDirective retention = retention_policy_->GetRetentionDirective();
+  std::vector<DocHybridTime> max_expired_ht;
+  for (auto it = files.rbegin(); it != files.rend(); ++it) {
+    DocHybridTime largest_ht;
+    if (!HasExpired((*it)->largest.user_values, retention.history_cutoff, retention.table_ttl) ||
+        !GetDocHybridTime((*it)->largest.user_values, &largest_ht).ok()) {
+      break;
+    }
+    max_expired_ht.push_back(
+        max_expired_ht.empty() ? largest_ht : std::max(max_expired_ht.back(), largest_ht));
+  }
+
+  // Files are ordered by the time they were written to RocksDB, which may differ from the hybrid
+  // time of their records, e.g. for intents applied after later writes were flushed. The deleted
+  // records must also be older than the records of the files kept, or deleting them could expose
+  // older versions of their keys.
+  size_t num_expired = max_expired_ht.size();
+  DocHybridTime min_kept_ht = DocHybridTime::kMax;
+  for (size_t i = 0; i + num_expired < files.size(); ++i) {
+    DocHybridTime smallest_ht;
+    if (!GetDocHybridTime(files[i]->smallest.user_values, &smallest_ht).ok()) {
+      return 0;
+    }
+    min_kept_ht = std::min(min_kept_ht, smallest_ht);
+  }
+  while (num_expired > 0 && !(max_expired_ht[num_expired - 1] < min_kept_ht)) {
+    --num_expired;
+    DocHybridTime smallest_ht;
+    if (!GetDocHybridTime(files[files.size() - num_expired - 1]->smallest.user_values,
+                          &smallest_ht).ok()) {
+      return 0;
+    }
+    min_kept_ht = std::min(min_kept_ht, smallest_ht);
+  }
+  return num_expired;
+}
+
 const char* DocDBCompactionFilterFactory::Name() const {
   return "DocDBCompactionFilterFactory";
 }
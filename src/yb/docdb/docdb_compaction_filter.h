@@ -160,6 +160,15 @@ class DocDBCompactionFilterFactory : public rocksdb::CompactionFilterFactory {
   ~DocDBCompactionFilterFactory() override;
   std::unique_ptr<rocksdb::CompactionFilter> CreateCompactionFilter(
       const rocksdb::CompactionFilter::Context& context) override;
+
+  // Counts the oldest files whose records have all expired by the history cutoff, using the
+  // expirations recorded in their boundary values.
+  size_t NumExpiredFiles(const std::vector<rocksdb::FileMetaData*>& files) override;
+
+  // Moves the boundary to the start of the document of the key, since the filter tracks overwrites
+  // within a document.
+  std::string SubcompactionBoundary(const Slice& user_key) override;
+
   const char* Name() const override;
 
  private:
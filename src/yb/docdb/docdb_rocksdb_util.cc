@@ -63,6 +63,20 @@ DEFINE_uint64(rocksdb_compaction_size_threshold_bytes, 2ULL * 1024 * 1024 * 1024
              "Threshold beyond which compaction is considered large.");
 DEFINE_uint64(rocksdb_max_file_size_for_compaction, 0,
              "Maximal allowed file size to participate in RocksDB compaction. 0 - unlimited.");
+DEFINE_int32(rocksdb_max_subcompactions, 1,
+             "Maximal number of threads a single compaction is split into by key range. "
+             "1 - compactions are not split.");
+DEFINE_uint64(rocksdb_min_subcompaction_size, 1_GB,
+             "Minimal approximate input size of each part of a compaction split by key range.");
+DEFINE_int32(rocksdb_level_compaction_num_levels, 5,
+             "Number of levels of the tablets of tables using level compaction. Must not be "
+             "decreased once the last levels have files.");
+DEFINE_uint64(rocksdb_level_compaction_max_bytes_for_level_base, 256_MB,
+             "Target size of the smallest non-empty level below level 0 of the tablets of tables "
+             "using level compaction.");
+DEFINE_uint64(rocksdb_level_compaction_target_file_size, 64_MB,
+             "Target size of the files written by compactions of the tablets of tables using level "
+             "compaction.");
 DEFINE_int32(rocksdb_max_write_buffer_number, 2,
              "Maximum number of write buffers that are built up in memory.");
 
@@ -86,10 +100,21 @@ DEFINE_int32(memstore_size_mb, 128,
 
 DEFINE_bool(use_docdb_aware_bloom_filter, true,
             "Whether to use the DocDbAwareFilterPolicy for both bloom storage and seeks.");
+DEFINE_int32(docdb_bloom_filter_range_components, 1,
+             "Number of leading range components of the keys of range sharded tables that the "
+             "bloom filter is built on. Reads use the filter when they are restricted to keys "
+             "with the same leading range components, or to a single row of a table with fewer "
+             "range components. 0 to not use a bloom filter for range sharded tables.");
 DEFINE_int32(max_nexts_to_avoid_seek, 1,
              "The number of next calls to try before doing resorting to do a rocksdb seek.");
 DEFINE_bool(trace_docdb_calls, false, "Whether we should trace calls into the docdb.");
 DEFINE_bool(use_multi_level_index, true, "Whether to use multi-level data index.");
+DEFINE_bool(db_cache_index_and_filter_blocks_with_high_priority, true,
+            "Whether to put index and filter blocks into the high priority pool of the block "
+            "cache, so that data blocks read by scans do not evict them.");
+DEFINE_bool(db_pin_top_level_index_in_block_cache, true,
+            "Whether SST file readers hold the top level of the multi-level data index in the "
+            "block cache, so that it is never evicted.");
 
 DEFINE_uint64(initial_seqno, 1ULL << 50, "Initial seqno for new RocksDB instances.");
 
@@ -208,8 +233,14 @@ rocksdb::ReadOptions PrepareReadOptions(
   if (FLAGS_use_docdb_aware_bloom_filter &&
     bloom_filter_mode == BloomFilterMode::USE_BLOOM_FILTER) {
     DCHECK(user_key_for_filter);
-    read_opts.table_aware_file_filter = rocksdb->GetOptions().table_factory->
-        NewTableAwareReadFileFilter(read_opts, user_key_for_filter.get());
+    // Keys starting with user_key_for_filter could have other filter keys when it ends within
+    // the range components used by the filter.
+    auto filter_key_size = FilterKeySize(
+        user_key_for_filter.get(), BloomFilterRangeComponents());
+    if (filter_key_size.ok() && *filter_key_size) {
+      read_opts.table_aware_file_filter = rocksdb->GetOptions().table_factory->
+          NewTableAwareReadFileFilter(read_opts, user_key_for_filter.get());
+    }
   }
   read_opts.file_filter = std::move(file_filter);
   read_opts.iterate_upper_bound = iterate_upper_bound;
@@ -351,6 +382,12 @@ void InitRocksDBOptions(
     table_options.block_cache = tablet_options.block_cache;
     // Cache the bloom filters in the block cache.
     table_options.cache_index_and_filter_blocks = true;
+    table_options.cache_index_and_filter_blocks_with_high_priority =
+        FLAGS_db_cache_index_and_filter_blocks_with_high_priority;
+    // The top level of the multi-level index is bounded by the index block size, while a single
+    // level index grows with the file.
+    table_options.pin_top_level_index_in_cache =
+        FLAGS_use_multi_level_index && FLAGS_db_pin_top_level_index_in_block_cache;
   } else {
     table_options.no_block_cache = true;
     table_options.cache_index_and_filter_blocks = false;
@@ -401,6 +438,8 @@ void InitRocksDBOptions(
     options->compaction_options_universal.min_merge_width =
         FLAGS_rocksdb_universal_compaction_min_merge_width;
     options->compaction_size_threshold_bytes = FLAGS_rocksdb_compaction_size_threshold_bytes;
+    options->max_subcompactions = std::max(FLAGS_rocksdb_max_subcompactions, 1);
+    options->min_subcompaction_size = FLAGS_rocksdb_min_subcompaction_size;
     if (FLAGS_rocksdb_compact_flush_rate_limit_bytes_per_sec > 0) {
       options->rate_limiter.reset(
           rocksdb::NewGenericRateLimiter(FLAGS_rocksdb_compact_flush_rate_limit_bytes_per_sec));
@@ -421,6 +460,39 @@ void InitRocksDBOptions(
       0 /* lookahead */, rocksdb::ConcurrentWrites::kFalse);
 }
 
+void SetLevelCompactionOptions(rocksdb::Options* options) {
+  if (options->compaction_style != rocksdb::CompactionStyle::kCompactionStyleUniversal) {
+    return;
+  }
+  options->compaction_style = rocksdb::CompactionStyle::kCompactionStyleLevel;
+  options->num_levels = FLAGS_rocksdb_level_compaction_num_levels;
+  // Size the levels from the last one, so that it holds most of the data and the space
+  // amplification stays close to 1.1 whatever the size of the tablet.
+  options->level_compaction_dynamic_level_bytes = true;
+  options->max_bytes_for_level_base = FLAGS_rocksdb_level_compaction_max_bytes_for_level_base;
+  options->target_file_size_base = FLAGS_rocksdb_level_compaction_target_file_size;
+  // Keep the output files small enough to take part in later compactions.
+  options->target_file_size_base = std::min(
+      options->target_file_size_base, options->max_file_size_for_compaction);
+}
+
+size_t BloomFilterRangeComponents() {
+  return std::max(FLAGS_docdb_bloom_filter_range_components, 0);
+}
+
+void SetRangeShardedBloomFilter(rocksdb::Options* options) {
+  auto num_range_components = BloomFilterRangeComponents();
+  if (!FLAGS_use_docdb_aware_bloom_filter || num_range_components == 0) {
+    return;
+  }
+  auto table_options = *static_cast<rocksdb::BlockBasedTableOptions*>(
+      options->table_factory->GetOptions());
+  table_options.filter_policy = std::make_shared<DocDbAwareFilterPolicy>(
+      table_options.filter_block_size * 8, options->info_log.get(), num_range_components);
+  // The table factory is shared with the options this one was copied from.
+  options->table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+}
+
 void SetLogPrefix(rocksdb::Options* options, const std::string& log_prefix) {
   options->log_prefix = log_prefix;
   options->info_log = std::make_shared<YBRocksDBLogger>(options->log_prefix);
@@ -110,6 +110,22 @@ void InitRocksDBOptions(
     const std::shared_ptr<rocksdb::Statistics>& statistics,
     const tablet::TabletOptions& tablet_options);
 
+// Switches the universal compaction set up by InitRocksDBOptions to level compaction. Does nothing
+// if compactions are disabled. DocDBCompactionFilter only drops delete markers and expired values
+// when all the files are compacted, which only happens for level compaction when a full manual
+// compaction reaches the last level.
+void SetLevelCompactionOptions(rocksdb::Options* options);
+
+// Returns the number of leading range components the bloom filter of range sharded tables is built
+// on. Reads rely on it being the number used by the DBs opened with SetRangeShardedBloomFilter, so
+// it does not change while the process runs.
+size_t BloomFilterRangeComponents();
+
+// Switches the bloom filter set up by InitRocksDBOptions to one that also takes into account the
+// first BloomFilterRangeComponents() range components of keys without hashed components. Keys
+// with hashed components are filtered the same way by both filters.
+void SetRangeShardedBloomFilter(rocksdb::Options* options);
+
 // Sets logs prefix for RocksDB options. This will also reinitialize options->info_log.
 void SetLogPrefix(rocksdb::Options* options, const std::string& log_prefix);
 
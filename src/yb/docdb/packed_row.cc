@@ -0,0 +1,98 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/packed_row.h"
+
+#include "yb/docdb/subdocument.h"
+
+#include "yb/util/fast_varint.h"
+
+namespace yb {
+namespace docdb {
+
+namespace {
+
+// Decodes the next column of a packed row, positioned after the schema version.
+CHECKED_STATUS DecodeNextColumn(Slice* input, PrimitiveValue* subkey, Slice* value) {
+  RETURN_NOT_OK(subkey->DecodeFromKey(input));
+  const auto value_size = VERIFY_RESULT(util::FastDecodeUnsignedVarInt(input));
+  if (value_size > input->size()) {
+    return STATUS_FORMAT(Corruption, "Packed row value of $0 bytes past the end of the row: $1",
+                         value_size, input->ToDebugHexString());
+  }
+  *value = Slice(input->data(), value_size);
+  input->remove_prefix(value_size);
+  return Status::OK();
+}
+
+} // namespace
+
+RowPacker::RowPacker(uint32_t schema_version) {
+  util::FastAppendUnsignedVarIntToStr(schema_version, &buffer_);
+}
+
+void RowPacker::AddColumn(const PrimitiveValue& subkey, const PrimitiveValue& value) {
+  subkey_buffer_.Clear();
+  subkey.AppendToKey(&subkey_buffer_);
+  buffer_.append(subkey_buffer_.data());
+  const std::string encoded_value = value.ToValue();
+  util::FastAppendUnsignedVarIntToStr(encoded_value.size(), &buffer_);
+  buffer_.append(encoded_value);
+}
+
+PrimitiveValue RowPacker::Complete() {
+  return PrimitiveValue::PackedRow(std::move(buffer_));
+}
+
+Result<uint32_t> PackedRowSchemaVersion(Slice packed_row) {
+  return static_cast<uint32_t>(VERIFY_RESULT(util::FastDecodeUnsignedVarInt(&packed_row)));
+}
+
+Status UnpackRow(Slice packed_row, SubDocument* row) {
+  RETURN_NOT_OK(util::FastDecodeUnsignedVarInt(&packed_row));
+  PrimitiveValue subkey;
+  Slice value;
+  while (!packed_row.empty()) {
+    RETURN_NOT_OK(DecodeNextColumn(&packed_row, &subkey, &value));
+    PrimitiveValue column_value;
+    RETURN_NOT_OK(column_value.DecodeFromValue(value));
+    row->SetChildPrimitive(subkey, std::move(column_value));
+  }
+  return Status::OK();
+}
+
+Result<bool> RemoveColumnsFromPackedRow(
+    Slice packed_row, const ColumnIds& columns, std::string* out) {
+  const char* const begin = packed_row.cdata();
+  RETURN_NOT_OK(util::FastDecodeUnsignedVarInt(&packed_row));
+  std::string result(begin, packed_row.cdata());
+  bool removed = false;
+  PrimitiveValue subkey;
+  Slice value;
+  while (!packed_row.empty()) {
+    const char* const column_begin = packed_row.cdata();
+    RETURN_NOT_OK(DecodeNextColumn(&packed_row, &subkey, &value));
+    if (subkey.value_type() == ValueType::kColumnId && columns.count(subkey.GetColumnId())) {
+      removed = true;
+      continue;
+    }
+    result.append(column_begin, packed_row.cdata());
+  }
+  if (removed) {
+    *out = std::move(result);
+  }
+  return removed;
+}
+
+}  // namespace docdb
+}  // namespace yb
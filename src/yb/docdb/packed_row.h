@@ -0,0 +1,68 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+// A packed row stores all the columns of a row version as a single value at the DocKey of the row,
+// instead of one key-value per column. It is encoded as:
+//
+//   <schema version (varint)> { <column subkey (key encoding)> <value size (varint)> <value> }*
+//
+// Null columns are not stored. Since the packed row is written at the DocKey, it overwrites all the
+// columns of the row written before it, while columns written after it override its values.
+
+#ifndef YB_DOCDB_PACKED_ROW_H_
+#define YB_DOCDB_PACKED_ROW_H_
+
+#include <string>
+
+#include "yb/common/schema.h"
+
+#include "yb/docdb/primitive_value.h"
+
+#include "yb/util/result.h"
+#include "yb/util/slice.h"
+
+namespace yb {
+namespace docdb {
+
+class SubDocument;
+
+class RowPacker {
+ public:
+  explicit RowPacker(uint32_t schema_version);
+
+  // Adds a column to the row. Columns must be added at most once each.
+  void AddColumn(const PrimitiveValue& subkey, const PrimitiveValue& value);
+
+  // Returns the packed row value. The packer must not be used afterwards.
+  PrimitiveValue Complete();
+
+ private:
+  std::string buffer_;
+  KeyBytes subkey_buffer_;
+};
+
+// Returns the schema version the row was packed with.
+Result<uint32_t> PackedRowSchemaVersion(Slice packed_row);
+
+// Decodes the columns of the packed row as children of row, which must be an object.
+CHECKED_STATUS UnpackRow(Slice packed_row, SubDocument* row);
+
+// Removes the given columns from the packed row, storing the result in out. Returns false and
+// leaves out untouched if none of the columns is in the row.
+Result<bool> RemoveColumnsFromPackedRow(
+    Slice packed_row, const ColumnIds& columns, std::string* out);
+
+}  // namespace docdb
+}  // namespace yb
+
+#endif  // YB_DOCDB_PACKED_ROW_H_
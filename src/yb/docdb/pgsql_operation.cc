@@ -23,14 +23,29 @@
 #include "yb/docdb/doc_rowwise_iterator.h"
 #include "yb/docdb/primitive_value_util.h"
 
+#include "yb/util/size_literals.h"
 #include "yb/util/trace.h"
 
+using namespace yb::size_literals;
+
 DECLARE_bool(trace_docdb_calls);
 DECLARE_int64(retryable_rpc_single_call_timeout_ms);
 
 DEFINE_double(ysql_scan_timeout_multiplier, 0.5,
               "YSQL read scan timeout multipler of retryable_rpc_single_call_timeout_ms.");
 
+DEFINE_int32(ysql_max_aggregate_groups_per_read, 10000,
+             "Maximum number of groups of a YSQL GROUP BY aggregate that are kept in memory by "
+             "one read. The read returns the groups and a paging state once this limit is "
+             "reached.");
+
+// The groups of one read are returned in one response, so this limit should be well below
+// rpc_max_message_size. Otherwise the response would be rejected by the RPC layer.
+DEFINE_int32(ysql_max_aggregate_group_bytes_per_read, 4_MB,
+             "Maximum total size of the group-by values of the groups of a YSQL GROUP BY "
+             "aggregate that are kept in memory and returned by one read. The read returns the "
+             "groups and a paging state once this limit is reached.");
+
 namespace yb {
 namespace docdb {
 
@@ -395,6 +410,10 @@ Status PgsqlReadOperation::Execute(const common::YQLStorageIf& ql_storage,
   RETURN_NOT_OK(ql_storage.GetIterator(request_, projection, schema, txn_op_context_,
                                        deadline, read_time, &table_iter_));
 
+  if (request_.batch_ybctids_size() > 0) {
+    return ExecuteBatchYbctids(projection, resultset, restart_read_ht);
+  }
+
   ColumnId ybbasectid_id;
   if (request_.has_index_request()) {
     const PgsqlReadRequestPB& index_request = request_.index_request();
@@ -420,12 +439,16 @@ Status PgsqlReadOperation::Execute(const common::YQLStorageIf& ql_storage,
   const MonoTime start_time = MonoTime::Now();
 
   // Fetching data.
+  const bool is_grouped_aggregate = request_.is_aggregate() && request_.group_by_exprs_size() > 0;
+  bool aggr_groups_exceeded = false;
   int match_count = 0;
+  size_t scanned_count = 0;
   QLTableRow::SharedPtr row = std::make_shared<QLTableRow>();
   while (resultset->rsrow_count() < row_count_limit && VERIFY_RESULT(iter->HasNext()) &&
-         !scan_time_exceeded) {
+         !scan_time_exceeded && !aggr_groups_exceeded) {
 
     row->Clear();
+    scanned_count++;
 
     // If there is an index request, fetch ybbasectid from the index and use it as ybctid
     // to fetch from the base table. Otherwise, fetch from the base table directly.
@@ -444,46 +467,98 @@ Status PgsqlReadOperation::Execute(const common::YQLStorageIf& ql_storage,
       RETURN_NOT_OK(iter->NextRow(projection, row.get()));
     }
 
-    // Match the row with the where condition before adding to the row block.
+    // Match the row with the where condition before adding to the row block. The condition is
+    // pushed down by pggate as a pre-filter: a NULL result drops the row, and postgres rechecks
+    // the rows that are returned.
     bool is_match = true;
     if (request_.has_where_expr()) {
       QLValue match;
       RETURN_NOT_OK(EvalExpr(request_.where_expr(), row, &match));
-      is_match = match.bool_value();
+      is_match = !match.IsNull() && match.bool_value();
     }
     if (is_match) {
       match_count++;
-      if (request_.is_aggregate()) {
+      if (is_grouped_aggregate) {
+        RETURN_NOT_OK(EvalGroupedAggregate(row));
+        // Each row adds at most one group, so stopping at the limits bounds the groups in memory
+        // and the size of the response.
+        // The remaining rows are aggregated by the next read from the paging state.
+        aggr_groups_exceeded =
+            aggr_groups_.size() >= static_cast<size_t>(FLAGS_ysql_max_aggregate_groups_per_read) ||
+            aggr_groups_bytes_ >=
+                static_cast<size_t>(FLAGS_ysql_max_aggregate_group_bytes_per_read);
+      } else if (request_.is_aggregate()) {
         RETURN_NOT_OK(EvalAggregate(row));
       } else {
         RETURN_NOT_OK(PopulateResultSet(row, resultset));
       }
     }
 
-    // Check every row_count_limit matches whether we've exceeded our scan time.
-    if (match_count % row_count_limit == 0) {
+    // Check every row_count_limit scanned rows whether we've exceeded our scan time. Scanned rather
+    // than matched rows are counted so that a selective where condition cannot hold the scan.
+    if (scanned_count % row_count_limit == 0) {
       const MonoDelta elapsed_time = MonoTime::Now().GetDeltaSince(start_time);
       scan_time_exceeded = elapsed_time.ToMilliseconds() > scan_time_limit;
     }
   }
 
-  if (request_.is_aggregate() && match_count > 0) {
+  if (is_grouped_aggregate) {
+    RETURN_NOT_OK(PopulateGroupedAggregate(resultset));
+  } else if (request_.is_aggregate() && match_count > 0) {
     RETURN_NOT_OK(PopulateAggregate(row, resultset));
   }
 
   if (FLAGS_trace_docdb_calls) {
-    TRACE("Fetched $0 rows.", resultset->rsrow_count());
+    TRACE("Fetched $0 rows, $1 of $2 scanned rows matched.",
+          resultset->rsrow_count(), match_count, scanned_count);
   }
   *restart_read_ht = iter->RestartReadHt();
 
-  return SetPagingStateIfNecessary(iter, resultset, row_count_limit, scan_time_exceeded);
+  return SetPagingStateIfNecessary(iter, resultset, row_count_limit,
+                                   scan_time_exceeded || aggr_groups_exceeded);
+}
+
+Status PgsqlReadOperation::ExecuteBatchYbctids(const Schema& projection,
+                                               PgsqlResultSet *resultset,
+                                               HybridTime *restart_read_ht) {
+  // Seek each requested row instead of scanning the tablet. The ybctids are sorted by pggate, so
+  // the iterator moves forward through the tablet.
+  size_t found_count = 0;
+  QLTableRow::SharedPtr row = std::make_shared<QLTableRow>();
+  for (const string& ybctid : request_.batch_ybctids()) {
+    if (!VERIFY_RESULT(table_iter_->SeekTuple(ybctid))) {
+      continue;
+    }
+    found_count++;
+
+    row->Clear();
+    RETURN_NOT_OK(table_iter_->NextRow(projection, row.get()));
+
+    bool is_match = true;
+    if (request_.has_where_expr()) {
+      QLValue match;
+      RETURN_NOT_OK(EvalExpr(request_.where_expr(), row, &match));
+      is_match = !match.IsNull() && match.bool_value();
+    }
+    if (is_match) {
+      RETURN_NOT_OK(PopulateResultSet(row, resultset));
+    }
+  }
+
+  if (FLAGS_trace_docdb_calls) {
+    TRACE("Fetched $0 rows, $1 of $2 requested rows found.",
+          resultset->rsrow_count(), found_count, request_.batch_ybctids_size());
+  }
+  *restart_read_ht = table_iter_->RestartReadHt();
+
+  return Status::OK();
 }
 
 Status PgsqlReadOperation::SetPagingStateIfNecessary(const common::YQLRowwiseIteratorIf* iter,
                                                      const PgsqlResultSet* resultset,
                                                      const size_t row_count_limit,
-                                                     const bool scan_time_exceeded) {
-  if (resultset->rsrow_count() >= row_count_limit || scan_time_exceeded) {
+                                                     const bool scan_stopped) {
+  if (resultset->rsrow_count() >= row_count_limit || scan_stopped) {
     SubDocKey next_row_key;
     RETURN_NOT_OK(iter->GetNextReadSubDocKey(&next_row_key));
     // When the "limit" number of rows are returned and we are asked to return the paging state,
@@ -548,6 +623,55 @@ Status PgsqlReadOperation::PopulateAggregate(const QLTableRow::SharedPtr& table_
   return Status::OK();
 }
 
+Status PgsqlReadOperation::EvalGroupedAggregate(const QLTableRow::SharedPtr& table_row) {
+  // Find the group of the row by the key-encoded values of its group-by columns.
+  std::vector<QLValue> group_values(request_.group_by_exprs_size());
+  KeyBytes group_key;
+  for (int i = 0; i < request_.group_by_exprs_size(); i++) {
+    RETURN_NOT_OK(EvalExpr(request_.group_by_exprs(i), table_row, &group_values[i]));
+    if (group_values[i].IsNull()) {
+      PrimitiveValue(ValueType::kNullLow).AppendToKey(&group_key);
+    } else {
+      PrimitiveValue::FromQLValuePB(group_values[i].value(),
+                                    ColumnSchema::SortingType::kNotSpecified)
+          .AppendToKey(&group_key);
+    }
+  }
+
+  AggregateGroup& group = aggr_groups_[group_key.data()];
+  if (group.aggr_values.empty()) {
+    // The group-by values are returned in about the size of their key encoding.
+    aggr_groups_bytes_ += group_key.size();
+    group.group_values = std::move(group_values);
+    group.aggr_values.resize(request_.targets().size());
+  }
+
+  int aggr_index = 0;
+  for (const PgsqlExpressionPB& expr : request_.targets()) {
+    RETURN_NOT_OK(EvalExpr(expr, table_row, &group.aggr_values[aggr_index]));
+    aggr_index++;
+  }
+  return Status::OK();
+}
+
+Status PgsqlReadOperation::PopulateGroupedAggregate(PgsqlResultSet *resultset) {
+  const int column_count = request_.targets().size() + request_.group_by_exprs_size();
+  for (auto& entry : aggr_groups_) {
+    AggregateGroup& group = entry.second;
+    PgsqlRSRow *rsrow = resultset->AllocateRSRow(column_count);
+    int rscol_index = 0;
+    for (QLValue& value : group.aggr_values) {
+      *rsrow->rscol(rscol_index++) = std::move(value);
+    }
+    for (QLValue& value : group.group_values) {
+      *rsrow->rscol(rscol_index++) = std::move(value);
+    }
+  }
+  aggr_groups_.clear();
+  aggr_groups_bytes_ = 0;
+  return Status::OK();
+}
+
 Status PgsqlReadOperation::GetIntents(const Schema& schema, KeyValueWriteBatchPB* out) {
   auto pair = out->mutable_read_pairs()->Add();
 
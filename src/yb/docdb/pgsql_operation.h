@@ -129,17 +129,28 @@ class PgsqlReadOperation : public DocExprExecutor {
   CHECKED_STATUS PopulateResultSet(const QLTableRow::SharedPtr& table_row,
                                    PgsqlResultSet *result_set);
 
+  // Read the rows of a batched key lookup, in the order of their ybctids in the request.
+  CHECKED_STATUS ExecuteBatchYbctids(const Schema& projection,
+                                     PgsqlResultSet *result_set,
+                                     HybridTime *restart_read_ht);
+
   CHECKED_STATUS EvalAggregate(const QLTableRow::SharedPtr& table_row);
 
   CHECKED_STATUS PopulateAggregate(const QLTableRow::SharedPtr& table_row,
                                    PgsqlResultSet *resultset);
 
+  // Aggregate the row into the partial aggregate values of its group for GROUP BY.
+  CHECKED_STATUS EvalGroupedAggregate(const QLTableRow::SharedPtr& table_row);
+
+  CHECKED_STATUS PopulateGroupedAggregate(PgsqlResultSet *resultset);
+
   // Checks whether we have processed enough rows for a page and sets the appropriate paging
-  // state in the response object.
+  // state in the response object. "scan_stopped" is set when the scan stopped early for another
+  // reason than the row count limit.
   CHECKED_STATUS SetPagingStateIfNecessary(const common::YQLRowwiseIteratorIf* iter,
                                            const PgsqlResultSet* resultset,
                                            const size_t row_count_limit,
-                                           const bool scan_time_exceeded);
+                                           const bool scan_stopped);
 
   //------------------------------------------------------------------------------------------------
   const PgsqlReadRequestPB& request_;
@@ -147,6 +158,17 @@ class PgsqlReadOperation : public DocExprExecutor {
   PgsqlResponsePB response_;
   common::YQLRowwiseIteratorIf::UniPtr table_iter_;
   common::YQLRowwiseIteratorIf::UniPtr index_iter_;
+
+  // Partial aggregate values of a GROUP BY aggregate, keyed by the encoded values of the group-by
+  // columns.
+  struct AggregateGroup {
+    std::vector<QLValue> group_values;
+    std::vector<QLValue> aggr_values;
+  };
+  std::unordered_map<std::string, AggregateGroup> aggr_groups_;
+
+  // Total size of the encoded group-by values of aggr_groups_.
+  size_t aggr_groups_bytes_ = 0;
 };
 
 }  // namespace docdb
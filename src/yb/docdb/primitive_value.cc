@@ -60,6 +60,7 @@ using yb::util::DecodeDoubleFromKey;
     case ValueType::kGroupEndDescending: FALLTHROUGH_INTENDED; \
     case ValueType::kInvalid: FALLTHROUGH_INTENDED; \
     case ValueType::kJsonb: FALLTHROUGH_INTENDED; \
+    case ValueType::kPackedRow: FALLTHROUGH_INTENDED; \
     case ValueType::kObject: FALLTHROUGH_INTENDED; \
     case ValueType::kObsoleteIntentPrefix: FALLTHROUGH_INTENDED; \
     case ValueType::kRedisList: FALLTHROUGH_INTENDED;            \
@@ -108,6 +109,10 @@ string PrimitiveValue::ToString() const {
       return "SSforward";
     case ValueType::kSSReverse:
       return "SSreverse";
+    case ValueType::kSSRankBlocks:
+      return "SSrankblocks";
+    case ValueType::kRedisTSChunks:
+      return "TSchunks";
     case ValueType::kFalse: FALLTHROUGH_INTENDED;
     case ValueType::kFalseDescending:
       return "false";
@@ -181,6 +186,8 @@ string PrimitiveValue::ToString() const {
       return inetaddress_val_->ToString();
     case ValueType::kJsonb:
       return FormatBytesAsStr(json_val_);
+    case ValueType::kPackedRow:
+      return Substitute("PackedRow($0)", FormatBytesAsStr(packed_row_val_));
     case ValueType::kUuidDescending: FALLTHROUGH_INTENDED;
     case ValueType::kUuid:
       return uuid_val_.ToString();
@@ -248,6 +255,8 @@ void PrimitiveValue::AppendToKey(KeyBytes* key_bytes) const {
     case ValueType::kCounter: return;
     case ValueType::kSSForward: return;
     case ValueType::kSSReverse: return;
+    case ValueType::kSSRankBlocks: return;
+    case ValueType::kRedisTSChunks: return;
     case ValueType::kFalse: return;
     case ValueType::kTrue: return;
     case ValueType::kFalseDescending: return;
@@ -420,6 +429,8 @@ string PrimitiveValue::ToValue() const {
     case ValueType::kCounter: FALLTHROUGH_INTENDED;
     case ValueType::kSSForward: FALLTHROUGH_INTENDED;
     case ValueType::kSSReverse: FALLTHROUGH_INTENDED;
+    case ValueType::kSSRankBlocks: FALLTHROUGH_INTENDED;
+    case ValueType::kRedisTSChunks: FALLTHROUGH_INTENDED;
     case ValueType::kFalse: FALLTHROUGH_INTENDED;
     case ValueType::kTrue: FALLTHROUGH_INTENDED;
     case ValueType::kFalseDescending: FALLTHROUGH_INTENDED;
@@ -528,6 +539,10 @@ string PrimitiveValue::ToValue() const {
       return result;
     }
 
+    case ValueType::kPackedRow:
+      result.append(packed_row_val_);
+      return result;
+
     case ValueType::kUuidDescending: FALLTHROUGH_INTENDED;
     case ValueType::kTransactionId: FALLTHROUGH_INTENDED;
     case ValueType::kTableId: FALLTHROUGH_INTENDED;
@@ -594,6 +609,8 @@ Status PrimitiveValue::DecodeKey(rocksdb::Slice* slice, PrimitiveValue* out) {
     case ValueType::kCounter: FALLTHROUGH_INTENDED;
     case ValueType::kSSForward: FALLTHROUGH_INTENDED;
     case ValueType::kSSReverse: FALLTHROUGH_INTENDED;
+    case ValueType::kSSRankBlocks: FALLTHROUGH_INTENDED;
+    case ValueType::kRedisTSChunks: FALLTHROUGH_INTENDED;
     case ValueType::kFalse: FALLTHROUGH_INTENDED;
     case ValueType::kTrue: FALLTHROUGH_INTENDED;
     case ValueType::kFalseDescending: FALLTHROUGH_INTENDED;
@@ -960,6 +977,8 @@ Status PrimitiveValue::DecodeFromValue(const rocksdb::Slice& rocksdb_slice) {
     case ValueType::kCounter: FALLTHROUGH_INTENDED;
     case ValueType::kSSForward: FALLTHROUGH_INTENDED;
     case ValueType::kSSReverse: FALLTHROUGH_INTENDED;
+    case ValueType::kSSRankBlocks: FALLTHROUGH_INTENDED;
+    case ValueType::kRedisTSChunks: FALLTHROUGH_INTENDED;
     case ValueType::kFalse: FALLTHROUGH_INTENDED;
     case ValueType::kTrue: FALLTHROUGH_INTENDED;
     case ValueType::kFalseDescending: FALLTHROUGH_INTENDED;
@@ -1093,6 +1112,11 @@ Status PrimitiveValue::DecodeFromValue(const rocksdb::Slice& rocksdb_slice) {
       return Status::OK();
     }
 
+    case ValueType::kPackedRow:
+      new(&packed_row_val_) string(slice.cdata(), slice.size());
+      type_ = value_type;
+      return Status::OK();
+
     case ValueType::kInetaddress: {
       if (slice.size() != kInetAddressV4Size && slice.size() != kInetAddressV6Size) {
         return STATUS_FORMAT(Corruption,
@@ -1272,6 +1296,13 @@ PrimitiveValue PrimitiveValue::Jsonb(const std::string& json) {
   return primitive_value;
 }
 
+PrimitiveValue PrimitiveValue::PackedRow(std::string packed_row) {
+  PrimitiveValue primitive_value;
+  primitive_value.type_ = ValueType::kPackedRow;
+  new(&primitive_value.packed_row_val_) string(std::move(packed_row));
+  return primitive_value;
+}
+
 KeyBytes PrimitiveValue::ToKeyBytes() const {
   KeyBytes kb;
   AppendToKey(&kb);
@@ -1290,6 +1321,8 @@ bool PrimitiveValue::operator==(const PrimitiveValue& other) const {
     case ValueType::kFalseDescending: FALLTHROUGH_INTENDED;
     case ValueType::kSSForward: FALLTHROUGH_INTENDED;
     case ValueType::kSSReverse: FALLTHROUGH_INTENDED;
+    case ValueType::kSSRankBlocks: FALLTHROUGH_INTENDED;
+    case ValueType::kRedisTSChunks: FALLTHROUGH_INTENDED;
     case ValueType::kTrue: FALLTHROUGH_INTENDED;
     case ValueType::kTrueDescending: FALLTHROUGH_INTENDED;
     case ValueType::kLowest: FALLTHROUGH_INTENDED;
@@ -1367,6 +1400,8 @@ int PrimitiveValue::CompareTo(const PrimitiveValue& other) const {
     case ValueType::kCounter: FALLTHROUGH_INTENDED;
     case ValueType::kSSForward: FALLTHROUGH_INTENDED;
     case ValueType::kSSReverse: FALLTHROUGH_INTENDED;
+    case ValueType::kSSRankBlocks: FALLTHROUGH_INTENDED;
+    case ValueType::kRedisTSChunks: FALLTHROUGH_INTENDED;
     case ValueType::kFalse: FALLTHROUGH_INTENDED;
     case ValueType::kTrue: FALLTHROUGH_INTENDED;
     case ValueType::kFalseDescending: FALLTHROUGH_INTENDED;
@@ -1478,6 +1513,8 @@ PrimitiveValue::PrimitiveValue(ValueType value_type)
     frozen_val_ = new FrozenContainer();
   } else if (value_type == ValueType::kJsonb) {
     new(&json_val_) std::string();
+  } else if (value_type == ValueType::kPackedRow) {
+    new(&packed_row_val_) std::string();
   }
 }
 
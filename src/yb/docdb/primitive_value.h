@@ -70,6 +70,9 @@ class PrimitiveValue {
     } else if (other.type_ == ValueType::kJsonb) {
       type_ = other.type_;
       new(&json_val_) std::string(other.json_val_);
+    } else if (other.type_ == ValueType::kPackedRow) {
+      type_ = other.type_;
+      new(&packed_row_val_) std::string(other.packed_row_val_);
     } else if (other.type_ == ValueType::kInetaddress
         || other.type_ == ValueType::kInetaddressDescending) {
       type_ = other.type_;
@@ -210,6 +213,8 @@ class PrimitiveValue {
       str_val_.~basic_string();
     } else if (type_ == ValueType::kJsonb) {
       json_val_.~basic_string();
+    } else if (type_ == ValueType::kPackedRow) {
+      packed_row_val_.~basic_string();
     } else if (type_ == ValueType::kInetaddress || type_ == ValueType::kInetaddressDescending) {
       delete inetaddress_val_;
     } else if (type_ == ValueType::kDecimal || type_ == ValueType::kDecimalDescending) {
@@ -247,6 +252,8 @@ class PrimitiveValue {
   static PrimitiveValue TransactionId(Uuid transaction_id);
   static PrimitiveValue TableId(Uuid table_id);
   static PrimitiveValue Jsonb(const std::string& json);
+  // The encoded columns of a row, see packed_row.h.
+  static PrimitiveValue PackedRow(std::string packed_row);
 
   KeyBytes ToKeyBytes() const;
 
@@ -360,6 +367,11 @@ class PrimitiveValue {
     return json_val_;
   }
 
+  const std::string& GetPackedRow() const {
+    DCHECK(type_ == ValueType::kPackedRow);
+    return packed_row_val_;
+  }
+
   const Uuid& GetUuid() const {
     DCHECK(type_ == ValueType::kUuid || type_ == ValueType::kUuidDescending ||
            type_ == ValueType::kTransactionId || type_ == ValueType::kTableId);
@@ -458,6 +470,7 @@ class PrimitiveValue {
     std::string decimal_val_;
     std::string varint_val_;
     std::string json_val_;
+    std::string packed_row_val_;
   };
 
  private:
@@ -482,6 +495,9 @@ class PrimitiveValue {
     } else if (other->type_ == ValueType::kJsonb) {
       type_ = other->type_;
       new(&json_val_) std::string(std::move(other->json_val_));
+    } else if (other->type_ == ValueType::kPackedRow) {
+      type_ = other->type_;
+      new(&packed_row_val_) std::string(std::move(other->packed_row_val_));
     } else if (other->type_ == ValueType::kDecimal ||
         other->type_ == ValueType::kDecimalDescending) {
       type_ = other->type_;
@@ -13,13 +13,18 @@
 
 #include "yb/docdb/redis_operation.h"
 
+#include <map>
+#include <string>
+
 #include "yb/docdb/doc_ttl_util.h"
 #include "yb/docdb/doc_write_batch.h"
 #include "yb/docdb/doc_write_batch_cache.h"
 #include "yb/docdb/docdb.h"
 #include "yb/docdb/docdb_rocksdb_util.h"
+#include "yb/docdb/redis_ts_chunk.h"
 #include "yb/docdb/subdocument.h"
 
+#include "yb/util/kv_util.h"
 #include "yb/util/stol_utils.h"
 #include "yb/util/redis_util.h"
 
@@ -30,6 +35,21 @@ DEFINE_bool(emulate_redis_responses,
     "and HDEL. If emulate_redis_responses is true, we read the required records to compute the "
     "response as specified by the official Redis API documentation. https://redis.io/commands");
 
+DEFINE_bool(redis_maintain_collection_cardinality,
+    true,
+    "Whether to keep the number of members of Redis hashes and sets up to date in each collection, "
+    "so that HLEN and SCARD do not need to count them. Keeping it requires reading whether each "
+    "member added or removed already exists. If false, writes invalidate the stored number and "
+    "the members are counted again.");
+
+DEFINE_int32(redis_timeseries_chunk_max_points,
+    0,
+    "If positive, TSADD without an expiration stores the points of a timeseries in chunks of up to "
+    "this many points, each chunk being a single compressed value, instead of a key-value per "
+    "point. If negative, no new chunks are written but TSADD and TSREM keep the chunks already "
+    "written up to date. If 0, writes skip reading the chunks, so it must only be used when no "
+    "chunks were written. Chunks already written are read regardless of this flag.");
+
 namespace yb {
 namespace docdb {
 
@@ -70,6 +90,14 @@ bool EmulateRedisResponse(const RedisDataType& data_type) {
   return FLAGS_emulate_redis_responses && data_type != REDIS_TYPE_TIMESERIES;
 }
 
+// Whether writes to a collection of the given type keep its cardinality under the kCounter
+// subkey. Sorted sets and lists always do. Time series do not, as their members may expire
+// individually.
+bool MaintainCardinality(const RedisDataType& data_type) {
+  return FLAGS_redis_maintain_collection_cardinality &&
+         (data_type == REDIS_TYPE_HASH || data_type == REDIS_TYPE_SET);
+}
+
 static const string wrong_type_message =
     "WRONGTYPE Operation against a key holding the wrong kind of value";
 
@@ -415,9 +443,15 @@ void SetOptionalInt(RedisDataType type, int64_t value, RedisResponsePB* response
   SetOptionalInt(type, value, 0, response);
 }
 
-Result<int64_t> GetCardinality(IntentAwareIterator* iterator, const RedisKeyValuePB& kv) {
+KeyBytes EncodedCardinalityKey(const RedisKeyValuePB& kv) {
   auto encoded_key_card = DocKey::EncodedFromRedisKey(kv.hash_code(), kv.key());
   PrimitiveValue(ValueType::kCounter).AppendToKey(&encoded_key_card);
+  return encoded_key_card;
+}
+
+Result<boost::optional<int64_t>> GetStoredCardinality(
+    IntentAwareIterator* iterator, const RedisKeyValuePB& kv) {
+  auto encoded_key_card = EncodedCardinalityKey(kv);
   SubDocument subdoc_card;
 
   bool subdoc_card_found = false;
@@ -425,9 +459,369 @@ Result<int64_t> GetCardinality(IntentAwareIterator* iterator, const RedisKeyValu
 
   RETURN_NOT_OK(GetSubDocument(iterator, data, /* projection */ nullptr, SeekFwdSuffices::kFalse));
 
-  return subdoc_card_found ? subdoc_card.GetInt64() : 0;
+  if (!subdoc_card_found) {
+    return boost::none;
+  }
+  return subdoc_card.GetInt64();
+}
+
+Result<int64_t> GetCardinality(IntentAwareIterator* iterator, const RedisKeyValuePB& kv) {
+  auto card = VERIFY_RESULT(GetStoredCardinality(iterator, kv));
+  return card ? *card : 0;
+}
+
+// Returns the number of members of a hash or a set. It is read from the kCounter subkey when the
+// collection has one, and counted otherwise, e.g. for collections written before it was kept.
+Result<int64_t> CountMembers(IntentAwareIterator* iterator, const RedisKeyValuePB& kv,
+                             DeadlineInfo* deadline_info) {
+  auto card = VERIFY_RESULT(GetStoredCardinality(iterator, kv));
+  if (card) {
+    return *card;
+  }
+
+  auto encoded_doc_key = DocKey::EncodedFromRedisKey(kv.hash_code(), kv.key());
+  // The kCounter subkey sorts before the members, skip it in case it is a tombstone.
+  auto encoded_key_card = EncodedCardinalityKey(kv);
+  SliceKeyBound low_subkey(encoded_key_card, LowerBound(true /* exclusive */));
+  SubDocument doc;
+  bool doc_found = false;
+  GetSubDocumentData data = { encoded_doc_key, &doc, &doc_found };
+  data.deadline_info = deadline_info;
+  data.low_subkey = &low_subkey;
+  data.count_only = true;
+  RETURN_NOT_OK(GetSubDocument(iterator, data, /* projection */ nullptr, SeekFwdSuffices::kFalse));
+  return doc_found ? data.record_count : 0;
+}
+
+// Sets the kCounter subkey of a hash or a set in entries to its cardinality changed by delta.
+CHECKED_STATUS UpdateCardinality(IntentAwareIterator* iterator, const RedisKeyValuePB& kv,
+                                 RedisDataType data_type, int64_t delta, SubDocument* entries) {
+  if (!MaintainCardinality(kv.type())) {
+    // Members may be added or removed without checking whether they exist, so a stored
+    // cardinality can no longer be trusted.
+    if (data_type != REDIS_TYPE_NONE) {
+      entries->SetChild(PrimitiveValue(ValueType::kCounter), SubDocument(ValueType::kTombstone));
+    }
+    return Status::OK();
+  }
+  if (delta == 0) {
+    return Status::OK();
+  }
+  int64_t card = delta;
+  if (data_type != REDIS_TYPE_NONE) {
+    card += VERIFY_RESULT(CountMembers(iterator, kv, /* deadline_info */ nullptr));
+  }
+  entries->SetChild(PrimitiveValue(ValueType::kCounter), SubDocument(PrimitiveValue(card)));
+  return Status::OK();
+}
+
+// The members of a sorted set are counted by blocks of scores, so that ZRANGE by index can skip to
+// the block containing the first member of the range instead of scanning all the members before
+// it. A block holds the scores whose key encoding starts with the same kRankBlockBits bits.
+constexpr int kRankBlockBits = 20;
+
+int64_t ScoreRankBlock(double score) {
+  std::string encoded_score;
+  util::AppendDoubleToKey(score, &encoded_score);
+  return BigEndian::Load64(encoded_score.data()) >> (64 - kRankBlockBits);
+}
+
+// Adds to entries the member counts of the blocks of the sorted set updated by the given deltas.
+CHECKED_STATUS UpdateRankBlocks(const DocOperationApplyData& data,
+                                const RedisKeyValuePB& kv,
+                                RedisDataType data_type,
+                                const std::map<int64_t, int64_t>& block_deltas,
+                                rocksdb::QueryId query_id,
+                                SubDocument* entries) {
+  SubDocument blocks;
+  for (const auto& block_delta : block_deltas) {
+    if (block_delta.second == 0) {
+      continue;
+    }
+    int64_t count = 0;
+    // A set that does not exist yet has no blocks, any found would belong to an older set.
+    if (data_type != RedisDataType::REDIS_TYPE_NONE) {
+      SubDocKey key_block(DocKey::FromRedisKey(kv.hash_code(), kv.key()),
+                          PrimitiveValue(ValueType::kSSRankBlocks),
+                          PrimitiveValue(block_delta.first));
+      SubDocument subdoc_count;
+      bool subdoc_count_found = false;
+      auto encoded_key_block = key_block.EncodeWithoutHt();
+      GetSubDocumentData get_data = { encoded_key_block, &subdoc_count, &subdoc_count_found };
+      RETURN_NOT_OK(GetSubDocument(
+          data.doc_write_batch->doc_db(),
+          get_data, query_id, boost::none /* txn_op_context */, data.deadline,
+          data.read_time));
+      if (subdoc_count_found) {
+        count = subdoc_count.GetInt64();
+      }
+    }
+    blocks.SetChildPrimitive(PrimitiveValue(block_delta.first),
+                             PrimitiveValue(count + block_delta.second));
+  }
+  if (blocks.object_num_keys() > 0) {
+    entries->SetChild(PrimitiveValue(ValueType::kSSRankBlocks), std::move(blocks));
+  }
+  return Status::OK();
+}
+
+// Returns the number of members of the sorted set in the blocks before the one containing the
+// member at index low_idx, and sets low_key to the first key of that block among the members by
+// score. Returns 0 if the blocks do not count all the card members, e.g. for a set written before
+// the blocks were maintained.
+Result<int64_t> SkipRankBlocks(IntentAwareIterator* iterator, const RedisKeyValuePB& kv,
+                               int64_t card, int64_t low_idx, KeyBytes* low_key) {
+  auto encoded_key_blocks = DocKey::EncodedFromRedisKey(kv.hash_code(), kv.key());
+  PrimitiveValue(ValueType::kSSRankBlocks).AppendToKey(&encoded_key_blocks);
+  SubDocument subdoc_blocks;
+  bool subdoc_blocks_found = false;
+  GetSubDocumentData data = { encoded_key_blocks, &subdoc_blocks, &subdoc_blocks_found };
+  RETURN_NOT_OK(GetSubDocument(iterator, data, /* projection */ nullptr, SeekFwdSuffices::kFalse));
+  if (!subdoc_blocks_found || subdoc_blocks.value_type() != ValueType::kObject) {
+    return 0;
+  }
+
+  int64_t total = 0;
+  for (const auto& block : subdoc_blocks.object_container()) {
+    total += block.second.GetInt64();
+  }
+  if (total != card) {
+    return 0;
+  }
+
+  int64_t skipped = 0;
+  for (const auto& block : subdoc_blocks.object_container()) {
+    const int64_t count = block.second.GetInt64();
+    if (skipped + count > low_idx) {
+      *low_key = DocKey::EncodedFromRedisKey(kv.hash_code(), kv.key());
+      PrimitiveValue(ValueType::kSSForward).AppendToKey(low_key);
+      low_key->AppendValueType(ValueType::kDouble);
+      low_key->AppendUInt64(static_cast<uint64_t>(block.first.GetInt64()) <<
+                            (64 - kRankBlockBits));
+      return skipped;
+    }
+    skipped += count;
+  }
+  return 0;
+}
+
+KeyBytes EncodedTSChunksKey(const RedisKeyValuePB& kv) {
+  auto encoded_key_chunks = DocKey::EncodedFromRedisKey(kv.hash_code(), kv.key());
+  PrimitiveValue(ValueType::kRedisTSChunks).AppendToKey(&encoded_key_chunks);
+  return encoded_key_chunks;
+}
+
+// Chunks are keyed by the timestamp they start at, in descending order like the points.
+KeyBytes EncodedTSChunkKey(const RedisKeyValuePB& kv, int64_t start) {
+  auto encoded_key_chunk = EncodedTSChunksKey(kv);
+  PrimitiveValue(start, SortOrder::kDescending).AppendToKey(&encoded_key_chunk);
+  return encoded_key_chunk;
+}
+
+// Reads the chunks of the timeseries within the given bounds, from the latest, into chunks by
+// start. Reads at most limit chunks if limit is positive.
+CHECKED_STATUS ReadTSChunks(IntentAwareIterator* iterator,
+                            const RedisKeyValuePB& kv,
+                            const SliceKeyBound& low_subkey,
+                            const SliceKeyBound& high_subkey,
+                            int32_t limit,
+                            std::map<int64_t, RedisTSChunkPoints>* chunks) {
+  auto encoded_key_chunks = EncodedTSChunksKey(kv);
+  SubDocument doc;
+  bool doc_found = false;
+  GetSubDocumentData data = { encoded_key_chunks, &doc, &doc_found };
+  data.low_subkey = &low_subkey;
+  data.high_subkey = &high_subkey;
+  data.limit = limit;
+  RETURN_NOT_OK(GetSubDocument(iterator, data, /* projection */ nullptr, SeekFwdSuffices::kFalse));
+  if (!doc_found || doc.value_type() != ValueType::kObject) {
+    return Status::OK();
+  }
+  for (const auto& chunk : doc.object_container()) {
+    RETURN_NOT_OK(DecodeRedisTSChunk(
+        chunk.second.GetString(), &(*chunks)[chunk.first.GetInt64()]));
+  }
+  return Status::OK();
+}
+
+// Reads the chunk that the point at the given timestamp belongs to, i.e. the one with the latest
+// start not after the timestamp.
+CHECKED_STATUS ReadTSChunkAt(IntentAwareIterator* iterator,
+                             const RedisKeyValuePB& kv,
+                             int64_t timestamp,
+                             std::map<int64_t, RedisTSChunkPoints>* chunks) {
+  auto encoded_key_chunk = EncodedTSChunkKey(kv, timestamp);
+  SliceKeyBound low_subkey(encoded_key_chunk, LowerBound(false /* exclusive */));
+  return ReadTSChunks(iterator, kv, low_subkey, SliceKeyBound::Invalid(), 1 /* limit */, chunks);
 }
 
+Result<bool> HasTSChunks(IntentAwareIterator* iterator, const RedisKeyValuePB& kv) {
+  std::map<int64_t, RedisTSChunkPoints> chunks;
+  RETURN_NOT_OK(ReadTSChunks(iterator, kv, SliceKeyBound::Invalid(), SliceKeyBound::Invalid(),
+                             1 /* limit */, &chunks));
+  return !chunks.empty();
+}
+
+// Returns the value of the point at the timestamp of the subkey if it is stored in a chunk.
+Result<boost::optional<std::string>> GetTSChunkPoint(
+    IntentAwareIterator* iterator, const RedisKeyValuePB& kv) {
+  const int64_t timestamp = kv.subkey(0).timestamp_subkey();
+  std::map<int64_t, RedisTSChunkPoints> chunks;
+  RETURN_NOT_OK(ReadTSChunkAt(iterator, kv, timestamp, &chunks));
+  for (const auto& chunk : chunks) {
+    auto it = chunk.second.find(timestamp);
+    if (it != chunk.second.end()) {
+      return it->second;
+    }
+  }
+  return boost::none;
+}
+
+// Adds to points the points stored in chunks of the timeseries within the given bounds. Only the
+// latest limit points are kept if limit is positive.
+CHECKED_STATUS ReadTSChunkPoints(IntentAwareIterator* iterator,
+                                 const RedisKeyValuePB& kv,
+                                 const RedisSubKeyBoundPB& lower_bound,
+                                 const RedisSubKeyBoundPB& upper_bound,
+                                 int32_t limit,
+                                 RedisTSChunkPoints* points) {
+  const int64_t low_timestamp = lower_bound.subkey_bound().timestamp_subkey();
+  const int64_t high_timestamp = upper_bound.subkey_bound().timestamp_subkey();
+  std::map<int64_t, RedisTSChunkPoints> chunks;
+
+  // The chunks starting within the bounds.
+  KeyBytes low_sub_key_bound;
+  KeyBytes high_sub_key_bound;
+  SliceKeyBound low_subkey;
+  if (!upper_bound.has_infinity_type()) {
+    low_sub_key_bound = EncodedTSChunkKey(kv, high_timestamp);
+    low_subkey = SliceKeyBound(low_sub_key_bound, LowerBound(false /* exclusive */));
+  }
+  SliceKeyBound high_subkey;
+  if (!lower_bound.has_infinity_type()) {
+    high_sub_key_bound = EncodedTSChunkKey(kv, low_timestamp);
+    high_subkey = SliceKeyBound(high_sub_key_bound, UpperBound(true /* exclusive */));
+  }
+  // The latest chunk read may only have points after the upper bound.
+  RETURN_NOT_OK(ReadTSChunks(
+      iterator, kv, low_subkey, high_subkey, limit > 0 ? limit + 1 : limit, &chunks));
+  // The chunk starting before the lower bound, that may have points within the bounds.
+  if (!lower_bound.has_infinity_type()) {
+    RETURN_NOT_OK(ReadTSChunkAt(iterator, kv, low_timestamp, &chunks));
+  }
+
+  for (const auto& chunk : chunks) {
+    for (const auto& point : chunk.second) {
+      if (!lower_bound.has_infinity_type() && (point.first < low_timestamp ||
+          (lower_bound.is_exclusive() && point.first == low_timestamp))) {
+        continue;
+      }
+      if (!upper_bound.has_infinity_type() && (point.first > high_timestamp ||
+          (upper_bound.is_exclusive() && point.first == high_timestamp))) {
+        continue;
+      }
+      (*points)[point.first] = point.second;
+    }
+  }
+  while (limit > 0 && points->size() > static_cast<size_t>(limit)) {
+    points->erase(points->begin());
+  }
+  return Status::OK();
+}
+
+// Changes to the chunks of a timeseries made by a write. A point belongs to the chunk with the
+// latest start not after its timestamp, so that the chunks of a timeseries never overlap.
+class RedisTSChunksUpdate {
+ public:
+  // The chunks are read only if the timeseries exists.
+  RedisTSChunksUpdate(IntentAwareIterator* iterator, const RedisKeyValuePB& kv, bool exists)
+      : iterator_(iterator), kv_(kv), exists_(exists) {}
+
+  // Adds the point to the chunk it belongs to. A point after the end of a full chunk starts a new
+  // chunk, while a full chunk that a point is added within is split in two halves.
+  CHECKED_STATUS Add(int64_t timestamp, const std::string& value, size_t max_points) {
+    auto it = VERIFY_RESULT(Find(timestamp));
+    if (it == chunks_.end() ||
+        (it->second.points.size() >= max_points && !it->second.points.empty() &&
+         timestamp > it->second.points.rbegin()->first)) {
+      it = chunks_.emplace(timestamp, Chunk()).first;
+    }
+    auto& points = it->second.points;
+    points[timestamp] = value;
+    it->second.changed = true;
+    if (points.size() > max_points) {
+      auto middle = points.begin();
+      std::advance(middle, points.size() / 2);
+      Chunk upper_half;
+      upper_half.points.insert(middle, points.end());
+      upper_half.changed = true;
+      points.erase(middle, points.end());
+      const int64_t upper_start = upper_half.points.begin()->first;
+      chunks_[upper_start] = std::move(upper_half);
+    }
+    return Status::OK();
+  }
+
+  // Removes the point at the timestamp from the chunk it belongs to, if any.
+  CHECKED_STATUS Remove(int64_t timestamp) {
+    auto it = VERIFY_RESULT(Find(timestamp));
+    if (it != chunks_.end() && it->second.points.erase(timestamp)) {
+      it->second.changed = true;
+    }
+    return Status::OK();
+  }
+
+  // Adds the changed chunks to entries, deleting the ones left empty.
+  void AddTo(SubDocument* entries) const {
+    SubDocument chunks;
+    for (const auto& chunk : chunks_) {
+      if (!chunk.second.changed) {
+        continue;
+      }
+      const PrimitiveValue subkey(chunk.first, SortOrder::kDescending);
+      if (chunk.second.points.empty()) {
+        chunks.SetChild(subkey, SubDocument(ValueType::kTombstone));
+      } else {
+        chunks.SetChildPrimitive(subkey, PrimitiveValue(EncodeRedisTSChunk(chunk.second.points)));
+      }
+    }
+    if (chunks.object_num_keys() > 0) {
+      entries->SetChild(PrimitiveValue(ValueType::kRedisTSChunks), std::move(chunks));
+    }
+  }
+
+ private:
+  struct Chunk {
+    RedisTSChunkPoints points;
+    bool changed = false;
+  };
+  typedef std::map<int64_t, Chunk> Chunks;
+
+  // Returns the chunk the point at the timestamp belongs to, or end if there is none.
+  Result<Chunks::iterator> Find(int64_t timestamp) {
+    if (exists_) {
+      std::map<int64_t, RedisTSChunkPoints> stored_chunks;
+      RETURN_NOT_OK(ReadTSChunkAt(iterator_, kv_, timestamp, &stored_chunks));
+      for (auto& stored_chunk : stored_chunks) {
+        // A chunk already read may have been changed since.
+        Chunk chunk;
+        chunk.points = std::move(stored_chunk.second);
+        chunks_.emplace(stored_chunk.first, std::move(chunk));
+      }
+    }
+    auto it = chunks_.upper_bound(timestamp);
+    if (it == chunks_.begin()) {
+      return chunks_.end();
+    }
+    return --it;
+  }
+
+  IntentAwareIterator* const iterator_;
+  const RedisKeyValuePB& kv_;
+  const bool exists_;
+  Chunks chunks_;
+};
+
 template <typename AddResponseValues>
 CHECKED_STATUS GetAndPopulateResponseValues(
     IntentAwareIterator* iterator,
@@ -564,15 +958,48 @@ Status RedisWriteOperation::ApplySet(const DocOperationApplyData& data) {
           return Status::OK();
         }
         SubDocument kv_entries = SubDocument();
+        // Number of distinct fields being added to a hash.
+        int new_fields_added = 0;
+        // Points of a timeseries written without an expiration go to its chunks if enabled. Points
+        // written individually replace the ones already in chunks.
+        const bool add_to_ts_chunks = kv.type() == REDIS_TYPE_TIMESERIES &&
+                                      FLAGS_redis_timeseries_chunk_max_points > 0 &&
+                                      !request_.set_request().has_ttl();
+        const bool update_ts_chunks = kv.type() == REDIS_TYPE_TIMESERIES &&
+            (add_to_ts_chunks ||
+             (FLAGS_redis_timeseries_chunk_max_points != 0 && data_type != REDIS_TYPE_NONE &&
+              VERIFY_RESULT(HasTSChunks(iterator_.get(), kv))));
+        RedisTSChunksUpdate ts_chunks_update(
+            iterator_.get(), kv, data_type != REDIS_TYPE_NONE /* exists */);
         for (int i = 0; i < kv.subkey_size(); i++) {
           PrimitiveValue subkey_value;
           RETURN_NOT_OK(PrimitiveValueFromSubKeyStrict(kv.subkey(i), kv.type(), &subkey_value));
+          if (add_to_ts_chunks) {
+            RETURN_NOT_OK(ts_chunks_update.Add(
+                kv.subkey(i).timestamp_subkey(), kv.value(i),
+                FLAGS_redis_timeseries_chunk_max_points));
+            continue;
+          }
+          if (update_ts_chunks) {
+            RETURN_NOT_OK(ts_chunks_update.Remove(kv.subkey(i).timestamp_subkey()));
+          }
+          if (MaintainCardinality(kv.type()) && kv_entries.GetChild(subkey_value) == nullptr &&
+              (data_type == REDIS_TYPE_NONE ||
+               VERIFY_RESULT(GetValueType(data, i)) == REDIS_TYPE_NONE)) {
+            new_fields_added++;
+          }
           kv_entries.SetChild(subkey_value,
                               SubDocument(PrimitiveValue(kv.value(i))));
         }
 
+        // The chunks do not take the expiration of the points written individually.
+        SubDocument ts_chunks_entries;
         if (kv.type() == REDIS_TYPE_TIMESERIES) {
+          ts_chunks_update.AddTo(&ts_chunks_entries);
           RETURN_NOT_OK(kv_entries.ConvertToRedisTS());
+        } else {
+          RETURN_NOT_OK(UpdateCardinality(
+              iterator_.get(), kv, data_type, new_fields_added, &kv_entries));
         }
 
         // For an HSET command (which has only one subkey), we need to read the subkey to find out
@@ -594,6 +1021,10 @@ Status RedisWriteOperation::ApplySet(const DocOperationApplyData& data) {
           RETURN_NOT_OK(data.doc_write_batch->ExtendSubDocument(
               doc_path, kv_entries, data.read_time, data.deadline, redis_query_id(), ttl));
         }
+        if (ts_chunks_entries.object_num_keys() > 0) {
+          RETURN_NOT_OK(data.doc_write_batch->ExtendSubDocument(
+              doc_path, ts_chunks_entries, data.read_time, data.deadline, redis_query_id()));
+        }
         break;
       }
       case REDIS_TYPE_SORTEDSET: {
@@ -611,6 +1042,9 @@ Status RedisWriteOperation::ApplySet(const DocOperationApplyData& data) {
         // The top level mapping.
         SubDocument kv_entries;
 
+        // The changes to the member counts of the blocks of scores.
+        std::map<int64_t, int64_t> block_deltas;
+
         int new_elements_added = 0;
         int return_value = 0;
         for (int i = 0; i < kv.subkey_size(); i++) {
@@ -628,6 +1062,13 @@ Status RedisWriteOperation::ApplySet(const DocOperationApplyData& data) {
               get_data, redis_query_id(), boost::none /* txn_op_context */, data.deadline,
               data.read_time));
 
+          // If the incr option is specified, we need insert the existing score + new score
+          // instead of just the new score.
+          const double score_to_add =
+              request_.set_request().sorted_set_options().incr() && subdoc_reverse_found ?
+                  kv.subkey(i).double_subkey() + subdoc_reverse.GetDouble() :
+                  kv.subkey(i).double_subkey();
+
           // Flag indicating whether we should add the given entry to the sorted set.
           bool should_add_entry = true;
           // Flag indicating whether we shoould remove an entry from the sorted set.
@@ -661,7 +1102,7 @@ Status RedisWriteOperation::ApplySet(const DocOperationApplyData& data) {
                 // should_remove_existing_entry to true, and if the CH flag is on (return both
                 // elements changed and elements added), increment return_value.
                 double score_to_remove = subdoc_reverse.GetDouble();
-                if (score_to_remove != kv.subkey(i).double_subkey()) {
+                if (score_to_remove != score_to_add) {
                   should_remove_existing_entry = true;
                   if (request_.set_request().sorted_set_options().ch()) {
                     return_value++;
@@ -684,14 +1125,13 @@ Status RedisWriteOperation::ApplySet(const DocOperationApplyData& data) {
                                               SubDocument(ValueType::kTombstone));
             kv_entries_forward.SetChild(PrimitiveValue::Double(score_to_remove),
                                         SubDocument(subdoc_forward_tombstone));
+            --block_deltas[ScoreRankBlock(score_to_remove)];
           }
 
           if (should_add_entry) {
-            // If the incr option is specified, we need insert the existing score + new score
-            // instead of just the new score.
-            double score_to_add = request_.set_request().sorted_set_options().incr() ?
-                kv.subkey(i).double_subkey() + subdoc_reverse.GetDouble() :
-                kv.subkey(i).double_subkey();
+            if (!subdoc_reverse_found || should_remove_existing_entry) {
+              ++block_deltas[ScoreRankBlock(score_to_add)];
+            }
 
             // Add the forward mapping to the entries.
             SubDocument *forward_entry =
@@ -722,6 +1162,9 @@ Status RedisWriteOperation::ApplySet(const DocOperationApplyData& data) {
                               SubDocument(kv_entries_reverse));
         }
 
+        RETURN_NOT_OK(UpdateRankBlocks(
+            data, kv, data_type, block_deltas, redis_query_id(), &kv_entries));
+
         if (kv_entries.object_num_keys() > 0) {
           RETURN_NOT_OK(kv_entries.ConvertToRedisSortedSet());
           if (data_type == REDIS_TYPE_NONE) {
@@ -930,11 +1373,18 @@ Status RedisWriteOperation::ApplyDel(const DocOperationApplyData& data) {
       if (data_type == REDIS_TYPE_NONE) {
         return Status::OK();
       }
+      const bool has_ts_chunks = FLAGS_redis_timeseries_chunk_max_points != 0 &&
+                                 VERIFY_RESULT(HasTSChunks(iterator_.get(), kv));
+      RedisTSChunksUpdate ts_chunks_update(iterator_.get(), kv, true /* exists */);
       for (int i = 0; i < kv.subkey_size(); i++) {
         PrimitiveValue primitive_value;
         RETURN_NOT_OK(PrimitiveValueFromSubKeyStrict(kv.subkey(i), data_type, &primitive_value));
         values.SetChild(primitive_value, SubDocument(ValueType::kTombstone));
+        if (has_ts_chunks) {
+          RETURN_NOT_OK(ts_chunks_update.Remove(kv.subkey(i).timestamp_subkey()));
+        }
       }
+      ts_chunks_update.AddTo(&values);
       num_keys = kv.subkey_size();
       break;
     }
@@ -942,6 +1392,7 @@ Status RedisWriteOperation::ApplyDel(const DocOperationApplyData& data) {
       SubDocument values_card;
       SubDocument values_forward;
       SubDocument values_reverse;
+      std::map<int64_t, int64_t> block_deltas;
       num_keys = kv.subkey_size();
       for (int i = 0; i < kv.subkey_size(); i++) {
         // Check whether the value is already in the document.
@@ -970,6 +1421,7 @@ Status RedisWriteOperation::ApplyDel(const DocOperationApplyData& data) {
                                SubDocument(ValueType::kTombstone));
           values_forward.SetChild(PrimitiveValue::Double(doc_reverse.GetDouble()),
                           SubDocument(doc_forward));
+          --block_deltas[ScoreRankBlock(doc_reverse.GetDouble())];
         } else {
           // If the key is absent, it doesn't contribute to the count of keys being deleted.
           num_keys--;
@@ -982,13 +1434,15 @@ Status RedisWriteOperation::ApplyDel(const DocOperationApplyData& data) {
       values.SetChild(PrimitiveValue(ValueType::kCounter), SubDocument(values_card));
       values.SetChild(PrimitiveValue(ValueType::kSSForward), SubDocument(values_forward));
       values.SetChild(PrimitiveValue(ValueType::kSSReverse), SubDocument(values_reverse));
+      RETURN_NOT_OK(UpdateRankBlocks(
+          data, kv, data_type, block_deltas, redis_query_id(), &values));
 
       break;
     }
     default: {
       num_keys = kv.subkey_size(); // We know the subkeys are distinct.
       // Avoid reads for redis timeseries type.
-      if (EmulateRedisResponse(kv.type())) {
+      if (EmulateRedisResponse(kv.type()) || MaintainCardinality(kv.type())) {
         for (int i = 0; i < kv.subkey_size(); i++) {
           RedisDataType type = VERIFY_RESULT(GetValueType(data, i));
           if (type == REDIS_TYPE_STRING) {
@@ -1000,6 +1454,9 @@ Status RedisWriteOperation::ApplyDel(const DocOperationApplyData& data) {
           }
         }
       }
+      if (kv.type() == REDIS_TYPE_HASH || kv.type() == REDIS_TYPE_SET) {
+        RETURN_NOT_OK(UpdateCardinality(iterator_.get(), kv, data_type, -num_keys, &values));
+      }
       break;
     }
   }
@@ -1108,6 +1565,8 @@ Status RedisWriteOperation::ApplyIncr(const DocOperationApplyData& data) {
     PrimitiveValue subkey_value;
     RETURN_NOT_OK(PrimitiveValueFromSubKeyStrict(kv.subkey(0), kv.type(), &subkey_value));
     kv_entries.SetChild(subkey_value, SubDocument(new_pvalue));
+    RETURN_NOT_OK(UpdateCardinality(
+        iterator_.get(), kv, container_type, value->type == REDIS_TYPE_NONE ? 1 : 0, &kv_entries));
     return data.doc_write_batch->ExtendSubDocument(
         doc_path, kv_entries, data.read_time, data.deadline, redis_query_id());
   } else {  // kv.type() == REDIS_TYPE_STRING
@@ -1227,7 +1686,8 @@ Status RedisWriteOperation::ApplyAdd(const DocOperationApplyData& data) {
   SubDocument set_entries = SubDocument();
 
   for (int i = 0 ; i < kv.subkey_size(); i++) { // We know that each subkey is distinct.
-    if (FLAGS_emulate_redis_responses) {
+    if ((FLAGS_emulate_redis_responses || MaintainCardinality(kv.type())) &&
+        data_type != REDIS_TYPE_NONE) {
       RedisDataType type = VERIFY_RESULT(GetValueType(data, i));
       if (type != REDIS_TYPE_NONE) {
         num_keys_found++;
@@ -1239,6 +1699,8 @@ Status RedisWriteOperation::ApplyAdd(const DocOperationApplyData& data) {
         SubDocument(PrimitiveValue(ValueType::kNullLow)));
   }
 
+  RETURN_NOT_OK(UpdateCardinality(
+      iterator_.get(), kv, data_type, kv.subkey_size() - num_keys_found, &set_entries));
   RETURN_NOT_OK(set_entries.ConvertToRedisSet());
 
   Status s;
@@ -1324,12 +1786,39 @@ Status RedisReadOperation::ExecuteHGetAllLikeCommands(ValueType value_type,
 
   bool has_cardinality_subkey = value_type == ValueType::kRedisSortedSet ||
                                 value_type == ValueType::kRedisList;
+  // Hashes and sets may keep their cardinality under the kCounter subkey, which sorts before their
+  // members and is not one of them.
+  bool may_have_cardinality_subkey = value_type == ValueType::kObject ||
+                                     value_type == ValueType::kRedisSet;
   bool return_array_response = add_keys || add_values;
 
-  if (has_cardinality_subkey) {
+  // The points of a timeseries stored in chunks are counted along with the ones stored
+  // individually, which then have to be read to skip those at the same timestamps.
+  RedisTSChunkPoints ts_chunk_points;
+  if (value_type == ValueType::kRedisTS) {
+    RedisSubKeyBoundPB lower_bound;
+    lower_bound.set_infinity_type(RedisSubKeyBoundPB::NEGATIVE);
+    RedisSubKeyBoundPB upper_bound;
+    upper_bound.set_infinity_type(RedisSubKeyBoundPB::POSITIVE);
+    RETURN_NOT_OK(ReadTSChunkPoints(iterator_.get(), request_.key_value(), lower_bound,
+                                    upper_bound, 0 /* limit */, &ts_chunk_points));
+  }
+
+  if (has_cardinality_subkey || may_have_cardinality_subkey) {
     data.return_type_only = !return_array_response;
   } else {
-    data.count_only = !return_array_response;
+    data.count_only = !return_array_response && ts_chunk_points.empty();
+  }
+
+  auto encoded_key_card = EncodedCardinalityKey(request_.key_value());
+  auto encoded_key_ts_chunks = EncodedTSChunksKey(request_.key_value());
+  SliceKeyBound low_subkey;
+  if (may_have_cardinality_subkey) {
+    low_subkey = SliceKeyBound(encoded_key_card, LowerBound(true /* exclusive */));
+    data.low_subkey = &low_subkey;
+  } else if (value_type == ValueType::kRedisTS) {
+    low_subkey = SliceKeyBound(encoded_key_ts_chunks, LowerBound(true /* exclusive */));
+    data.low_subkey = &low_subkey;
   }
 
   RETURN_NOT_OK(GetSubDocument(iterator_.get(), data, /* projection */ nullptr,
@@ -1349,9 +1838,20 @@ Status RedisReadOperation::ExecuteHGetAllLikeCommands(ValueType value_type,
       RETURN_NOT_OK(PopulateResponseFrom(doc.object_container(), AddResponseValuesGeneric,
                                          &response_, add_keys, add_values));
     } else {
-      int64_t card = has_cardinality_subkey ?
-        VERIFY_RESULT(GetCardinality(iterator_.get(), request_.key_value())) :
-        data.record_count;
+      int64_t card;
+      if (has_cardinality_subkey) {
+        card = VERIFY_RESULT(GetCardinality(iterator_.get(), request_.key_value()));
+      } else if (may_have_cardinality_subkey) {
+        card = VERIFY_RESULT(CountMembers(
+            iterator_.get(), request_.key_value(), deadline_info_.get_ptr()));
+      } else if (!ts_chunk_points.empty()) {
+        card = ts_chunk_points.size();
+        for (const auto& point : doc.object_container()) {
+          card += !ts_chunk_points.count(point.first.GetInt64());
+        }
+      } else {
+        card = data.record_count;
+      }
       response_.set_int_response(card);
       response_.set_code(RedisResponsePB::OK);
     }
@@ -1460,6 +1960,10 @@ Status RedisReadOperation::ExecuteCollectionGetRangeByBounds(
       low_sub_key_bound = encoded_doc_key;
       PrimitiveValue(high_timestamp, SortOrder::kDescending).AppendToKey(&low_sub_key_bound);
       low_subkey = SliceKeyBound(low_sub_key_bound, LowerBound(upper_bound.is_exclusive()));
+    } else {
+      // The chunks sort before the points, they are read separately.
+      low_sub_key_bound = EncodedTSChunksKey(request_.key_value());
+      low_subkey = SliceKeyBound(low_sub_key_bound, LowerBound(true /* exclusive */));
     }
     SliceKeyBound high_subkey;
     if (!lower_bound.has_infinity_type()) {
@@ -1480,9 +1984,45 @@ Status RedisReadOperation::ExecuteCollectionGetRangeByBounds(
       // If reverse is false, newest element is the first element returned.
       is_reverse = false;
     }
-    RETURN_NOT_OK(GetAndPopulateResponseValues(
-        iterator_.get(), AddResponseValuesGeneric, data, ValueType::kRedisTS, request_, &response_,
-        /* add_keys */ true, /* add_values */ true, is_reverse));
+    RedisTSChunkPoints chunk_points;
+    RETURN_NOT_OK(ReadTSChunkPoints(
+        iterator_.get(), request_.key_value(), lower_bound, upper_bound,
+        request_.range_request_limit(), &chunk_points));
+    if (chunk_points.empty()) {
+      RETURN_NOT_OK(GetAndPopulateResponseValues(
+          iterator_.get(), AddResponseValuesGeneric, data, ValueType::kRedisTS, request_,
+          &response_, /* add_keys */ true, /* add_values */ true, is_reverse));
+      return Status::OK();
+    }
+
+    // Points in chunks take precedence over points stored individually at the same timestamp, so
+    // as many more of the latter are read as there are points in chunks.
+    if (data.limit > 0) {
+      data.limit += chunk_points.size();
+    }
+    RETURN_NOT_OK(GetSubDocument(
+        iterator_.get(), data, /* projection */ nullptr, SeekFwdSuffices::kFalse));
+    response_.set_allocated_array_response(new RedisArrayPB());
+    if (!doc_found) {
+      response_.set_code(RedisResponsePB::NIL);
+      return Status::OK();
+    }
+    if (!VerifyTypeAndSetCode(ValueType::kRedisTS, doc.value_type(), &response_)) {
+      return Status::OK();
+    }
+    for (const auto& point : chunk_points) {
+      doc.SetChildPrimitive(
+          PrimitiveValue(point.first, SortOrder::kDescending), PrimitiveValue(point.second));
+    }
+    // The points are ordered from the latest, keep the latest limit ones.
+    auto& points = doc.object_container();
+    while (request_.range_request_limit() > 0 &&
+           points.size() > static_cast<size_t>(request_.range_request_limit())) {
+      points.erase(std::prev(points.end()));
+    }
+    RETURN_NOT_OK(PopulateResponseFrom(
+        points, AddResponseValuesGeneric, &response_, /* add_keys */ true, /* add_values */ true,
+        is_reverse));
   }
   return Status::OK();
 }
@@ -1555,8 +2095,17 @@ Status RedisReadOperation::ExecuteCollectionGetRange() {
 
       bool add_keys = request_.get_collection_range_request().with_scores();
 
-      IndexBound low_bound = IndexBound(low_idx_normalized, true /* is_lower */);
-      IndexBound high_bound = IndexBound(high_idx_normalized, false /* is_lower */);
+      // Start the scan from the block of scores containing the first member of the range.
+      KeyBytes low_subkey_bytes;
+      const int64_t skipped = VERIFY_RESULT(SkipRankBlocks(
+          iterator_.get(), request_.key_value(), card, low_idx_normalized, &low_subkey_bytes));
+      SliceKeyBound low_subkey;
+      if (skipped > 0) {
+        low_subkey = SliceKeyBound(low_subkey_bytes, LowerBound(false /* exclusive */));
+      }
+
+      IndexBound low_bound = IndexBound(low_idx_normalized - skipped, true /* is_lower */);
+      IndexBound high_bound = IndexBound(high_idx_normalized - skipped, false /* is_lower */);
 
       SubDocument doc;
       bool doc_found = false;
@@ -1564,6 +2113,7 @@ Status RedisReadOperation::ExecuteCollectionGetRange() {
       data.deadline_info = deadline_info_.get_ptr();
       data.low_index = &low_bound;
       data.high_index = &high_bound;
+      data.low_subkey = &low_subkey;
 
       RETURN_NOT_OK(GetAndPopulateResponseValues(
           iterator_.get(), AddResponseValuesSortedSets, data, ValueType::kObject, request_,
@@ -1711,6 +2261,14 @@ Status RedisReadOperation::ExecuteGet(const RedisGetRequestPB& get_request) {
       }
       // If wrong type, we set the error code in the response.
       if (VerifyTypeAndSetCode(expected_type, type, &response_, VerifySuccessIfMissing::kTrue)) {
+        if (request_type == RedisGetRequestPB::TSGET) {
+          // A point in a chunk takes precedence over one stored individually.
+          auto chunk_value = VERIFY_RESULT(GetTSChunkPoint(iterator_.get(), request_.key_value()));
+          if (chunk_value) {
+            response_.set_string_response(*chunk_value);
+            return Status::OK();
+          }
+        }
         auto value = request_type == RedisGetRequestPB::TSGET ? GetOverrideValue() : GetValue();
         RETURN_NOT_OK(value);
         if (VerifyTypeAndSetCode(RedisDataType::REDIS_TYPE_STRING, value->type, &response_,
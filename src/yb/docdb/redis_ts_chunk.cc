@@ -0,0 +1,101 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/redis_ts_chunk.h"
+
+#include <vector>
+
+#include "yb/util/fast_varint.h"
+
+namespace yb {
+namespace docdb {
+
+// Timestamp deltas are computed on unsigned values, so that they wrap around instead of overflowing
+// for timestamps far apart. Decoding wraps around the same way.
+
+std::string EncodeRedisTSChunk(const RedisTSChunkPoints& points) {
+  std::string result;
+  util::FastAppendUnsignedVarIntToStr(points.size(), &result);
+  uint64_t prev_timestamp = 0;
+  uint64_t prev_delta = 0;
+  bool first = true;
+  for (const auto& point : points) {
+    const uint64_t timestamp = static_cast<uint64_t>(point.first);
+    if (first) {
+      util::FastAppendSignedVarIntToStr(point.first, &result);
+      first = false;
+    } else {
+      const uint64_t delta = timestamp - prev_timestamp;
+      util::FastAppendSignedVarIntToStr(static_cast<int64_t>(delta - prev_delta), &result);
+      prev_delta = delta;
+    }
+    prev_timestamp = timestamp;
+  }
+
+  const std::string* prev_value = nullptr;
+  for (const auto& point : points) {
+    if (prev_value != nullptr && *prev_value == point.second) {
+      util::FastAppendUnsignedVarIntToStr(0, &result);
+    } else {
+      util::FastAppendUnsignedVarIntToStr(point.second.size() + 1, &result);
+      result.append(point.second);
+    }
+    prev_value = &point.second;
+  }
+  return result;
+}
+
+Status DecodeRedisTSChunk(Slice chunk, RedisTSChunkPoints* points) {
+  const auto num_points = VERIFY_RESULT(util::FastDecodeUnsignedVarInt(&chunk));
+  if (num_points > chunk.size()) {
+    return STATUS_FORMAT(Corruption, "Time series chunk of $0 points has only $1 bytes",
+                         num_points, chunk.size());
+  }
+
+  std::vector<int64_t> timestamps;
+  timestamps.reserve(num_points);
+  uint64_t timestamp = 0;
+  uint64_t delta = 0;
+  for (uint64_t i = 0; i < num_points; ++i) {
+    const int64_t encoded = VERIFY_RESULT(util::FastDecodeSignedVarInt(&chunk));
+    if (i == 0) {
+      timestamp = static_cast<uint64_t>(encoded);
+    } else {
+      delta += static_cast<uint64_t>(encoded);
+      timestamp += delta;
+    }
+    timestamps.push_back(static_cast<int64_t>(timestamp));
+  }
+
+  Slice value;
+  for (const auto point_timestamp : timestamps) {
+    const auto size = VERIFY_RESULT(util::FastDecodeUnsignedVarInt(&chunk));
+    if (size != 0) {
+      if (size - 1 > chunk.size()) {
+        return STATUS_FORMAT(Corruption, "Time series chunk value of $0 bytes past its end: $1",
+                             size - 1, chunk.ToDebugHexString());
+      }
+      value = Slice(chunk.data(), size - 1);
+      chunk.remove_prefix(size - 1);
+    }
+    (*points)[point_timestamp] = value.ToBuffer();
+  }
+  if (!chunk.empty()) {
+    return STATUS_FORMAT(Corruption, "$0 extra bytes at the end of time series chunk",
+                         chunk.size());
+  }
+  return Status::OK();
+}
+
+}  // namespace docdb
+}  // namespace yb
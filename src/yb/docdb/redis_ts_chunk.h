@@ -0,0 +1,48 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+// A chunk of a Redis time series stores the points of a range of timestamps of the series as a
+// single value, instead of one key-value per point. It is encoded as:
+//
+//   <number of points (varint)> <first timestamp (signed varint)>
+//   { <delta of the delta between consecutive timestamps (signed varint)> }*
+//   { <value> }*
+//
+// where each value is encoded as its size plus one (varint) followed by its bytes, or as zero when
+// it is equal to the previous value. Regularly spaced timestamps and repeated values thus take a
+// single byte each.
+
+#ifndef YB_DOCDB_REDIS_TS_CHUNK_H_
+#define YB_DOCDB_REDIS_TS_CHUNK_H_
+
+#include <map>
+#include <string>
+
+#include "yb/util/slice.h"
+#include "yb/util/status.h"
+
+namespace yb {
+namespace docdb {
+
+// The points of a time series chunk, by timestamp.
+typedef std::map<int64_t, std::string> RedisTSChunkPoints;
+
+std::string EncodeRedisTSChunk(const RedisTSChunkPoints& points);
+
+// Adds the points of the chunk to points, replacing the values of the timestamps already there.
+CHECKED_STATUS DecodeRedisTSChunk(Slice chunk, RedisTSChunkPoints* points);
+
+}  // namespace docdb
+}  // namespace yb
+
+#endif  // YB_DOCDB_REDIS_TS_CHUNK_H_
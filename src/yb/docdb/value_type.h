@@ -68,6 +68,8 @@ namespace docdb {
     /* Forward and reverse mappings for sorted sets. */ \
     ((kSSForward, '&')) /* ASCII code 38 */ \
     ((kSSReverse, '\'')) /* ASCII code 39 */ \
+    /* Counts of the members of a sorted set by blocks of scores. */ \
+    ((kSSRankBlocks, '*')) /* ASCII code 42 */ \
     ((kRedisSet, '(')) /* ASCII code 40 */ \
     ((kRedisList, ')')) /* ASCII code 41*/ \
     /* This is the redis timeseries type. */ \
@@ -75,6 +77,8 @@ namespace docdb {
     ((kRedisSortedSet, ',')) /* ASCII code 44 */ \
     ((kInetaddress, '-'))  /* ASCII code 45 */ \
     ((kInetaddressDescending, '.'))  /* ASCII code 46 */ \
+    /* Chunks of points of a redis timeseries. */ \
+    ((kRedisTSChunks, '/')) /* ASCII code 47 */ \
     ((kJsonb, '2')) /* ASCII code 50 */ \
     ((kFrozen, '<')) /* ASCII code 60 */ \
     ((kFrozenDescending, '>')) /* ASCII code 62 */ \
@@ -92,6 +96,8 @@ namespace docdb {
     ((kDoubleDescending, 'L'))  /* ASCII code 76 */ \
     ((kFloatDescending, 'M')) /* ASCII code 77 */ \
     ((kUInt32, 'O'))  /* ASCII code 78 */ \
+    /* All the columns of a row version packed into a single value at the DocKey of the row. */ \
+    ((kPackedRow, 'P'))  /* ASCII code 80 */ \
     ((kString, 'S'))  /* ASCII code 83 */ \
     ((kTrue, 'T'))  /* ASCII code 84 */ \
     ((kUInt64, 'U')) /* ASCII code 85 */ \
@@ -54,6 +54,12 @@ class MasterTabletServer : public tserver::TabletServerIf,
 
   uint64_t ysql_catalog_version() const override;
 
+  CHECKED_STATUS UpdateYsqlCatalogCache(
+      uint64_t access_token, uint64_t ysql_catalog_version, const Slice& key,
+      const Slice& value) override {
+    return STATUS(NotSupported, "Master has no YSQL catalog cache");
+  }
+
   client::TransactionPool* TransactionPool() override {
     return nullptr;
   }
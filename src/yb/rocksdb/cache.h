@@ -87,6 +87,14 @@ class Cache {
   // Opaque handle to an entry stored in the cache.
   struct Handle { };
 
+  // High priority entries, e.g. index and filter blocks, are kept in the high priority pool of the
+  // cache. They are only evicted after all the low priority entries that could be evicted, unless
+  // they overflow the pool (see cache_high_pri_pool_ratio).
+  enum class Priority {
+    HIGH,
+    LOW
+  };
+
   // Insert a mapping from key->value into the cache and assign it
   // the specified charge against the total cache capacity.
   // If strict_capacity_limit is true and cache reaches its full capacity,
@@ -104,12 +112,14 @@ class Cache {
   // value will be passed to "deleter".
   // The query ids will allow the cache values to be included in the
   // single touch or multi touch cache, which gives scan resistance to the
-  // cache.
+  // cache. The priority is independent of the query id, and applies
+  // within the single touch or multi touch cache the value ends up in.
   virtual Status Insert(const Slice& key, const QueryId query_id,
                         void* value, size_t charge,
                         void (*deleter)(const Slice& key, void* value),
                         Handle** handle = nullptr,
-                        Statistics* statistics = nullptr) = 0;
+                        Statistics* statistics = nullptr,
+                        Priority priority = Priority::LOW) = 0;
 
   // If the cache has no mapping for "key", returns nullptr.
   //
@@ -167,6 +177,9 @@ class Cache {
   // returns the memory size for the entries in use by the system
   virtual size_t GetPinnedUsage() const = 0;
 
+  // returns the memory size for the entries in the high priority pool
+  virtual size_t GetHighPriPoolUsage() const { return 0; }
+
   // Gets the sub_cache type of the handle.
   virtual SubCacheType GetSubCacheType(Handle* e) const {
     // Default implementation assumes multi-touch.
@@ -34,6 +34,7 @@
 namespace rocksdb {
 
 class SliceTransform;
+struct FileMetaData;
 
 // Context information of a compaction run
 struct CompactionFilterContext {
@@ -55,6 +56,9 @@ class CompactionFilter {
   struct Context {
     // Does this compaction run include all data files
     bool is_full_compaction;
+    // Does this compaction output to the bottommost level, i.e. no older data files overlap the
+    // key range of its input files
+    bool is_bottommost_level;
     // Is this compaction requested by the client (true),
     // or is it occurring as an automatic compaction process
     bool is_manual_compaction;
@@ -101,8 +105,9 @@ class CompactionFilter {
   // in existence and operating concurrently.
   //
   // The last paragraph is not true if you set max_subcompactions to more than
-  // 1. In that case, subcompaction from multiple threads may call a single
-  // CompactionFilter concurrently.
+  // 1 and supply Options::compaction_filter. In that case, subcompaction from
+  // multiple threads may call a single CompactionFilter concurrently. A factory
+  // creates a separate filter for each subcompaction.
   virtual FilterDecision Filter(int level,
                                 const Slice& key,
                                 const Slice& existing_value,
@@ -155,6 +160,17 @@ class CompactionFilterFactory {
   virtual std::unique_ptr<CompactionFilter> CreateCompactionFilter(
       const CompactionFilter::Context& context) = 0;
 
+  // Given the files of level 0 ordered from the newest to the oldest, returns how many of the
+  // oldest ones only have records that no read can see anymore, e.g. because they have expired.
+  // Universal compaction deletes such files without compacting them.
+  virtual size_t NumExpiredFiles(const std::vector<FileMetaData*>& files) { return 0; }
+
+  // When a compaction is split into subcompactions by key range, each subcompaction gets its own
+  // filter. Given a candidate user key to split at, returns the key to actually split at, so that
+  // keys a filter has to see together go to the same subcompaction. An empty result means the
+  // compaction should not be split at this candidate.
+  virtual std::string SubcompactionBoundary(const Slice& user_key) { return user_key.ToBuffer(); }
+
   // Returns a name that identifies this compaction filter factory.
   virtual const char* Name() const = 0;
 };
@@ -486,6 +486,16 @@ class DB {
     //      based.
     static const std::string kEstimatePendingCompactionBytes;
 
+    //  "rocksdb.num-sorted-runs" - returns number of sorted runs that trigger
+    //      compaction and write stalls: level-0 files for level compaction,
+    //      all sorted runs for universal compaction.
+    static const std::string kNumSortedRuns;
+
+    //  "rocksdb.compaction-priority" - returns highest priority of the
+    //      compaction tasks of the DB in the priority thread pool, 0 if there
+    //      are none.
+    static const std::string kCompactionPriority;
+
     //  "rocksdb.aggregated-table-properties" - returns a string representation
     //      of the aggregated table properties of the target column family.
     static const std::string kAggregatedTableProperties;
@@ -517,6 +517,7 @@ std::unique_ptr<CompactionFilter> Compaction::CreateCompactionFilter() const {
 
   CompactionFilter::Context context;
   context.is_full_compaction = is_full_compaction_;
+  context.is_bottommost_level = bottommost_level_;
   context.is_manual_compaction = is_manual_compaction_;
   context.column_family_id = cfd_->GetID();
   return cfd_->ioptions()->compaction_filter_factory->CreateCompactionFilter(
@@ -534,7 +535,9 @@ bool Compaction::ShouldFormSubcompactions() const {
   if (cfd_->ioptions()->compaction_style == kCompactionStyleLevel) {
     return start_level_ == 0 && !IsOutputLevelEmpty();
   } else if (IsCompactionStyleUniversal()) {
-    return number_levels_ > 1 && output_level_ > 0;
+    // When all files are in level 0, the outputs of the subcompactions are tagged as a single
+    // sorted run, see CompactionJob::InstallCompactionResults.
+    return !deletion_compaction_ && (output_level_ > 0 || number_levels_ == 1);
   } else {
     return false;
   }
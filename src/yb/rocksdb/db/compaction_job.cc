@@ -49,6 +49,7 @@
 #include "yb/rocksdb/db/memtable_list.h"
 #include "yb/rocksdb/db/merge_context.h"
 #include "yb/rocksdb/db/merge_helper.h"
+#include "yb/rocksdb/db/table_cache.h"
 #include "yb/rocksdb/db/version_set.h"
 #include "yb/rocksdb/port/likely.h"
 #include "yb/rocksdb/port/port.h"
@@ -61,6 +62,7 @@
 #include "yb/rocksdb/table/block_based_table_factory.h"
 #include "yb/rocksdb/table/merger.h"
 #include "yb/rocksdb/table/table_builder.h"
+#include "yb/rocksdb/table/table_reader.h"
 #include "yb/rocksdb/util/coding.h"
 #include "yb/rocksdb/util/file_reader_writer.h"
 #include "yb/rocksdb/util/log_buffer.h"
@@ -115,6 +117,9 @@ struct CompactionJob::SubcompactionState {
     }
   }
 
+  // Frontier reported by the compaction filter of this subcompaction.
+  UserFrontierPtr largest_user_frontier;
+
   // State during the subcompaction
   uint64_t total_bytes;
   uint64_t num_input_records;
@@ -148,6 +153,7 @@ struct CompactionJob::SubcompactionState {
     base_outfile = std::move(o.base_outfile);
     data_outfile = std::move(o.data_outfile);
     builder = std::move(o.builder);
+    largest_user_frontier = std::move(o.largest_user_frontier);
     total_bytes = std::move(o.total_bytes);
     num_input_records = std::move(o.num_input_records);
     num_output_records = std::move(o.num_output_records);
@@ -368,13 +374,34 @@ struct RangeWithSize {
 // each consecutive pair of slices. Then it divides these ranges into
 // consecutive groups such that each group has a similar size.
 void CompactionJob::GenSubcompactionBoundaries() {
+  // Number of keys sampled from each input file per subcompaction, when file boundaries do not
+  // split the key range.
+  constexpr size_t kSampledKeysPerSubcompaction = 4;
+
   auto* c = compact_->compaction;
   auto* cfd = c->column_family_data();
   const Comparator* cfd_comparator = cfd->user_comparator();
-  std::vector<Slice> bounds;
+  auto* compaction_filter_factory = cfd->ioptions()->compaction_filter_factory;
   int start_lvl = c->start_level();
   int out_lvl = c->output_level();
 
+  // The compaction filter factory could move each candidate boundary, so that keys its filters
+  // have to see together are not split between subcompactions. The moved boundaries are owned by
+  // boundary_keys_.
+  auto& bounds = boundary_keys_;
+  auto add_bound = [&bounds, compaction_filter_factory](const Slice& internal_key) {
+    if (compaction_filter_factory == nullptr) {
+      bounds.push_back(internal_key.ToBuffer());
+      return;
+    }
+    auto user_key = compaction_filter_factory->SubcompactionBoundary(
+        ExtractUserKey(internal_key));
+    if (!user_key.empty()) {
+      bounds.push_back(
+          InternalKey(user_key, kMaxSequenceNumber, kValueTypeForSeek).Encode().ToBuffer());
+    }
+  };
+
   // Add the starting and/or ending key of certain input files as a potential
   // boundary
   for (size_t lvl_idx = 0; lvl_idx < c->num_input_levels(); lvl_idx++) {
@@ -391,21 +418,39 @@ void CompactionJob::GenSubcompactionBoundaries() {
         // For level 0 add the starting and ending key of each file since the
         // files may have greatly differing key ranges (not range-partitioned)
         for (size_t i = 0; i < num_files; i++) {
-          bounds.emplace_back(flevel->files[i].smallest.key);
-          bounds.emplace_back(flevel->files[i].largest.key);
+          add_bound(flevel->files[i].smallest.key);
+          add_bound(flevel->files[i].largest.key);
+        }
+        if (out_lvl == 0) {
+          // When all files are in level 0, as with universal compaction, each of them usually
+          // spans the whole key range. So also sample keys from inside of the files.
+          std::vector<std::string> sampled_keys;
+          for (size_t i = 0; i < num_files; i++) {
+            TableReader* table_reader = nullptr;
+            std::unique_ptr<InternalIterator> iter(cfd->table_cache()->NewIterator(
+                ReadOptions(), env_options_, cfd->internal_comparator(), flevel->files[i].fd,
+                &table_reader));
+            if (table_reader != nullptr) {
+              table_reader->SampleKeys(
+                  db_options_.max_subcompactions * kSampledKeysPerSubcompaction, &sampled_keys);
+            }
+          }
+          for (const auto& key : sampled_keys) {
+            add_bound(key);
+          }
         }
       } else {
         // For all other levels add the smallest/largest key in the level to
         // encompass the range covered by that level
-        bounds.emplace_back(flevel->files[0].smallest.key);
-        bounds.emplace_back(flevel->files[num_files - 1].largest.key);
+        add_bound(flevel->files[0].smallest.key);
+        add_bound(flevel->files[num_files - 1].largest.key);
         if (lvl == out_lvl) {
           // For the last level include the starting keys of all files since
           // the last level is the largest and probably has the widest key
           // range. Since it's range partitioned, the ending key of one file
           // and the starting key of the next are very close (or identical).
           for (size_t i = 1; i < num_files; i++) {
-            bounds.emplace_back(flevel->files[i].smallest.key);
+            add_bound(flevel->files[i].smallest.key);
           }
         }
       }
@@ -422,6 +467,12 @@ void CompactionJob::GenSubcompactionBoundaries() {
       return cfd_comparator->Compare(ExtractUserKey(a), ExtractUserKey(b)) == 0;
     }), bounds.end());
 
+  if (bounds.size() < 2) {
+    // No range to split.
+    sizes_.emplace_back(c->CalculateTotalInputSize());
+    return;
+  }
+
   // Combine consecutive pairs of boundaries into ranges with an approximate
   // size of data covered by keys in that range
   uint64_t sum = 0;
@@ -443,13 +494,22 @@ void CompactionJob::GenSubcompactionBoundaries() {
 
   // Group the ranges into subcompactions
   const double min_file_fill_percent = 4.0 / 5;
-  uint64_t max_output_files = static_cast<uint64_t>(std::ceil(
-      sum / min_file_fill_percent /
-      cfd->GetCurrentMutableCFOptions()->MaxFileSizeForLevel(out_lvl)));
+  const uint64_t max_file_size =
+      cfd->GetCurrentMutableCFOptions()->MaxFileSizeForLevel(out_lvl);
+  uint64_t max_output_files = std::numeric_limits<uint64_t>::max();
+  if (max_file_size != std::numeric_limits<uint64_t>::max()) {
+    max_output_files = static_cast<uint64_t>(std::ceil(
+        sum / min_file_fill_percent / max_file_size));
+  }
+  uint64_t max_subcompactions_by_size = std::numeric_limits<uint64_t>::max();
+  if (db_options_.min_subcompaction_size > 0) {
+    max_subcompactions_by_size = std::max<uint64_t>(1, sum / db_options_.min_subcompaction_size);
+  }
   uint64_t subcompactions =
       std::min({static_cast<uint64_t>(ranges.size()),
                 static_cast<uint64_t>(db_options_.max_subcompactions),
-                max_output_files});
+                max_output_files,
+                max_subcompactions_by_size});
 
   double mean = subcompactions != 0 ? sum * 1.0 / subcompactions
                                     : std::numeric_limits<double>::max();
@@ -660,7 +720,7 @@ void CompactionJob::ProcessKeyValueCompaction(
   if (compaction_filter) {
     // This is used to persist the history cutoff hybrid time chosen for the DocDB compaction
     // filter.
-    largest_user_frontier_ = compaction_filter->GetLargestUserFrontier();
+    sub_compact->largest_user_frontier = compaction_filter->GetLargestUserFrontier();
   }
 
   MergeHelper merge(
@@ -972,13 +1032,32 @@ Status CompactionJob::InstallCompactionResults(
   // Add compaction outputs
   compaction->AddInputDeletions(compaction->edit());
 
+  // The outputs of subcompactions into level 0 have disjoint key ranges but overlapping seqno
+  // ranges, so they are tagged as a single sorted run, named after the first of them.
+  uint64_t sorted_run_id = 0;
+  if (compaction->output_level() == 0 && compact_->sub_compact_states.size() > 1) {
+    for (const auto& sub_compact : compact_->sub_compact_states) {
+      for (const auto& out : sub_compact.outputs) {
+        if (sorted_run_id == 0 || out.meta.fd.GetNumber() < sorted_run_id) {
+          sorted_run_id = out.meta.fd.GetNumber();
+        }
+      }
+    }
+  }
+
   for (const auto& sub_compact : compact_->sub_compact_states) {
     for (const auto& out : sub_compact.outputs) {
-      compaction->edit()->AddFile(compaction->output_level(), out.meta);
+      if (sorted_run_id != 0) {
+        auto meta = out.meta;
+        meta.sorted_run_id = sorted_run_id;
+        compaction->edit()->AddFile(compaction->output_level(), meta);
+      } else {
+        compaction->edit()->AddFile(compaction->output_level(), out.meta);
+      }
+    }
+    if (sub_compact.largest_user_frontier) {
+      compaction->edit()->UpdateFlushedFrontier(sub_compact.largest_user_frontier);
     }
-  }
-  if (largest_user_frontier_) {
-    compaction->edit()->UpdateFlushedFrontier(largest_user_frontier_);
   }
   return versions_->LogAndApply(compaction->column_family_data(),
                                 mutable_cf_options, compaction->edit(),
@@ -1050,8 +1129,11 @@ Status CompactionJob::OpenCompactionOutputFile(
       if (preallocation_block_size > 0) {
         (*writable_file)->SetPreallocationBlockSize(preallocation_block_size);
       }
-      writer->reset(new WritableFileWriter(
-          std::move(*writable_file), env_options_, sub_compact->compaction->suspender()));
+      // The suspender pauses the thread pool worker it is called from, so only the first
+      // subcompaction, which runs in the worker thread, could use it.
+      auto* suspender = sub_compact == &compact_->sub_compact_states.front()
+          ? sub_compact->compaction->suspender() : nullptr;
+      writer->reset(new WritableFileWriter(std::move(*writable_file), env_options_, suspender));
     };
 
     const bool is_split_sst = cfd->ioptions()->table_factory->IsSplitSstForWriteSupported();
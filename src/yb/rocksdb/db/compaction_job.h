@@ -185,8 +185,8 @@ class CompactionJob {
   std::vector<Slice> boundaries_;
   // Stores the approx size of keys covered in the range of each subcompaction
   std::vector<uint64_t> sizes_;
-
-  UserFrontierPtr largest_user_frontier_;
+  // Owns the candidate boundaries, as internal keys, that boundaries_ are picked from.
+  std::vector<std::string> boundary_keys_;
 };
 
 }  // namespace rocksdb
@@ -1162,6 +1162,18 @@ struct UniversalCompactionPicker::SortedRun {
     assert(compensated_file_size > 0);
     // Allowed either one of level and file.
     assert((level != 0) != (file != nullptr));
+    if (file != nullptr) {
+      files.push_back(file);
+    }
+  }
+
+  // Adds a level 0 file that belongs to the same sorted run as `file`.
+  void AddFile(FileMetaData* f) {
+    assert(file->InSameSortedRun(*f));
+    files.push_back(f);
+    size += f->fd.GetTotalFileSize();
+    compensated_file_size += f->compensated_file_size;
+    being_compacted = being_compacted || f->being_compacted;
   }
 
   void Dump(char* out_buf, size_t out_buf_size,
@@ -1173,8 +1185,10 @@ struct UniversalCompactionPicker::SortedRun {
 
   int level;
   // `file` Will be null for level > 0. For level = 0, the sorted run is
-  // for this file.
+  // for this file, and the other files written with it by a compaction split into
+  // subcompactions, which are all in `files`.
   FileMetaData* file;
+  std::vector<FileMetaData*> files;
   // For level > 0, `size` and `compensated_file_size` are sum of sizes all
   // files in the level. `being_compacted` should be the same for all files
   // in a non-zero level. Use the value here.
@@ -1188,13 +1202,17 @@ void UniversalCompactionPicker::SortedRun::Dump(char* out_buf,
                                                 bool print_path) const {
   if (level == 0) {
     assert(file != nullptr);
+    int written;
     if (file->fd.GetPathId() == 0 || !print_path) {
-      snprintf(out_buf, out_buf_size, "file %" PRIu64, file->fd.GetNumber());
+      written = snprintf(out_buf, out_buf_size, "file %" PRIu64, file->fd.GetNumber());
     } else {
-      snprintf(out_buf, out_buf_size, "file %" PRIu64
-                                      "(path "
-                                      "%" PRIu32 ")",
-               file->fd.GetNumber(), file->fd.GetPathId());
+      written = snprintf(out_buf, out_buf_size, "file %" PRIu64
+                                                "(path "
+                                                "%" PRIu32 ")",
+                         file->fd.GetNumber(), file->fd.GetPathId());
+    }
+    if (files.size() > 1 && written >= 0 && static_cast<size_t>(written) < out_buf_size) {
+      snprintf(out_buf + written, out_buf_size - written, "+%" ROCKSDB_PRIszt, files.size() - 1);
     }
   } else {
     snprintf(out_buf, out_buf_size, "level %d", level);
@@ -1206,11 +1224,11 @@ void UniversalCompactionPicker::SortedRun::DumpSizeInfo(
   if (level == 0) {
     assert(file != nullptr);
     snprintf(out_buf, out_buf_size,
-             "file %" PRIu64 "[%" ROCKSDB_PRIszt
+             "file %" PRIu64 "+%" ROCKSDB_PRIszt "[%" ROCKSDB_PRIszt
              "] "
              "with size %" PRIu64 " (compensated size %" PRIu64 ")",
-             file->fd.GetNumber(), sorted_run_count, file->fd.GetTotalFileSize(),
-             file->compensated_file_size);
+             file->fd.GetNumber(), files.size() - 1, sorted_run_count, size,
+             compensated_file_size);
   } else {
     snprintf(out_buf, out_buf_size,
              "level %d[%" ROCKSDB_PRIszt
@@ -1225,10 +1243,18 @@ std::vector<std::vector<UniversalCompactionPicker::SortedRun>>
                                                    const ImmutableCFOptions& ioptions,
                                                    uint64_t max_file_size) {
   std::vector<std::vector<SortedRun>> ret(1);
-  for (FileMetaData* f : vstorage.LevelFiles(0)) {
-    if (f->fd.GetTotalFileSize() <= max_file_size) {
-      ret.back().emplace_back(0, f, f->fd.GetTotalFileSize(), f->compensated_file_size,
-          f->being_compacted);
+  const auto& level0_files = vstorage.LevelFiles(0);
+  for (size_t i = 0; i != level0_files.size(); ++i) {
+    FileMetaData* f = level0_files[i];
+    SortedRun sorted_run(0, f, f->fd.GetTotalFileSize(), f->compensated_file_size,
+                         f->being_compacted);
+    // Files written by a compaction split into subcompactions are adjacent in level 0, and are
+    // picked together as a single sorted run.
+    while (i + 1 != level0_files.size() && level0_files[i + 1]->InSameSortedRun(*f)) {
+      sorted_run.AddFile(level0_files[++i]);
+    }
+    if (sorted_run.size <= max_file_size) {
+      ret.back().push_back(std::move(sorted_run));
     // If last sequence is empty it means that there are multiple too-large-to-compact files in
     // a row. So we just don't start new sequence in this case.
     } else if (!ret.back().empty()) {
@@ -1353,6 +1379,12 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::PickCompaction(
     const MutableCFOptions& mutable_cf_options,
     VersionStorageInfo* vstorage,
     LogBuffer* log_buffer) {
+  auto expired_files_deletion = PickExpiredFilesDeletion(
+      cf_name, mutable_cf_options, vstorage, log_buffer);
+  if (expired_files_deletion) {
+    return expired_files_deletion;
+  }
+
   std::vector<std::vector<SortedRun>> sorted_runs = CalculateSortedRuns(
       *vstorage,
       ioptions_,
@@ -1455,14 +1487,29 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::DoPickCompaction(
 
   size_t level_index = 0U;
   if (c->start_level() == 0) {
+    // Files of the same sorted run have overlapping seqno ranges, so each file is compared with
+    // the smallest seqno of the whole previous sorted run.
+    SequenceNumber run_smallest_seqno = 0U;
+    const FileMetaData* prev = nullptr;
     for (auto f : *c->inputs(0)) {
       DCHECK_LE(f->smallest.seqno, f->largest.seqno);
-      if (is_first) {
-        is_first = false;
+      if (prev == nullptr || !f->InSameSortedRun(*prev)) {
+        if (prev != nullptr) {
+          is_first = false;
+          prev_smallest_seqno = run_smallest_seqno;
+        }
+        run_smallest_seqno = f->smallest.seqno;
       } else {
+        run_smallest_seqno = std::min(run_smallest_seqno, f->smallest.seqno);
+      }
+      if (!is_first) {
         DCHECK_GT(prev_smallest_seqno, f->largest.seqno);
       }
-      prev_smallest_seqno = f->smallest.seqno;
+      prev = f;
+    }
+    if (prev != nullptr) {
+      is_first = false;
+      prev_smallest_seqno = run_smallest_seqno;
     }
     level_index = 1U;
   }
@@ -1496,6 +1543,50 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::DoPickCompaction(
   return c;
 }
 
+std::unique_ptr<Compaction> UniversalCompactionPicker::PickExpiredFilesDeletion(
+    const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
+    VersionStorageInfo* vstorage, LogBuffer* log_buffer) {
+  const int kLevel0 = 0;
+  // Files of other levels are older than the ones of level 0, and would have to be deleted first.
+  if (ioptions_.compaction_filter_factory == nullptr || vstorage->num_non_empty_levels() > 1) {
+    return nullptr;
+  }
+  const std::vector<FileMetaData*>& level_files = vstorage->LevelFiles(kLevel0);
+  if (level_files.empty()) {
+    return nullptr;
+  }
+  const size_t num_expired = std::min(
+      ioptions_.compaction_filter_factory->NumExpiredFiles(level_files), level_files.size());
+
+  std::vector<CompactionInputFiles> inputs(1);
+  inputs[0].level = kLevel0;
+  // The newer files are deleted only along with all the older ones, a file being compacted stops
+  // the deletion.
+  for (auto ritr = level_files.rbegin(); ritr != level_files.rbegin() + num_expired; ++ritr) {
+    FileMetaData* f = *ritr;
+    if (f->being_compacted) {
+      break;
+    }
+    inputs[0].files.push_back(f);
+    char tmp_fsize[16];
+    AppendHumanBytes(f->fd.GetTotalFileSize(), tmp_fsize, sizeof(tmp_fsize));
+    LOG_TO_BUFFER(log_buffer, "[%s] Universal: picking expired file %" PRIu64
+                              " with size %s for deletion",
+                  cf_name.c_str(), f->fd.GetNumber(), tmp_fsize);
+  }
+  if (inputs[0].files.empty()) {
+    return nullptr;
+  }
+  auto c = std::make_unique<Compaction>(
+      vstorage, mutable_cf_options, std::move(inputs), kLevel0 /* output_level */,
+      0 /* target_file_size */, 0 /* max_grandparent_overlap_bytes */, 0 /* output_path_id */,
+      kNoCompression, std::vector<FileMetaData*>(), /* is manual */ false,
+      vstorage->CompactionScore(kLevel0),
+      /* is deletion compaction */ true, CompactionReason::kUniversalExpiredFiles);
+  level0_compactions_in_progress_.insert(c.get());
+  return c;
+}
+
 uint32_t UniversalCompactionPicker::GetPathId(
     const ImmutableCFOptions& ioptions, uint64_t file_size) {
   // Two conditions need to be satisfied:
@@ -1692,8 +1783,8 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::PickCompactionUniversalRe
   for (size_t i = start_index; i < first_index_after; i++) {
     auto& picking_sr = sorted_runs[i];
     if (picking_sr.level == 0) {
-      FileMetaData* picking_file = picking_sr.file;
-      inputs[0].files.push_back(picking_file);
+      inputs[0].files.insert(
+          inputs[0].files.end(), picking_sr.files.begin(), picking_sr.files.end());
     } else {
       auto& files = inputs[picking_sr.level - start_level].files;
       for (auto* f : vstorage->LevelFiles(picking_sr.level)) {
@@ -1818,8 +1909,8 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::PickCompactionUniversalSi
   for (size_t loop = start_index; loop < sorted_runs.size(); loop++) {
     auto& picking_sr = sorted_runs[loop];
     if (picking_sr.level == 0) {
-      FileMetaData* f = picking_sr.file;
-      inputs[0].files.push_back(f);
+      inputs[0].files.insert(
+          inputs[0].files.end(), picking_sr.files.begin(), picking_sr.files.end());
     } else {
       auto& files = inputs[picking_sr.level - start_level].files;
       for (auto* f : vstorage->LevelFiles(picking_sr.level)) {
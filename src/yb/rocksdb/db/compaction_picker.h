@@ -271,6 +271,12 @@ class UniversalCompactionPicker : public CompactionPicker {
       LogBuffer* log_buffer,
       const std::vector<SortedRun>& sorted_runs);
 
+  // Pick the oldest files that the compaction filter factory reports as expired, to be deleted
+  // without being compacted.
+  std::unique_ptr<Compaction> PickExpiredFilesDeletion(
+      const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
+      VersionStorageInfo* vstorage, LogBuffer* log_buffer);
+
   // Pick Universal compaction to limit read amplification
   std::unique_ptr<Compaction> PickCompactionUniversalReadAmp(
       const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
@@ -154,6 +154,25 @@ DEFINE_int32(compaction_priority_step_size, 5,
 DEFINE_int32(small_compaction_extra_priority, 1,
              "Small compaction will get small_compaction_extra_priority extra priority.");
 
+DEFINE_int32(compaction_priority_write_stall_bound, 20,
+             "Compaction task of DB that has at least this number of SST files, i.e. that is close "
+             "to having its writes rejected by sst_files_soft_limit, or whose writes are stopped or "
+             "delayed, will get write_stall_compaction_extra_priority extra priority. 0 to only "
+             "take stopped or delayed writes into account.");
+
+DEFINE_int32(write_stall_compaction_extra_priority, 5,
+             "Compaction of DB whose writes are stalled or about to be stalled will get "
+             "write_stall_compaction_extra_priority extra priority.");
+
+DEFINE_int32(reclaim_space_compaction_min_deletes_percent, 30,
+             "Compaction whose input files have at least this percent of deletion entries is "
+             "considered to reclaim space.");
+
+DEFINE_int32(reclaim_space_compaction_extra_priority, 1,
+             "Compaction that deletes whole files, e.g. files with expired records, or whose input "
+             "files have at least reclaim_space_compaction_min_deletes_percent percent of deletion "
+             "entries will get reclaim_space_compaction_extra_priority extra priority.");
+
 namespace rocksdb {
 
 namespace {
@@ -326,9 +345,43 @@ class DBImpl::CompactionTask : public ThreadPoolTask {
       result += FLAGS_small_compaction_extra_priority;
     }
 
+    if (WritesStalled(*current_version->storage_info())) {
+      result += FLAGS_write_stall_compaction_extra_priority;
+    }
+
+    if (ReclaimsSpace()) {
+      result += FLAGS_reclaim_space_compaction_extra_priority;
+    }
+
     return result;
   }
 
+  bool WritesStalled(const VersionStorageInfo& vstorage) const {
+    const auto& write_controller = db_impl_->write_controller_;
+    if (write_controller.IsStopped() || write_controller.NeedsDelay()) {
+      return true;
+    }
+    const auto bound = FLAGS_compaction_priority_write_stall_bound;
+    return bound > 0 && vstorage.NumFiles() >= static_cast<uint64_t>(bound);
+  }
+
+  bool ReclaimsSpace() const {
+    if (compaction_->deletion_compaction()) {
+      return true;
+    }
+    uint64_t num_entries = 0;
+    uint64_t num_deletions = 0;
+    for (size_t level = 0; level != compaction_->num_input_levels(); ++level) {
+      for (const auto* file : *compaction_->inputs(level)) {
+        num_entries += file->num_entries;
+        num_deletions += file->num_deletions;
+      }
+    }
+    const auto min_deletes_percent =
+        static_cast<uint64_t>(FLAGS_reclaim_space_compaction_min_deletes_percent);
+    return num_entries != 0 && num_deletions * 100 >= num_entries * min_deletes_percent;
+  }
+
   // Only one of manual_compaction_ and compaction_ could be non null.
   DBImpl::ManualCompaction* const manual_compaction_;
   std::unique_ptr<Compaction> compaction_holder_;
@@ -3071,6 +3124,15 @@ bool DBImpl::IsLargeCompaction(const Compaction& compaction) {
   return compaction.CalculateTotalInputSize() >= db_options_.compaction_size_threshold_bytes;
 }
 
+int DBImpl::MaxCompactionTaskPriority() {
+  mutex_.AssertHeld();
+  int result = 0;
+  for (auto* task : compaction_tasks_) {
+    result = std::max(result, task->Priority());
+  }
+  return result;
+}
+
 void DBImpl::AddToFlushQueue(ColumnFamilyData* cfd) {
   assert(!cfd->pending_flush());
   cfd->Ref();
@@ -3505,8 +3567,8 @@ Result<FileNumbersHolder> DBImpl::BackgroundCompaction(
     // file if there is alive snapshot pointing to it
     assert(c->num_input_files(1) == 0);
     assert(c->level() == 0);
-    assert(c->column_family_data()->ioptions()->compaction_style ==
-           kCompactionStyleFIFO);
+    assert(c->column_family_data()->ioptions()->compaction_style == kCompactionStyleFIFO ||
+           c->column_family_data()->ioptions()->compaction_style == kCompactionStyleUniversal);
 
     compaction_job_stats.num_input_files = c->num_input_files(0);
 
@@ -664,6 +664,10 @@ class DBImpl : public DB {
   // Compaction is marked as large based on options, so cannot be static or free function.
   bool IsLargeCompaction(const Compaction& compaction);
 
+  // Returns highest priority of compaction tasks of this DB, 0 if there are none.
+  // REQUIRES: mutex locked.
+  int MaxCompactionTaskPriority();
+
   // helper function to call after some of the logs_ were synced
   void MarkLogsSynced(uint64_t up_to, bool synced_dir, const Status& status);
 
@@ -24,6 +24,7 @@
 #include <stdio.h>
 
 #include <algorithm>
+#include <mutex>
 #include <string>
 
 #include "yb/rocksdb/db/db_test_util.h"
@@ -33,6 +34,10 @@
 #include "yb/rocksdb/table.h"
 #include "yb/rocksdb/util/random.h"
 
+#include "yb/util/countdown_latch.h"
+#include "yb/util/priority_thread_pool.h"
+#include "yb/util/test_util.h"
+
 namespace rocksdb {
 
 class DBPropertiesTest : public DBTestBase {
@@ -900,6 +905,179 @@ TEST_F(DBPropertiesTest, EstimatePendingCompBytes) {
       "rocksdb.estimate-pending-compaction-bytes", &int_num));
   ASSERT_EQ(int_num, 0U);
 }
+
+TEST_F(DBPropertiesTest, NumSortedRuns) {
+  env_->SetBackgroundThreads(1, Env::LOW);
+  test::SleepingBackgroundTask sleeping_task_low;
+  env_->Schedule(&test::SleepingBackgroundTask::DoSleepTask, &sleeping_task_low,
+                 Env::Priority::LOW);
+
+  Options options = CurrentOptions();
+  options.compaction_style = kCompactionStyleUniversal;
+  options.num_levels = 1;
+  options.level0_file_num_compaction_trigger = 2;
+  options.max_background_compactions = 1;
+  Reopen(options);
+
+  uint64_t int_num;
+  ASSERT_TRUE(dbfull()->GetIntProperty(DB::Properties::kNumSortedRuns, &int_num));
+  ASSERT_EQ(int_num, 0U);
+
+  for (int i = 1; i <= 3; ++i) {
+    ASSERT_OK(Put(Key(i), "value"));
+    ASSERT_OK(Flush());
+    ASSERT_TRUE(dbfull()->GetIntProperty(DB::Properties::kNumSortedRuns, &int_num));
+    ASSERT_EQ(int_num, static_cast<uint64_t>(i));
+  }
+  // Compactions are not run by a priority thread pool.
+  ASSERT_TRUE(dbfull()->GetIntProperty(DB::Properties::kCompactionPriority, &int_num));
+  ASSERT_EQ(int_num, 0U);
+
+  sleeping_task_low.WakeUp();
+  sleeping_task_low.WaitUntilDone();
+
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_TRUE(dbfull()->GetIntProperty(DB::Properties::kNumSortedRuns, &int_num));
+  ASSERT_EQ(int_num, 1U);
+}
+
+namespace {
+
+// Occupies a worker of a priority thread pool until released.
+class BlockingPoolTask : public yb::PriorityThreadPoolTask {
+ public:
+  BlockingPoolTask(yb::CountDownLatch* started, yb::CountDownLatch* release)
+      : started_(started), release_(release) {}
+
+  void Run(const Status& status, yb::PriorityThreadPoolSuspender* suspender) override {
+    started_->CountDown();
+    if (status.ok()) {
+      release_->Wait();
+    }
+  }
+
+  bool BelongsTo(void* key) override {
+    return false;
+  }
+
+  std::string ToString() const override {
+    return "BlockingPoolTask";
+  }
+
+ private:
+  yb::CountDownLatch* const started_;
+  yb::CountDownLatch* const release_;
+};
+
+// Records the names of the DBs in the order their compactions complete.
+class CompactionOrderListener : public EventListener {
+ public:
+  void OnCompactionCompleted(DB* db, const CompactionJobInfo& ci) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    db_names_.push_back(db->GetName());
+  }
+
+  std::vector<std::string> db_names() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return db_names_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::string> db_names_;
+};
+
+Status ReopenFresh(const Options& options, const std::string& name, std::unique_ptr<DB>* db) {
+  RETURN_NOT_OK(DestroyDB(name, options));
+  DB* raw_db = nullptr;
+  RETURN_NOT_OK(DB::Open(options, name, &raw_db));
+  db->reset(raw_db);
+  return Status::OK();
+}
+
+uint64_t CompactionPriority(DB* db) {
+  uint64_t result = 0;
+  EXPECT_TRUE(db->GetIntProperty(DB::Properties::kCompactionPriority, &result));
+  return result;
+}
+
+} // namespace
+
+// Compactions of DBs whose writes are stalled and of DBs with much reclaimable space should be
+// picked by the shared priority thread pool ahead of a plain size ratio compaction.
+TEST_F(DBPropertiesTest, StalledAndReclaimingCompactionsGoFirst) {
+  constexpr int kNumKeys = 100;
+  constexpr int kBlockingTaskPriority = 1000;
+
+  yb::PriorityThreadPool thread_pool(1);
+  yb::CountDownLatch started(1);
+  yb::CountDownLatch release(1);
+  auto blocking_task = std::make_unique<BlockingPoolTask>(&started, &release);
+  ASSERT_OK(thread_pool.Submit(kBlockingTaskPriority, &blocking_task));
+  started.Wait();
+
+  auto listener = std::make_shared<CompactionOrderListener>();
+  Options options = CurrentOptions();
+  options.compaction_style = kCompactionStyleUniversal;
+  options.num_levels = 1;
+  options.level0_file_num_compaction_trigger = 2;
+  options.priority_thread_pool_for_compactions_and_flushes = &thread_pool;
+  options.listeners.push_back(listener);
+
+  // Writes of this DB are delayed as soon as it has enough files to be compacted.
+  Options stalled_options = options;
+  stalled_options.level0_slowdown_writes_trigger = 2;
+  stalled_options.level0_stop_writes_trigger = 10;
+
+  const std::string plain_name = dbname_ + "_plain";
+  const std::string stalled_name = dbname_ + "_stalled";
+  const std::string reclaiming_name = dbname_ + "_reclaiming";
+  std::unique_ptr<DB> plain_db;
+  std::unique_ptr<DB> stalled_db;
+  std::unique_ptr<DB> reclaiming_db;
+  ASSERT_OK(ReopenFresh(options, plain_name, &plain_db));
+  ASSERT_OK(ReopenFresh(stalled_options, stalled_name, &stalled_db));
+  ASSERT_OK(ReopenFresh(options, reclaiming_name, &reclaiming_db));
+
+  for (auto* db : {plain_db.get(), stalled_db.get(), reclaiming_db.get()}) {
+    for (int i = 0; i != kNumKeys; ++i) {
+      ASSERT_OK(db->Put(WriteOptions(), Key(i), "value"));
+    }
+    ASSERT_OK(db->Flush(FlushOptions()));
+  }
+  for (auto* db : {plain_db.get(), stalled_db.get()}) {
+    for (int i = kNumKeys; i != 2 * kNumKeys; ++i) {
+      ASSERT_OK(db->Put(WriteOptions(), Key(i), "value"));
+    }
+    ASSERT_OK(db->Flush(FlushOptions()));
+  }
+  // Half of the input entries of the compaction of this DB are deletions.
+  for (int i = 0; i != kNumKeys; ++i) {
+    ASSERT_OK(reclaiming_db->Delete(WriteOptions(), Key(i)));
+  }
+  ASSERT_OK(reclaiming_db->Flush(FlushOptions()));
+
+  const auto plain_priority = CompactionPriority(plain_db.get());
+  ASSERT_GT(plain_priority, 0U);
+  ASSERT_GT(CompactionPriority(stalled_db.get()), plain_priority);
+  ASSERT_GT(CompactionPriority(reclaiming_db.get()), plain_priority);
+
+  release.CountDown();
+  ASSERT_OK(yb::WaitFor([&listener] {
+    return listener->db_names().size() >= 3;
+  }, yb::MonoDelta::FromSeconds(60), "Compactions"));
+
+  // The write stall priority is higher than the reclaimable space one.
+  const std::vector<std::string> expected_order = {stalled_name, reclaiming_name, plain_name};
+  ASSERT_EQ(expected_order, listener->db_names());
+
+  plain_db.reset();
+  stalled_db.reset();
+  reclaiming_db.reset();
+  for (const auto& name : expected_order) {
+    ASSERT_OK(DestroyDB(name, options));
+  }
+}
 #endif  // ROCKSDB_LITE
 
 class CountingUserTblPropCollector : public TablePropertiesCollector {
@@ -1474,6 +1474,66 @@ TEST_F(DBTestUniversalCompaction, IncludeFilesSmallerThanThreshold) {
   GenerateFilesAndCheckCompactionResult(options, file_sizes, value_size, 1);
 }
 
+TEST_F(DBTestUniversalCompaction, Subcompactions) {
+  constexpr int kNumKeys = 1000;
+  constexpr int kNumFiles = 4;
+  Options options;
+  options.compaction_style = kCompactionStyleUniversal;
+  options.num_levels = 1;
+  options.write_buffer_size = 10_MB;
+  options.disable_auto_compactions = true;
+  options.max_subcompactions = 4;
+  options = CurrentOptions(options);
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  std::vector<std::string> values(kNumKeys);
+  auto write_files = [&] {
+    for (int file = 0; file < kNumFiles; ++file) {
+      for (int i = 0; i < kNumKeys; ++i) {
+        values[i] = RandomString(&rnd, 100);
+        ASSERT_OK(Put(Key(i), values[i]));
+      }
+      ASSERT_OK(Flush());
+    }
+  };
+
+  write_files();
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+
+  // The compaction is split into files with disjoint key ranges, that form a single sorted run.
+  std::vector<LiveFileMetaData> files;
+  db_->GetLiveFilesMetaData(&files);
+  ASSERT_GT(files.size(), 1U);
+  std::sort(files.begin(), files.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.smallest.key < rhs.smallest.key;
+  });
+  for (size_t i = 0; i != files.size(); ++i) {
+    ASSERT_EQ(0, files[i].level);
+    ASSERT_NE(0U, files[i].sorted_run_id);
+    ASSERT_EQ(files[0].sorted_run_id, files[i].sorted_run_id);
+    if (i > 0) {
+      ASSERT_LT(files[i - 1].largest.key, files[i].smallest.key);
+    }
+  }
+  for (int i = 0; i < kNumKeys; ++i) {
+    ASSERT_EQ(values[i], Get(Key(i)));
+  }
+
+  // The sorted run is compacted as a whole with newer files, also after reopening the DB.
+  Reopen(options);
+  write_files();
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  for (int i = 0; i < kNumKeys; ++i) {
+    ASSERT_EQ(values[i], Get(Key(i)));
+  }
+  std::vector<LiveFileMetaData> new_files;
+  db_->GetLiveFilesMetaData(&new_files);
+  for (const auto& file : new_files) {
+    ASSERT_NE(files[0].sorted_run_id, file.sorted_run_id);
+  }
+}
+
 }  // namespace rocksdb
 
 #endif  // !defined(ROCKSDB_LITE)
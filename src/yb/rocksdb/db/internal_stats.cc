@@ -159,6 +159,8 @@ static const std::string aggregated_table_properties_at_level =
     aggregated_table_properties + "-at-level";
 static const std::string num_running_compactions = "num-running-compactions";
 static const std::string num_running_flushes = "num-running-flushes";
+static const std::string num_sorted_runs = "num-sorted-runs";
+static const std::string compaction_priority = "compaction-priority";
 
 const std::string DB::Properties::kNumFilesAtLevelPrefix =
                       rocksdb_prefix + num_files_at_level_prefix;
@@ -216,6 +218,10 @@ const std::string DB::Properties::kTotalSstFilesSize =
 const std::string DB::Properties::kBaseLevel = rocksdb_prefix + base_level;
 const std::string DB::Properties::kEstimatePendingCompactionBytes =
     rocksdb_prefix + estimate_pending_comp_bytes;
+const std::string DB::Properties::kNumSortedRuns =
+    rocksdb_prefix + num_sorted_runs;
+const std::string DB::Properties::kCompactionPriority =
+    rocksdb_prefix + compaction_priority;
 const std::string DB::Properties::kAggregatedTableProperties =
     rocksdb_prefix + aggregated_table_properties;
 const std::string DB::Properties::kAggregatedTablePropertiesAtLevel =
@@ -286,6 +292,10 @@ const std::unordered_map<std::string,
      {false, nullptr, &InternalStats::HandleNumRunningFlushes}},
     {DB::Properties::kNumRunningCompactions,
      {false, nullptr, &InternalStats::HandleNumRunningCompactions}},
+    {DB::Properties::kNumSortedRuns,
+     {false, nullptr, &InternalStats::HandleNumSortedRuns}},
+    {DB::Properties::kCompactionPriority,
+     {false, nullptr, &InternalStats::HandleCompactionPriority}},
 };
 
 const DBPropertyInfo* GetPropertyInfo(const Slice& property) {
@@ -450,6 +460,18 @@ bool InternalStats::HandleNumRunningCompactions(uint64_t* value, DBImpl* db,
   return true;
 }
 
+bool InternalStats::HandleNumSortedRuns(uint64_t* value, DBImpl* db,
+                                        Version* version) {
+  *value = cfd_->current()->storage_info()->l0_delay_trigger_count();
+  return true;
+}
+
+bool InternalStats::HandleCompactionPriority(uint64_t* value, DBImpl* db,
+                                             Version* version) {
+  *value = db->MaxCompactionTaskPriority();
+  return true;
+}
+
 bool InternalStats::HandleBackgroundErrors(uint64_t* value, DBImpl* db,
                                            Version* version) {
   // Accumulated number of  errors in background flushes or compactions.
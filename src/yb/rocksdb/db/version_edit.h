@@ -98,6 +98,11 @@ struct FileMetaData {
   BoundaryValues largest;   // The largest values in this file
   bool imported = false;    // Was this file imported from another DB.
 
+  // Non-zero for the output files of a compaction that was split into subcompactions by key range.
+  // Such files have disjoint key ranges but overlapping seqno ranges, so together they form a
+  // single sorted run.
+  uint64_t sorted_run_id = 0;
+
   // Needs to be disposed when refs becomes 0.
   Cache::Handle* table_reader_handle;
 
@@ -130,6 +135,11 @@ struct FileMetaData {
 
   bool Unref(TableCache* table_cache);
 
+  // Whether this file and other were written by the same compaction split into subcompactions.
+  bool InSameSortedRun(const FileMetaData& other) const {
+    return sorted_run_id != 0 && sorted_run_id == other.sorted_run_id;
+  }
+
   std::string ToString() const;
 };
 
@@ -199,6 +209,7 @@ class VersionEdit {
     }
     nf.marked_for_compaction = f.marked_for_compaction;
     nf.imported = f.imported;
+    nf.sorted_run_id = f.sorted_run_id;
     new_files_.emplace_back(level, std::move(nf));
   }
 
@@ -1242,10 +1242,14 @@ void VersionStorageInfo::ComputeCompactionScore(
       // overwrites/deletions).
       int num_sorted_runs = 0;
       uint64_t total_size = 0;
+      const FileMetaData* prev = nullptr;
       for (auto* f : files_[level]) {
         if (!f->being_compacted) {
           total_size += f->compensated_file_size;
-          num_sorted_runs++;
+          if (prev == nullptr || !f->InSameSortedRun(*prev)) {
+            num_sorted_runs++;
+          }
+          prev = f;
         }
       }
       if (compaction_style_ == kCompactionStyleUniversal) {
@@ -1879,14 +1883,17 @@ void VersionStorageInfo::CalculateBaseBytes(const ImmutableCFOptions& ioptions,
   // Special logic to set number of sorted runs.
   // It is to match the previous behavior when all files are in L0.
   int num_l0_count = 0;
-  if (options.max_file_size_for_compaction == std::numeric_limits<uint64_t>::max()) {
-    num_l0_count = static_cast<int>(files_[0].size());
-  } else {
-    for (const auto& file : files_[0]) {
-      if (file->fd.GetTotalFileSize() <= options.max_file_size_for_compaction) {
-        ++num_l0_count;
-      }
+  uint64_t sorted_run_size = 0;
+  for (size_t i = 0; i != files_[0].size(); ++i) {
+    const auto* file = files_[0][i];
+    sorted_run_size += file->fd.GetTotalFileSize();
+    if (i + 1 != files_[0].size() && files_[0][i + 1]->InSameSortedRun(*file)) {
+      continue;
+    }
+    if (sorted_run_size <= options.max_file_size_for_compaction) {
+      ++num_l0_count;
     }
+    sorted_run_size = 0;
   }
   if (compaction_style_ == kCompactionStyleUniversal) {
     // For universal compaction, we use level0 score to indicate
@@ -2840,6 +2847,22 @@ Status VersionSet::Import(const std::string& source_dir,
   }
   std::vector<FileMetaData> files;
   std::vector<std::pair<SequenceNumber, SequenceNumber>> segments;
+  // The files of a sorted run written by a compaction split into subcompactions have overlapping
+  // seqno ranges, so each such run is checked as a single segment.
+  std::unordered_map<uint64_t, size_t> sorted_run_segments;
+  auto add_segment = [&segments, &sorted_run_segments](
+      uint64_t sorted_run_id, SequenceNumber smallest, SequenceNumber largest) {
+    if (sorted_run_id != 0) {
+      auto it = sorted_run_segments.emplace(sorted_run_id, segments.size()).first;
+      if (it->second != segments.size()) {
+        auto& segment = segments[it->second];
+        segment.first = std::min(segment.first, smallest);
+        segment.second = std::max(segment.second, largest);
+        return;
+      }
+    }
+    segments.emplace_back(smallest, largest);
+  };
   for (;;) {
     status = manifest_reader.Next();
     if (!status.ok()) {
@@ -2861,7 +2884,7 @@ Status VersionSet::Import(const std::string& source_dir,
                              seqno);
       }
       files.push_back(filemeta);
-      segments.emplace_back(filemeta.smallest.seqno, filemeta.largest.seqno);
+      add_segment(filemeta.sorted_run_id, filemeta.smallest.seqno, filemeta.largest.seqno);
     }
   }
   if (!status.IsEndOfFile()) {
@@ -2874,8 +2897,11 @@ Status VersionSet::Import(const std::string& source_dir,
 
   std::vector<LiveFileMetaData> live_files;
   GetLiveFilesMetaData(&live_files);
+  // Sorted run ids are only unique within a DB, so the local ones must not be merged with the
+  // imported ones.
+  sorted_run_segments.clear();
   for (const auto& file : live_files) {
-    segments.emplace_back(file.smallest.seqno, file.largest.seqno);
+    add_segment(file.sorted_run_id, file.smallest.seqno, file.largest.seqno);
   }
 
   std::sort(segments.begin(), segments.end(), [](const auto& lhs, const auto& rhs) {
@@ -2896,6 +2922,7 @@ Status VersionSet::Import(const std::string& source_dir,
   }
 
   std::vector<std::string> revert_list;
+  std::unordered_map<uint64_t, uint64_t> new_sorted_run_ids;
   for (auto file : files) {
     auto source_base = MakeTableFileName(source_dir, file.fd.GetNumber());
     auto source_data = TableBaseToDataFileName(source_base);
@@ -2915,6 +2942,11 @@ Status VersionSet::Import(const std::string& source_dir,
     revert_list.push_back(dest_data);
     file.fd.packed_number_and_path_id = new_number; // path is 0
     file.marked_for_compaction = false;
+    if (file.sorted_run_id != 0) {
+      // Renumber the imported sorted runs after their new file numbers, so they cannot clash with
+      // the sorted runs of this DB.
+      file.sorted_run_id = new_sorted_run_ids.emplace(file.sorted_run_id, new_number).first->second;
+    }
     edit->AddCleanedFile(0, file);
   }
 
@@ -3671,6 +3703,7 @@ void VersionSet::GetLiveFilesMetaData(std::vector<LiveFileMetaData>* metadata) {
         filemetadata.smallest = ConvertBoundaryValues(file->smallest);
         filemetadata.largest = ConvertBoundaryValues(file->largest);
         filemetadata.imported = file->imported;
+        filemetadata.sorted_run_id = file->sorted_run_id;
         metadata->push_back(filemetadata);
       }
     }
@@ -74,6 +74,8 @@ enum class CompactionReason {
   kManualCompaction,
   // DB::SuggestCompactRange() marked files for compaction
   kFilesMarkedForCompaction,
+  // [Universal] The oldest files only have expired records
+  kUniversalExpiredFiles,
 };
 
 #ifndef ROCKSDB_LITE
@@ -273,6 +273,8 @@ struct SstFileMetaData {
   BoundaryValues largest;
   bool imported = false;
   bool being_compacted = false; // true if the file is currently being compacted.
+  // Non-zero for the files of a sorted run written by a compaction split into subcompactions.
+  uint64_t sorted_run_id = 0;
 };
 
 // The full set of metadata associated with each SST file.
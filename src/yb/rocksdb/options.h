@@ -1012,6 +1012,11 @@ struct DBOptions {
   // Default: 1 (i.e. no subcompactions)
   uint32_t max_subcompactions;
 
+  // Minimum approximate input size of each subcompaction. It limits the number of subcompactions
+  // when the output file size is not limited, as for universal compaction.
+  // Default: 0 (i.e. no limit besides max_subcompactions)
+  uint64_t min_subcompaction_size;
+
   // Maximum number of concurrent background memtable flush jobs, submitted to
   // the HIGH priority thread pool.
   //
@@ -96,6 +96,17 @@ struct BlockBasedTableOptions {
   // Note: Fixed-size bloom filter data blocks are never pre-loaded.
   bool cache_index_and_filter_blocks = false;
 
+  // If true, index and filter blocks are put into the block cache with high priority, so that
+  // they are kept in its high priority pool and data blocks read by scans do not evict them.
+  // Fixed-size bloom filter blocks are put into the block cache with high priority as well.
+  bool cache_index_and_filter_blocks_with_high_priority = false;
+
+  // If true and cache_index_and_filter_blocks is set, the table reader holds the top level of the
+  // data index in the block cache for its life time once it is loaded, so it is never evicted.
+  // It is still charged to the block cache. Intended for kMultiLevelBinarySearch, whose top level
+  // is small. The filter index is always held by the table reader.
+  bool pin_top_level_index_in_cache = false;
+
   IndexType index_type = IndexType::kMultiLevelBinarySearch;
 
   // Influence the behavior when kHashSearch is used.
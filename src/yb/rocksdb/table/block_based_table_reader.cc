@@ -23,6 +23,7 @@
 
 #include "yb/rocksdb/table/block_based_table_reader.h"
 
+#include <atomic>
 #include <string>
 #include <utility>
 #include <cinttypes>
@@ -215,6 +216,9 @@ struct BlockBasedTable::Rep {
   Footer footer;
   std::mutex data_index_reader_mutex;
   yb::AtomicUniquePtr<IndexReader> data_index_reader;
+  // Block cache handle of the data index held by the table reader when
+  // table_options.pin_top_level_index_in_cache is set.
+  std::atomic<Cache::Handle*> pinned_data_index_handle{nullptr};
   unique_ptr<BlockEntryIteratorState> data_index_iterator_state;
   unique_ptr<IndexReader> filter_index_reader;
   unique_ptr<FilterBlockReader> filter;
@@ -290,6 +294,10 @@ class BlockBasedTable::IndexIteratorHolder {
 };
 
 BlockBasedTable::~BlockBasedTable() {
+  auto pinned_data_index_handle = rep_->pinned_data_index_handle.load(std::memory_order_acquire);
+  if (pinned_data_index_handle != nullptr) {
+    rep_->table_options.block_cache->Release(pinned_data_index_handle);
+  }
   delete rep_;
 }
 
@@ -681,13 +689,29 @@ Tickers GetBlockCacheHitTicker(BlockType block_type) {
   FATAL_INVALID_ENUM_VALUE(BlockType, block_type);
 }
 
+Cache::Priority GetIndexAndFilterCachePriority(const BlockBasedTableOptions& table_options) {
+  return table_options.cache_index_and_filter_blocks_with_high_priority
+      ? Cache::Priority::HIGH : Cache::Priority::LOW;
+}
+
+Cache::Priority GetBlockCachePriority(
+    const BlockBasedTableOptions& table_options, BlockType block_type) {
+  switch (block_type) {
+    case BlockType::kData:
+      return Cache::Priority::LOW;
+    case BlockType::kIndex:
+      return GetIndexAndFilterCachePriority(table_options);
+  }
+  FATAL_INVALID_ENUM_VALUE(BlockType, block_type);
+}
+
 } // namespace
 
 Status BlockBasedTable::GetDataBlockFromCache(
     const Slice& block_cache_key, const Slice& compressed_block_cache_key,
     Cache* block_cache, Cache* block_cache_compressed, Statistics* statistics,
     const ReadOptions& read_options, BlockBasedTable::CachableEntry<Block>* block,
-    uint32_t format_version, BlockType block_type,
+    uint32_t format_version, BlockType block_type, Cache::Priority priority,
     const std::shared_ptr<yb::MemTracker>& mem_tracker) {
   Status s;
   Block* compressed_block = nullptr;
@@ -742,7 +766,7 @@ Status BlockBasedTable::GetDataBlockFromCache(
         read_options.fill_cache) {
       s = block_cache->Insert(block_cache_key, read_options.query_id, block->value,
                               block->value->usable_size(), &DeleteCachedEntry<Block>,
-                              &block->cache_handle, statistics);
+                              &block->cache_handle, statistics, priority);
       if (!s.ok()) {
         delete block->value;
         block->value = nullptr;
@@ -760,7 +784,7 @@ Status BlockBasedTable::PutDataBlockToCache(
     Cache* block_cache, Cache* block_cache_compressed,
     const ReadOptions& read_options, Statistics* statistics,
     CachableEntry<Block>* block, Block* raw_block, uint32_t format_version,
-    const std::shared_ptr<yb::MemTracker>& mem_tracker) {
+    Cache::Priority priority, const std::shared_ptr<yb::MemTracker>& mem_tracker) {
   assert(raw_block->compression_type() == kNoCompression ||
          block_cache_compressed != nullptr);
 
@@ -804,7 +828,7 @@ Status BlockBasedTable::PutDataBlockToCache(
   if (block_cache != nullptr && block->value->cachable()) {
     s = block_cache->Insert(block_cache_key, read_options.query_id, block->value,
                             block->value->usable_size(),
-                            &DeleteCachedEntry<Block>, &block->cache_handle, statistics);
+                            &DeleteCachedEntry<Block>, &block->cache_handle, statistics, priority);
     if (!s.ok()) {
       delete block->value;
       block->value = nullptr;
@@ -981,7 +1005,8 @@ BlockBasedTable::CachableEntry<FilterBlockReader> BlockBasedTable::GetFilter(
       Status s = block_cache->Insert(filter_block_cache_key, query_id,
                                      filter, filter_size,
                                      &DeleteCachedEntry<FilterBlockReader>, &cache_handle,
-                                     statistics);
+                                     statistics,
+                                     GetIndexAndFilterCachePriority(rep_->table_options));
       if (!s.ok()) {
         delete filter;
         return CachableEntry<FilterBlockReader>();
@@ -1025,6 +1050,14 @@ InternalIterator* BlockBasedTable::NewIndexIterator(
 
   if (block_cache && (rep_->data_index_load_mode == DataIndexLoadMode::USE_CACHE ||
       rep_->table_options.cache_index_and_filter_blocks)) {
+    auto pinned_data_index_handle = rep_->pinned_data_index_handle.load(std::memory_order_acquire);
+    if (pinned_data_index_handle != nullptr) {
+      // Data index is held in the block cache by the table reader.
+      index_reader = static_cast<IndexReader*>(block_cache->Value(pinned_data_index_handle));
+      return index_reader->NewIterator(
+          input_iter, index_iter_state, read_options.total_order_seek);
+    }
+
     char cache_key[block_based_table::kCacheKeyBufferSize];
     auto key = GetCacheKey(rep_->base_reader_with_cache_prefix->cache_key_prefix,
         rep_->footer.index_handle(), cache_key);
@@ -1046,7 +1079,8 @@ InternalIterator* BlockBasedTable::NewIndexIterator(
     if (s.ok()) {
       s = block_cache->Insert(key, read_options.query_id, index_reader_unique.get(),
                               index_reader_unique->usable_size(),
-                              &DeleteCachedEntry<IndexReader>, &cache_handle, statistics);
+                              &DeleteCachedEntry<IndexReader>, &cache_handle, statistics,
+                              GetIndexAndFilterCachePriority(rep_->table_options));
     }
 
     if (s.ok()) {
@@ -1059,6 +1093,15 @@ InternalIterator* BlockBasedTable::NewIndexIterator(
     }
 
     assert(cache_handle);
+    if (rep_->table_options.pin_top_level_index_in_cache) {
+      Cache::Handle* expected = nullptr;
+      if (rep_->pinned_data_index_handle.compare_exchange_strong(
+              expected, cache_handle, std::memory_order_acq_rel)) {
+        // The reference to the cache entry is released when the table reader is destroyed.
+        return index_reader->NewIterator(
+            input_iter, index_iter_state, read_options.total_order_seek);
+      }
+    }
     auto new_iter = index_reader->NewIterator(
         input_iter, index_iter_state, read_options.total_order_seek);
     auto iter = new_iter ? new_iter : implicit_cast<InternalIterator*>(input_iter);
@@ -1140,9 +1183,10 @@ InternalIterator* BlockBasedTable::NewDataBlockIterator(const ReadOptions& ro,
       ckey = GetCacheKey(reader->compressed_cache_key_prefix, handle, compressed_cache_key);
     }
 
+    const auto priority = GetBlockCachePriority(rep_->table_options, block_type);
     s = GetDataBlockFromCache(
         key, ckey, block_cache, block_cache_compressed, statistics, ro, &block,
-        rep_->table_options.format_version, block_type, rep_->mem_tracker);
+        rep_->table_options.format_version, block_type, priority, rep_->mem_tracker);
 
     if (block.value == nullptr && !no_io && ro.fill_cache) {
       std::unique_ptr<Block> raw_block;
@@ -1156,7 +1200,7 @@ InternalIterator* BlockBasedTable::NewDataBlockIterator(const ReadOptions& ro,
       if (s.ok()) {
         s = PutDataBlockToCache(key, ckey, block_cache, block_cache_compressed,
                                 ro, statistics, &block, raw_block.release(),
-                                rep_->table_options.format_version, rep_->mem_tracker);
+                                rep_->table_options.format_version, priority, rep_->mem_tracker);
       }
     }
   }
@@ -1482,7 +1526,8 @@ bool BlockBasedTable::TEST_KeyInCache(const ReadOptions& options,
   Slice ckey;
 
   s = GetDataBlockFromCache(cache_key, ckey, block_cache, nullptr, nullptr, options, &block,
-      rep_->table_options.format_version, BlockType::kData, rep_->mem_tracker);
+      rep_->table_options.format_version, BlockType::kData, Cache::Priority::LOW,
+      rep_->mem_tracker);
   assert(s.ok());
   bool in_cache = block.value != nullptr;
   if (in_cache) {
@@ -1613,6 +1658,22 @@ uint64_t BlockBasedTable::ApproximateOffsetOf(const Slice& key) {
   return result;
 }
 
+void BlockBasedTable::SampleKeys(size_t max_keys, std::vector<std::string>* keys) {
+  IndexReader* index_reader = rep_->data_index_reader.get(std::memory_order_acquire);
+  std::unique_ptr<IndexReader> index_reader_holder;
+  if (!index_reader) {
+    // The index is kept in the block cache, read its top level without adding it to the cache.
+    Status s = CreateDataBlockIndexReader(&index_reader_holder);
+    if (!s.ok()) {
+      RLOG(InfoLogLevel::WARN_LEVEL, rep_->ioptions.info_log,
+          "Failed to read the data index to sample keys: %s", s.ToString().c_str());
+      return;
+    }
+    index_reader = index_reader_holder.get();
+  }
+  index_reader->SampleKeys(max_keys, keys);
+}
+
 bool BlockBasedTable::TEST_filter_block_preloaded() const {
   return rep_->filter != nullptr;
 }
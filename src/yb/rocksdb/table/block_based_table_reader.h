@@ -29,6 +29,7 @@
 #include <utility>
 #include <string>
 
+#include "yb/rocksdb/cache.h"
 #include "yb/rocksdb/options.h"
 #include "yb/rocksdb/statistics.h"
 #include "yb/rocksdb/status.h"
@@ -44,7 +45,6 @@ namespace rocksdb {
 class Block;
 class BlockIter;
 class BlockHandle;
-class Cache;
 class FilterBlockReader;
 class BlockBasedFilterBlockReader;
 class FullFilterBlockReader;
@@ -163,6 +163,9 @@ class BlockBasedTable : public TableReader {
   // be close to the file length.
   uint64_t ApproximateOffsetOf(const Slice& key) override;
 
+  // Samples the keys of the data index kept in memory, which separate the data blocks.
+  void SampleKeys(size_t max_keys, std::vector<std::string>* keys) override;
+
   // Returns true if the block for the specified key is in cache.
   // REQUIRES: key is in this table && block cache enabled
   bool TEST_KeyInCache(const ReadOptions& options, const Slice& key);
@@ -246,7 +249,7 @@ class BlockBasedTable : public TableReader {
       const Slice& block_cache_key, const Slice& compressed_block_cache_key,
       Cache* block_cache, Cache* block_cache_compressed, Statistics* statistics,
       const ReadOptions& read_options, BlockBasedTable::CachableEntry<Block>* block,
-      uint32_t format_version, BlockType block_type,
+      uint32_t format_version, BlockType block_type, Cache::Priority priority,
       const std::shared_ptr<yb::MemTracker>& mem_tracker);
 
   // Put a raw block (maybe compressed) to the corresponding block caches.
@@ -262,7 +265,7 @@ class BlockBasedTable : public TableReader {
       Cache* block_cache, Cache* block_cache_compressed,
       const ReadOptions& read_options, Statistics* statistics,
       CachableEntry<Block>* block, Block* raw_block, uint32_t format_version,
-      const std::shared_ptr<yb::MemTracker>& mem_tracker);
+      Cache::Priority priority, const std::shared_ptr<yb::MemTracker>& mem_tracker);
 
   // Calls (*handle_result)(arg, ...) repeatedly, starting with the entry found
   // after a call to Seek(key), until handle_result returns false.
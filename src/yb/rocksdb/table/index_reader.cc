@@ -22,6 +22,27 @@ namespace rocksdb {
 
 using namespace std::placeholders;
 
+void IndexReader::SampleBlockKeys(
+    Block* block, size_t max_keys, std::vector<std::string>* keys) {
+  if (max_keys == 0) {
+    return;
+  }
+  std::unique_ptr<InternalIterator> iter(block->NewIterator(comparator_.get()));
+  size_t num_keys = 0;
+  for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+    ++num_keys;
+  }
+  // Skip the first step, so the keys are taken from inside the block.
+  const size_t step = std::max<size_t>(1, num_keys / (max_keys + 1));
+  size_t i = 0;
+  for (iter->SeekToFirst(); iter->Valid() && max_keys > 0; iter->Next()) {
+    if (++i % step == 0) {
+      keys->push_back(iter->key().ToBuffer());
+      --max_keys;
+    }
+  }
+}
+
 Status BinarySearchIndexReader::Create(
     RandomAccessFileReader* file, const Footer& footer,
     const BlockHandle& index_handle, Env* env,
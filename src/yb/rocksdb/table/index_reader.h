@@ -16,6 +16,9 @@
 
 #include <stddef.h>
 
+#include <string>
+#include <vector>
+
 #include "yb/rocksdb/status.h"
 #include "yb/rocksdb/table/block_based_table_internal.h"
 #include "yb/rocksdb/table/two_level_iterator.h"
@@ -66,7 +69,13 @@ class IndexReader {
   // that was allocated in block cache.
   virtual size_t ApproximateMemoryUsage() const = 0;
 
+  // Appends to keys up to max_keys keys spread evenly over the index block kept in memory, without
+  // reading anything from the file. For a multi-level index, only its top level is sampled.
+  virtual void SampleKeys(size_t max_keys, std::vector<std::string>* keys) = 0;
+
  protected:
+  void SampleBlockKeys(Block* block, size_t max_keys, std::vector<std::string>* keys);
+
   ComparatorPtr comparator_;
 };
 
@@ -107,6 +116,10 @@ class BinarySearchIndexReader : public IndexReader {
     return index_block_->ApproximateMemoryUsage();
   }
 
+  void SampleKeys(size_t max_keys, std::vector<std::string>* keys) override {
+    SampleBlockKeys(index_block_.get(), max_keys, keys);
+  }
+
  private:
   BinarySearchIndexReader(const ComparatorPtr& comparator,
                           std::unique_ptr<Block>&& index_block)
@@ -151,6 +164,10 @@ class HashIndexReader : public IndexReader {
     return index_block_->ApproximateMemoryUsage() + prefixes_contents_.data.size();
   }
 
+  void SampleKeys(size_t max_keys, std::vector<std::string>* keys) override {
+    SampleBlockKeys(index_block_.get(), max_keys, keys);
+  }
+
  private:
   HashIndexReader(const ComparatorPtr& comparator, std::unique_ptr<Block>&& index_block)
       : IndexReader(comparator), index_block_(std::move(index_block)) {
@@ -190,6 +207,10 @@ class MultiLevelIndexReader : public IndexReader {
   InternalIterator* NewIterator(
       BlockIter* iter, TwoLevelIteratorState* index_iterator_state, bool) override;
 
+  void SampleKeys(size_t max_keys, std::vector<std::string>* keys) override {
+    SampleBlockKeys(top_level_index_block_.get(), max_keys, keys);
+  }
+
  private:
   size_t size() const override { return top_level_index_block_->size(); }
 
@@ -25,6 +25,8 @@
 #define ROCKSDB_TABLE_TABLE_READER_H
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "yb/util/slice.h"
 
@@ -72,6 +74,10 @@ class TableReader {
   // be close to the file length.
   virtual uint64_t ApproximateOffsetOf(const Slice& key) = 0;
 
+  // Appends to keys up to max_keys internal keys spread evenly over the table, so the table could be
+  // split at them into ranges of similar size. Default implementation appends nothing.
+  virtual void SampleKeys(size_t max_keys, std::vector<std::string>* keys) {}
+
   // Set up the table for Compaction. Might change some parameters with
   // posix_fadvise
   virtual void SetupForCompaction() = 0;
@@ -178,6 +178,8 @@ DEFINE_string(benchmarks,
               "\tcompact     -- Compact the entire DB\n"
               "\tstats       -- Print DB stats\n"
               "\tlevelstats  -- Print the number of files and bytes per level\n"
+              "\tamplification -- Print the space amplification of the DB and the write"
+              " amplification of the benchmarks run so far (with --statistics)\n"
               "\tsstables    -- Print sstable info\n"
               "\theapprofile -- Dump a heap profile (if supported by this"
               " port)\n");
@@ -2055,6 +2057,8 @@ class Benchmark {
         PrintStats("rocksdb.levelstats");
       } else if (name == "sstables") {
         PrintStats("rocksdb.sstables");
+      } else if (name == "amplification") {
+        PrintAmplification();
       } else if (!name.empty()) {  // No error message for empty name
         fprintf(stderr, "unknown benchmark '%s'\n", name.c_str());
         exit(1);
@@ -4077,6 +4081,48 @@ class Benchmark {
     }
     fprintf(stdout, "\n%s\n", stats.c_str());
   }
+
+  // Running overwrite followed by amplification with different --compaction_style values compares
+  // the space amplification of the compaction styles with their write amplification.
+  void PrintAmplification() {
+    if (db_.db != nullptr) {
+      PrintSpaceAmplification(db_.db, false);
+    }
+    for (const auto& db_with_cfh : multi_dbs_) {
+      PrintSpaceAmplification(db_with_cfh.db, true);
+    }
+    if (!dbstats) {
+      fprintf(stdout, "Write amplification: (requires --statistics)\n");
+      return;
+    }
+    // User bytes are counted uncompressed, so compression lowers the write amplification.
+    const uint64_t user_bytes = dbstats->getTickerCount(BYTES_WRITTEN);
+    const uint64_t flush_bytes = dbstats->getTickerCount(FLUSH_WRITE_BYTES);
+    const uint64_t compaction_bytes = dbstats->getTickerCount(COMPACT_WRITE_BYTES);
+    fprintf(stdout,
+            "User writes: %" PRIu64 " bytes, flushes: %" PRIu64 " bytes, compactions: %" PRIu64
+            " bytes, write amplification: %.2f\n",
+            user_bytes, flush_bytes, compaction_bytes,
+            user_bytes ? static_cast<double>(flush_bytes + compaction_bytes) / user_bytes : 0.0);
+  }
+
+  void PrintSpaceAmplification(DB* db, bool print_header) {
+    if (print_header) {
+      fprintf(stdout, "\n==== DB: %s ===\n", db->GetName().c_str());
+    }
+    uint64_t sst_files_size = 0;
+    uint64_t live_data_size = 0;
+    if (!db->GetIntProperty(DB::Properties::kTotalSstFilesSize, &sst_files_size) ||
+        !db->GetIntProperty(DB::Properties::kEstimateLiveDataSize, &live_data_size)) {
+      fprintf(stdout, "Space amplification: (failed)\n");
+      return;
+    }
+    fprintf(stdout,
+            "SST files: %" PRIu64 " bytes, estimated live data: %" PRIu64
+            " bytes, space amplification: %.2f\n",
+            sst_files_size, live_data_size,
+            live_data_size ? static_cast<double>(sst_files_size) / live_data_size : 0.0);
+  }
 };
 
 int db_bench_tool(int argc, char** argv) {
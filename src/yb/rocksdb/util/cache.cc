@@ -42,6 +42,12 @@
 DEFINE_double(cache_single_touch_ratio, 0.2,
               "fraction of the cache dedicated to single-touch items");
 
+// High priority items overflowing the pool are evicted like low priority items, so the pool does
+// not take any capacity away from low priority items while it is not full.
+DEFINE_double(cache_high_pri_pool_ratio, 0.1,
+              "fraction of the single-touch and multi-touch caches in which high priority items, "
+              "i.e. index and filter blocks, are only evicted after low priority items");
+
 namespace rocksdb {
 
 Cache::~Cache() {
@@ -80,6 +86,11 @@ namespace {
 // that are accessed multiple times by different queries.
 // query_id == kNoCacheQueryId means that this Handle is not going to be added
 // into the cache.
+//
+// Independently of the query id, the LRU list of each of the two caches is split into a low
+// priority part and a high priority pool. High priority entries are appended to the pool, low
+// priority entries are appended to the low priority part, which is evicted first. When the pool
+// grows over its capacity, its oldest entries move to the low priority part.
 
 struct LRUHandle {
   void* value;
@@ -94,6 +105,8 @@ struct LRUHandle {
   bool in_cache;      // true, if this entry is referenced by the hash table
   uint32_t hash;      // Hash of key(); used for fast sharding and comparisons
   QueryId query_id;  // Query id that added the value to the cache.
+  bool is_high_pri;       // true, if this entry was inserted with high priority
+  bool in_high_pri_pool;  // true, if this entry is in the high priority pool of its LRU list
   char key_data[1];   // Beginning of key
 
   Slice key() const {
@@ -275,13 +288,19 @@ class LRUSubCache {
     return capacity_;
   }
 
+  size_t HighPriPoolUsage() const {
+    return high_pri_pool_usage_;
+  }
+
   LRUHandle& LRU_Head() {
     return lru_;
   }
 
-  // Updates the capacity.
-  void SetCapacity(const size_t capacity) {
+  // Updates the capacity, and the capacity of the high priority pool as its given fraction.
+  void SetCapacity(const size_t capacity, const double high_pri_pool_ratio) {
     capacity_ = capacity;
+    high_pri_pool_capacity_ = static_cast<size_t>(round(high_pri_pool_ratio * capacity));
+    MaintainPoolSize();
   }
 
   // Checks if the head of the LRU linked list is pointing to itself,
@@ -309,11 +328,19 @@ class LRUSubCache {
   void LRU_Append(LRUHandle *e);
 
  private:
+  // Moves the oldest entries of the high priority pool to the low priority part of the LRU list
+  // until the pool fits its capacity.
+  void MaintainPoolSize();
+
   // Dummy heads of single-touch and multi-touch LRU list.
   // lru.prev is newest entry, lru.next is oldest entry.
   // LRU contains items which can be evicted, ie referenced only by cache.
   LRUHandle lru_;
 
+  // Newest entry of the low priority part of the LRU list, or &lru_ if it is empty. Entries after
+  // it are in the high priority pool.
+  LRUHandle* lru_low_pri_;
+
   // Capacity of the sub_cache.
   size_t capacity_;
 
@@ -323,12 +350,19 @@ class LRUSubCache {
 
   // Memory size for entries residing only in the LRU list
   size_t lru_usage_;
+
+  // Capacity and memory size for entries of the high priority pool of the LRU list.
+  size_t high_pri_pool_capacity_;
+  size_t high_pri_pool_usage_;
 };
 
-LRUSubCache::LRUSubCache() : capacity_(0), usage_(0), lru_usage_(0) {
+LRUSubCache::LRUSubCache()
+    : capacity_(0), usage_(0), lru_usage_(0), high_pri_pool_capacity_(0),
+      high_pri_pool_usage_(0) {
   // Make empty circular linked list
   lru_.next = &lru_;
   lru_.prev = &lru_;
+  lru_low_pri_ = &lru_;
 }
 
 LRUSubCache::~LRUSubCache() {}
@@ -337,23 +371,52 @@ LRUSubCache::~LRUSubCache() {}
 void LRUSubCache::LRU_Remove(LRUHandle* e) {
   assert(e->next != nullptr);
   assert(e->prev != nullptr);
+  if (lru_low_pri_ == e) {
+    lru_low_pri_ = e->prev;
+  }
   e->next->prev = e->prev;
   e->prev->next = e->next;
   e->prev = e->next = nullptr;
   lru_usage_ -= e->charge;
+  if (e->in_high_pri_pool) {
+    assert(high_pri_pool_usage_ >= e->charge);
+    high_pri_pool_usage_ -= e->charge;
+  }
 }
 
-// Append to the LRU header of the sub cache.
+// Append to the LRU header of the sub cache, or of its low priority part for low priority entries.
 void LRUSubCache::LRU_Append(LRUHandle *e) {
   assert(e->next == nullptr);
   assert(e->next == nullptr);
-  e->next = &lru_;
-  e->prev = lru_.prev;
-  e->prev->next = e;
-  e->next->prev = e;
+  if (high_pri_pool_capacity_ > 0 && e->is_high_pri) {
+    e->next = &lru_;
+    e->prev = lru_.prev;
+    e->prev->next = e;
+    e->next->prev = e;
+    e->in_high_pri_pool = true;
+    high_pri_pool_usage_ += e->charge;
+    MaintainPoolSize();
+  } else {
+    e->next = lru_low_pri_->next;
+    e->prev = lru_low_pri_;
+    e->prev->next = e;
+    e->next->prev = e;
+    e->in_high_pri_pool = false;
+    lru_low_pri_ = e;
+  }
   lru_usage_ += e->charge;
 }
 
+void LRUSubCache::MaintainPoolSize() {
+  while (high_pri_pool_usage_ > high_pri_pool_capacity_) {
+    lru_low_pri_ = lru_low_pri_->next;
+    assert(lru_low_pri_ != &lru_);
+    lru_low_pri_->in_high_pri_pool = false;
+    assert(high_pri_pool_usage_ >= lru_low_pri_->charge);
+    high_pri_pool_usage_ -= lru_low_pri_->charge;
+  }
+}
+
 class LRUHandleDeleter {
  public:
   explicit LRUHandleDeleter(yb::CacheMetrics* metrics) : metrics_(metrics) {}
@@ -403,7 +466,7 @@ class LRUCache {
   // Like Cache methods, but with an extra "hash" parameter.
   Status Insert(const Slice& key, uint32_t hash, const QueryId query_id,
                 void* value, size_t charge, void (*deleter)(const Slice& key, void* value),
-                Cache::Handle** handle, Statistics* statistics);
+                Cache::Handle** handle, Statistics* statistics, Cache::Priority priority);
   Cache::Handle* Lookup(const Slice& key, uint32_t hash, const QueryId query_id,
                         Statistics* statistics = nullptr);
   void Release(Cache::Handle* handle);
@@ -424,6 +487,11 @@ class LRUCache {
     return single_touch_sub_cache_.GetPinnedUsage() + multi_touch_sub_cache_.GetPinnedUsage();
   }
 
+  size_t GetHighPriPoolUsage() const {
+    MutexLock l(&mutex_);
+    return single_touch_sub_cache_.HighPriPoolUsage() + multi_touch_sub_cache_.HighPriPoolUsage();
+  }
+
   void ApplyToAllCacheEntries(void (*callback)(void*, size_t),
                               bool thread_safe);
 
@@ -533,8 +601,10 @@ void LRUCache::SetCapacity(size_t capacity) {
   {
     MutexLock l(&mutex_);
     single_touch_sub_cache_.SetCapacity(
-      static_cast<size_t>(round(FLAGS_cache_single_touch_ratio * capacity)));
-    multi_touch_sub_cache_.SetCapacity(capacity - single_touch_sub_cache_.Capacity());
+        static_cast<size_t>(round(FLAGS_cache_single_touch_ratio * capacity)),
+        FLAGS_cache_high_pri_pool_ratio);
+    multi_touch_sub_cache_.SetCapacity(
+        capacity - single_touch_sub_cache_.Capacity(), FLAGS_cache_high_pri_pool_ratio);
     EvictFromLRU(0, &last_reference_list, SINGLE_TOUCH);
     EvictFromLRU(0, &last_reference_list, MULTI_TOUCH);
   }
@@ -661,7 +731,8 @@ size_t LRUCache::Evict(size_t required) {
 
 Status LRUCache::Insert(const Slice& key, uint32_t hash, const QueryId query_id,
                         void* value, size_t charge, void (*deleter)(const Slice& key, void* value),
-                        Cache::Handle** handle, Statistics* statistics) {
+                        Cache::Handle** handle, Statistics* statistics,
+                        Cache::Priority priority) {
   // Don't use the cache if disabled by the caller using the special query id.
   if (query_id == kNoCacheQueryId) {
     return Status::OK();
@@ -686,6 +757,8 @@ Status LRUCache::Insert(const Slice& key, uint32_t hash, const QueryId query_id,
   e->in_cache = true;
   // Adding query id to the handle.
   e->query_id = query_id;
+  e->is_high_pri = priority == Cache::Priority::HIGH;
+  e->in_high_pri_pool = false;
   memcpy(e->key_data, key.data(), key.size());
 
   {
@@ -857,7 +930,7 @@ class ShardedLRUCache : public Cache {
   }
   virtual Status Insert(const Slice& key, const QueryId query_id, void* value, size_t charge,
                         void (*deleter)(const Slice& key, void* value),
-                        Handle** handle, Statistics* statistics) override {
+                        Handle** handle, Statistics* statistics, Priority priority) override {
     DCHECK(IsValidQueryId(query_id));
     // Queries with no cache query ids are not cached.
     if (query_id == kNoCacheQueryId) {
@@ -865,7 +938,7 @@ class ShardedLRUCache : public Cache {
     }
     const uint32_t hash = HashSlice(key);
     return shards_[Shard(hash)].Insert(key, hash, query_id, value, charge, deleter,
-                                       handle, statistics);
+                                       handle, statistics, priority);
   }
 
   size_t Evict(size_t bytes_to_evict) override {
@@ -938,6 +1011,16 @@ class ShardedLRUCache : public Cache {
     return usage;
   }
 
+  size_t GetHighPriPoolUsage() const override {
+    // We will not lock the cache when getting the usage from shards.
+    int num_shards = 1 << num_shard_bits_;
+    size_t usage = 0;
+    for (int s = 0; s < num_shards; s++) {
+      usage += shards_[s].GetHighPriPoolUsage();
+    }
+    return usage;
+  }
+
   SubCacheType GetSubCacheType(Handle* e) const override {
     LRUHandle* h = reinterpret_cast<LRUHandle*>(e);
     return h->GetSubCacheType();
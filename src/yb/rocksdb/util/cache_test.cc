@@ -33,6 +33,7 @@
 #include "yb/rocksdb/util/testharness.h"
 
 DECLARE_double(cache_single_touch_ratio);
+DECLARE_double(cache_high_pri_pool_ratio);
 
 namespace rocksdb {
 
@@ -463,6 +464,49 @@ TEST_F(CacheTest, EvictionPolicyMultiTouch) {
   ASSERT_LT(kCacheSize * FLAGS_cache_single_touch_ratio, cache_->GetUsage());
 }
 
+TEST_F(CacheTest, HighPriorityPool) {
+  constexpr int kCapacity = 100;
+  // Use a single shard, so that all the entries share the same pools.
+  auto cache = NewLRUCache(kCapacity, 0);
+  const int kPoolSize = static_cast<int>(round(
+      kCapacity * (1 - FLAGS_cache_single_touch_ratio) * FLAGS_cache_high_pri_pool_ratio));
+  ASSERT_GT(kPoolSize, 0);
+
+  auto insert_high_pri = [&cache](int key) {
+    return cache->Insert(EncodeKey(key), kInMultiTouchId, EncodeValue(key + 1), 1,
+                         &CacheTest::Deleter, nullptr, nullptr, Cache::Priority::HIGH);
+  };
+  auto insert_low_pri = [this, &cache] {
+    for (int i = 0; i < kCapacity * 2; i++) {
+      ASSERT_OK(Insert(cache, 1000 + i, 2000 + i, 1, kInMultiTouchId));
+    }
+  };
+
+  for (int i = 0; i < kPoolSize; i++) {
+    ASSERT_OK(insert_high_pri(i));
+  }
+  ASSERT_EQ(static_cast<size_t>(kPoolSize), cache->GetHighPriPoolUsage());
+
+  // Low priority entries do not evict the high priority entries in the pool.
+  insert_low_pri();
+  for (int i = 0; i < kPoolSize; i++) {
+    ASSERT_EQ(i + 1, Lookup(cache, i));
+  }
+
+  // High priority entries overflowing the pool are evicted like low priority entries.
+  for (int i = kPoolSize; i < kPoolSize * 2; i++) {
+    ASSERT_OK(insert_high_pri(i));
+  }
+  ASSERT_EQ(static_cast<size_t>(kPoolSize), cache->GetHighPriPoolUsage());
+  insert_low_pri();
+  for (int i = 0; i < kPoolSize; i++) {
+    ASSERT_EQ(-1, Lookup(cache, i));
+  }
+  for (int i = kPoolSize; i < kPoolSize * 2; i++) {
+    ASSERT_EQ(i + 1, Lookup(cache, i));
+  }
+}
+
 TEST_F(CacheTest, HeavyEntries) {
   // Add a bunch of light and heavy entries and then count the combined
   // size of items still in the cache, which must be approximately the
@@ -251,6 +251,7 @@ DBOptions::DBOptions()
       num_reserved_small_compaction_threads(-1),
       compaction_size_threshold_bytes(std::numeric_limits<uint64_t>::max()),
       max_subcompactions(1),
+      min_subcompaction_size(0),
       max_background_flushes(1),
       max_log_file_size(0),
       log_file_time_to_roll(0),
@@ -341,6 +342,8 @@ void DBOptions::Dump(Logger* log) const {
       max_background_compactions);
   RHEADER(log, "                     Options.max_subcompactions: %" PRIu32,
       max_subcompactions);
+  RHEADER(log, "                 Options.min_subcompaction_size: %" PRIu64,
+      min_subcompaction_size);
   RHEADER(log, "                 Options.max_background_flushes: %d",
       max_background_flushes);
   RHEADER(log, "                        Options.WAL_ttl_seconds: %" PRIu64,
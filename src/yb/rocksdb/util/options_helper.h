@@ -287,6 +287,9 @@ static std::unordered_map<std::string, OptionTypeInfo> db_options_type_info = {
     {"max_subcompactions",
      {offsetof(struct DBOptions, max_subcompactions), OptionType::kUInt32T,
       OptionVerificationType::kNormal}},
+    {"min_subcompaction_size",
+     {offsetof(struct DBOptions, min_subcompaction_size), OptionType::kUInt64T,
+      OptionVerificationType::kNormal}},
     {"WAL_size_limit_MB",
      {offsetof(struct DBOptions, WAL_size_limit_MB), OptionType::kUInt64T,
       OptionVerificationType::kNormal}},
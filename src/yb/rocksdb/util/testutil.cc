@@ -230,6 +230,7 @@ void RandomInitDBOptions(DBOptions* db_opt, Random* rnd) {
   db_opt->WAL_ttl_seconds = uint_max + rnd->Uniform(100000);
   db_opt->bytes_per_sync = uint_max + rnd->Uniform(100000);
   db_opt->delayed_write_rate = uint_max + rnd->Uniform(100000);
+  db_opt->min_subcompaction_size = uint_max + rnd->Uniform(100000);
   db_opt->delete_obsolete_files_period_micros = uint_max + rnd->Uniform(100000);
   db_opt->max_manifest_file_size = uint_max + rnd->Uniform(100000);
   db_opt->max_total_wal_size = uint_max + rnd->Uniform(100000);
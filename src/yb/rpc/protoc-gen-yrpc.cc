@@ -197,6 +197,12 @@ class MethodSubstitutions : public Substituter {
             StripNamespaceIfPossible(method_->service()->full_name(),
                                      method_->output_type()->full_name()));
     (*map)["metric_enum_key"] = strings::Substitute("kMetricIndex$0", method_->name());
+    // Requests declared in files with arenas enabled are parsed into the arena of the inbound
+    // call, so their nested messages are released all at once together with the call.
+    (*map)["new_request"] =
+        method_->input_type()->file()->options().cc_enable_arenas()
+            ? "yb_call->NewArenaMessage<" + (*map)["request"] + ">()"
+            : "std::make_shared<" + (*map)["request"] + ">()";
   }
 
   // Strips the package from method arguments if they are in the same package as
@@ -514,7 +520,7 @@ class CodeGenerator : public ::google::protobuf::compiler::CodeGenerator {
         "            metrics_[$metric_enum_key$]) :\n"
         "        ::yb::rpc::RpcContext(\n"
         "            yb_call, \n"
-        "            std::make_shared<$request$>(),\n"
+        "            $new_request$,\n"
         "            std::make_shared<$response$>(),\n"
         "            metrics_[$metric_enum_key$]);\n"
         "    if (!rpc_context.responded()) {\n"
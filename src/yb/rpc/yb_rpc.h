@@ -16,6 +16,8 @@
 #ifndef YB_RPC_YB_RPC_H
 #define YB_RPC_YB_RPC_H
 
+#include <google/protobuf/arena.h>
+
 #include "yb/rpc/binary_call_parser.h"
 #include "yb/rpc/circular_read_buffer.h"
 #include "yb/rpc/connection_context.h"
@@ -178,6 +180,14 @@ class YBInboundCall : public InboundCall {
 
   virtual CHECKED_STATUS ParseParam(google::protobuf::Message *message);
 
+  // Creates a message that is allocated on the arena of this call. The returned pointer keeps
+  // the call alive, so the message and all of its nested messages are freed with the call.
+  template <class T>
+  std::shared_ptr<T> NewArenaMessage() {
+    return std::shared_ptr<T>(
+        shared_from_this(), google::protobuf::Arena::CreateMessage<T>(&arena_));
+  }
+
   void RespondBadMethod();
 
   size_t ObjectSize() const override { return sizeof(*this); }
@@ -213,6 +223,9 @@ class YBInboundCall : public InboundCall {
   RemoteMethod remote_method_;
 
   ScopedTrackedConsumption consumption_;
+
+  // Arena for the request of this call, see NewArenaMessage().
+  google::protobuf::Arena arena_;
 };
 
 class YBOutboundConnectionContext : public YBConnectionContext {
@@ -0,0 +1,169 @@
+//
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+//
+
+#include <numeric>
+
+#include "yb/common/ql_protocol_util.h"
+#include "yb/common/ql_value.h"
+
+#include "yb/rocksdb/db.h"
+
+#include "yb/tablet/tablet-test-util.h"
+#include "yb/tablet/tablet.h"
+#include "yb/tablet/local_tablet_writer.h"
+#include "yb/util/random_util.h"
+#include "yb/util/size_literals.h"
+
+DECLARE_int64(db_write_buffer_size);
+DECLARE_int32(rocksdb_level0_file_num_compaction_trigger);
+DECLARE_uint64(rocksdb_level_compaction_max_bytes_for_level_base);
+DECLARE_uint64(rocksdb_level_compaction_target_file_size);
+DECLARE_int32(timestamp_history_retention_interval_sec);
+
+namespace yb {
+namespace tablet {
+
+namespace {
+
+TableProperties LevelCompactionTableProperties() {
+  TableProperties properties;
+  properties.SetCompactionStyle(TableCompactionStyle::LEVEL_COMPACTION_STYLE);
+  return properties;
+}
+
+} // namespace
+
+class TabletLevelCompactionTest : public YBTabletTest {
+ public:
+  TabletLevelCompactionTest()
+      : YBTabletTest(Schema({ ColumnSchema("key", INT32, false, true),
+                              ColumnSchema("val", STRING) },
+                            1, LevelCompactionTableProperties())) {}
+
+  void SetUp() override {
+    FLAGS_db_write_buffer_size = 1_MB;
+    FLAGS_rocksdb_level0_file_num_compaction_trigger = 2;
+    FLAGS_rocksdb_level_compaction_max_bytes_for_level_base = 256_KB;
+    FLAGS_rocksdb_level_compaction_target_file_size = 128_KB;
+    FLAGS_timestamp_history_retention_interval_sec = 0;
+    YBTabletTest::SetUp();
+    writer_.reset(new LocalTabletWriter(tablet().get()));
+  }
+
+ protected:
+  void InsertRow(int32_t key, const std::string& val, LocalTabletWriter::Batch* batch) {
+    QLWriteRequestPB* req = batch->Add();
+    req->set_type(QLWriteRequestPB::QL_STMT_INSERT);
+    QLAddInt32HashValue(req, key);
+    QLAddStringColumnValue(req, kFirstColumnId + 1, val);
+  }
+
+  void DeleteRow(int32_t key, LocalTabletWriter::Batch* batch) {
+    QLWriteRequestPB* req = batch->Add();
+    req->set_type(QLWriteRequestPB::QL_STMT_DELETE);
+    QLAddInt32HashValue(req, key);
+  }
+
+  Result<size_t> CountRows() {
+    ReadHybridTime read_time = ReadHybridTime::SingleTime(tablet()->SafeTime());
+    QLReadRequestPB req;
+    QLAddColumns(schema_, {}, &req);
+    QLReadRequestResult result;
+    RETURN_NOT_OK(tablet()->HandleQLReadRequest(
+        CoarseTimePoint::max(), read_time, req, TransactionMetadataPB(), &result));
+    EXPECT_EQ(QLResponsePB::YQL_STATUS_OK, result.response.status());
+    return CreateRowBlock(QLClient::YQL_CLIENT_CQL, schema_, result.rows_data)->row_count();
+  }
+
+  size_t CountDocDBEntries() {
+    std::unordered_set<std::string> entries;
+    tablet()->TEST_DocDBDumpToContainer(IncludeIntents::kFalse, &entries);
+    return entries.size();
+  }
+
+  // Returns the number of regular DB files at each level.
+  std::vector<size_t> FilesPerLevel() {
+    rocksdb::DB* db = tablet()->TEST_db();
+    std::vector<size_t> result(db->GetOptions().num_levels);
+    std::vector<rocksdb::LiveFileMetaData> files;
+    db->GetLiveFilesMetaData(&files);
+    for (const auto& file : files) {
+      ++result[file.level];
+    }
+    return result;
+  }
+
+  std::unique_ptr<LocalTabletWriter> writer_;
+};
+
+TEST_F(TabletLevelCompactionTest, CompactAcrossLevels) {
+  constexpr size_t kNumRows = 10000;
+  constexpr auto kValuePrefixLength = 256;
+  constexpr auto kRowsPerFlush = kNumRows / 10;
+
+  const auto db_options = tablet()->TEST_db()->GetOptions();
+  ASSERT_EQ(rocksdb::CompactionStyle::kCompactionStyleLevel, db_options.compaction_style);
+  const size_t last_level = db_options.num_levels - 1;
+
+  const auto value_format = RandomHumanReadableString(kValuePrefixLength) + "_$0";
+  LocalTabletWriter::Batch batch;
+  for (size_t i = 1; i <= kNumRows; ++i) {
+    InsertRow(i, Format(value_format, i), &batch);
+    if (i % kRowsPerFlush == 0) {
+      ASSERT_OK(writer_->WriteBatch(&batch));
+      batch.Clear();
+      ASSERT_OK(tablet()->Flush(FlushMode::kSync));
+    }
+  }
+
+  // Automatic compactions should move the flushed files out of level 0.
+  ASSERT_OK(WaitFor([this] {
+    const auto files_per_level = FilesPerLevel();
+    return files_per_level[0] < static_cast<size_t>(
+               FLAGS_rocksdb_level0_file_num_compaction_trigger) &&
+           std::accumulate(files_per_level.begin() + 1, files_per_level.end(), size_t(0)) > 0;
+  }, MonoDelta::FromSeconds(30), "Compact level 0"));
+  LOG(INFO) << "Files per level after automatic compactions: " << yb::ToString(FilesPerLevel());
+  ASSERT_EQ(kNumRows, ASSERT_RESULT(CountRows()));
+  const auto num_entries = CountDocDBEntries();
+
+  for (size_t i = 1; i <= kNumRows; i += 2) {
+    DeleteRow(i, &batch);
+  }
+  ASSERT_OK(writer_->WriteBatch(&batch));
+  batch.Clear();
+  ASSERT_OK(tablet()->Flush(FlushMode::kSync));
+  ASSERT_EQ(kNumRows / 2, ASSERT_RESULT(CountRows()));
+  // The delete markers are kept until they are compacted into the bottommost level.
+  ASSERT_GT(CountDocDBEntries(), num_entries);
+
+  // A manual compaction moves the files level by level into the last level. None of its
+  // compactions includes every file, but those into the last level output to the bottommost level.
+  tablet()->ForceRocksDBCompactInTest();
+
+  const auto files_per_level = FilesPerLevel();
+  LOG(INFO) << "Files per level after manual compaction: " << yb::ToString(files_per_level);
+  for (size_t level = 0; level != last_level; ++level) {
+    ASSERT_EQ(0U, files_per_level[level]) << "Level: " << level;
+  }
+  ASSERT_GT(files_per_level[last_level], 0U);
+
+  // The bottommost level compactions dropped the deleted rows with their delete markers.
+  ASSERT_EQ(num_entries / 2, CountDocDBEntries());
+  ASSERT_EQ(kNumRows / 2, ASSERT_RESULT(CountRows()));
+}
+
+} // namespace tablet
+} // namespace yb
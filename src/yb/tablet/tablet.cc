@@ -533,6 +533,23 @@ std::string LogDbTypePrefix(docdb::StorageDbType db_type) {
   FATAL_INVALID_ENUM_VALUE(docdb::StorageDbType, db_type);
 }
 
+// Intents are short-lived and always use universal compaction, so the compaction style of the table
+// only applies to the regular DB.
+void SetRegularDbCompactionStyle(const Schema& schema, rocksdb::Options* options) {
+  if (schema.table_properties().compaction_style() ==
+          TableCompactionStyle::LEVEL_COMPACTION_STYLE) {
+    docdb::SetLevelCompactionOptions(options);
+  }
+}
+
+// Keys of range-sharded tables have no hashed components, so their bloom filter also covers the
+// leading range components. Hash-sharded tables keep the filter their existing SST files use.
+void SetRegularDbFilterPolicy(const Schema& schema, rocksdb::Options* options) {
+  if (schema.num_hash_key_columns() == 0) {
+    docdb::SetRangeShardedBloomFilter(options);
+  }
+}
+
 } // namespace
 
 std::string Tablet::LogPrefix(docdb::StorageDbType db_type) const {
@@ -572,9 +589,13 @@ Status Tablet::OpenKeyValueTablet() {
   const string db_dir = metadata()->rocksdb_dir();
   RETURN_NOT_OK(CreateTabletDirectories(db_dir, metadata()->fs_manager()));
 
+  rocksdb::Options regular_db_options = rocksdb_options;
+  SetRegularDbCompactionStyle(metadata()->schema(), &regular_db_options);
+  SetRegularDbFilterPolicy(metadata()->schema(), &regular_db_options);
+
   LOG(INFO) << "Opening RocksDB at: " << db_dir;
   rocksdb::DB* db = nullptr;
-  rocksdb::Status rocksdb_open_status = rocksdb::DB::Open(rocksdb_options, db_dir, &db);
+  rocksdb::Status rocksdb_open_status = rocksdb::DB::Open(regular_db_options, db_dir, &db);
   if (!rocksdb_open_status.ok()) {
     LOG_WITH_PREFIX(ERROR) << "Failed to open a RocksDB database in directory " << db_dir << ": "
                            << rocksdb_open_status;
@@ -1364,7 +1385,8 @@ CHECKED_STATUS Tablet::CreatePagingStateForRead(const PgsqlReadRequestPB& pgsql_
   // paging state in the response, we are done reading from the current tablet. In this case, we
   // should return the exclusive end partition key of this tablet if not empty which is the start
   // key of the next tablet. Do so only if the request has no row count limit, or there is and we
-  // haven't hit it, or we are asked to return paging state even when we have hit the limit.
+  // haven't hit it, or we are asked to return paging state even when we have hit the limit, and
+  // the next tablet does not start past the max hash code of the request (if set).
   // Otherwise, leave the paging state empty which means we are completely done reading for the
   // whole SELECT statement.
   if (pgsql_read_request.partition_column_values().empty() &&
@@ -1373,7 +1395,10 @@ CHECKED_STATUS Tablet::CreatePagingStateForRead(const PgsqlReadRequestPB& pgsql_
       (!pgsql_read_request.has_limit() || row_count < pgsql_read_request.limit() ||
        pgsql_read_request.return_paging_state())) {
     const string& next_partition_key = metadata_->partition().partition_key_end();
-    if (!next_partition_key.empty()) {
+    if (!next_partition_key.empty() &&
+        (!pgsql_read_request.has_max_hash_code() ||
+         PartitionSchema::DecodeMultiColumnHashValue(next_partition_key) <=
+             pgsql_read_request.max_hash_code())) {
       response->mutable_paging_state()->set_next_partition_key(next_partition_key);
     }
   }
@@ -1729,6 +1754,8 @@ Status Tablet::ModifyFlushedFrontier(
     rocksdb::Options rocksdb_options;
     docdb::InitRocksDBOptions(
         &rocksdb_options, LogPrefix(), /* statistics */ nullptr, tablet_options_);
+    SetRegularDbCompactionStyle(metadata()->schema(), &rocksdb_options);
+    SetRegularDbFilterPolicy(metadata()->schema(), &rocksdb_options);
     rocksdb_options.create_if_missing = false;
     LOG_WITH_PREFIX(INFO) << "Opening the test RocksDB at " << checkpoint_dir_for_test
         << ", expecting to see flushed frontier of " << frontier.ToString();
@@ -2295,6 +2322,26 @@ uint64_t Tablet::GetCurrentVersionNumSSTFiles() const {
   return regular_db_->GetCurrentVersionNumSSTFiles();
 }
 
+TabletCompactionDebt Tablet::GetCompactionDebt() const {
+  ScopedPendingOperation scoped_operation(&pending_op_counter_);
+  std::lock_guard<rw_spinlock> lock(component_lock_);
+
+  TabletCompactionDebt result;
+  if (!pending_op_counter_.IsReady() || !regular_db_) {
+    return result;
+  }
+  uint64_t compaction_pending = 0;
+  result.num_sst_files = regular_db_->GetCurrentVersionNumSSTFiles();
+  regular_db_->GetIntProperty(rocksdb::DB::Properties::kNumSortedRuns, &result.num_sorted_runs);
+  regular_db_->GetIntProperty(rocksdb::DB::Properties::kCompactionPending, &compaction_pending);
+  regular_db_->GetIntProperty(
+      rocksdb::DB::Properties::kNumRunningCompactions, &result.running_compactions);
+  regular_db_->GetIntProperty(
+      rocksdb::DB::Properties::kCompactionPriority, &result.compaction_priority);
+  result.compaction_pending = compaction_pending != 0;
+  return result;
+}
+
 std::pair<int, int> Tablet::GetNumMemtables() const {
   int intents_num_memtables = 0;
   int regular_num_memtables = 0;
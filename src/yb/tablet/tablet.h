@@ -159,6 +159,17 @@ struct DocDbOpIds {
   std::string ToString() const;
 };
 
+// Compaction backlog of the regular DB of a tablet.
+struct TabletCompactionDebt {
+  uint64_t num_sst_files = 0;
+  // Number of sorted runs merged by reads.
+  uint64_t num_sorted_runs = 0;
+  bool compaction_pending = false;
+  uint64_t running_compactions = 0;
+  // Highest priority of the compaction tasks of the tablet, 0 if there are none.
+  uint64_t compaction_priority = 0;
+};
+
 typedef std::function<Status(const TableInfo&)> AddTableListener;
 
 class Tablet : public AbstractTablet, public TransactionIntentApplier {
@@ -477,6 +488,8 @@ class Tablet : public AbstractTablet, public TransactionIntentApplier {
   uint64_t GetCurrentVersionSstFilesUncompressedSize() const;
   uint64_t GetCurrentVersionNumSSTFiles() const;
 
+  TabletCompactionDebt GetCompactionDebt() const;
+
   // Returns the number of memtables in intents and regular db-s.
   std::pair<int, int> GetNumMemtables() const;
 
@@ -120,6 +120,7 @@ DEFINE_int32(cql_proxy_webserver_port, 0, "Webserver port for CQL proxy");
 
 DEFINE_string(pgsql_proxy_bind_address, "", "Address to bind the PostgreSQL proxy to");
 DECLARE_int32(pgsql_proxy_webserver_port);
+DECLARE_bool(ysql_enable_shared_catalog_cache);
 
 DEFINE_int64(inbound_rpc_memory_limit, 0, "Inbound RPC memory limit");
 
@@ -142,6 +143,10 @@ TabletServer::TabletServer(const TabletServerOptions& opts)
       master_config_index_(0),
       tablet_server_service_(nullptr),
       shared_object_(CHECK_RESULT(TServerSharedObject::Create())) {
+  if (FLAGS_ysql_enable_shared_catalog_cache) {
+    ysql_catalog_cache_object_ = std::make_unique<YsqlCatalogCacheSharedObject>(
+        CHECK_RESULT(YsqlCatalogCacheSharedObject::Create()));
+  }
   SetConnectionContextFactory(rpc::CreateConnectionContextFactory<rpc::YBInboundConnectionContext>(
       FLAGS_inbound_rpc_memory_limit, mem_tracker()));
 
@@ -452,10 +457,17 @@ int TabletServer::GetSharedMemoryFd() {
   return shared_object_.GetFd();
 }
 
+int TabletServer::GetYsqlCatalogCacheSharedMemoryFd() {
+  return ysql_catalog_cache_object_ ? ysql_catalog_cache_object_->GetFd() : -1;
+}
+
 void TabletServer::SetYSQLCatalogVersion(uint64_t new_version) {
   std::lock_guard<simple_spinlock> l(lock_);
   if (new_version > ysql_catalog_version_) {
     ysql_catalog_version_ = new_version;
+    if (ysql_catalog_cache_object_) {
+      (*ysql_catalog_cache_object_)->Reset(new_version);
+    }
     shared_object_->SetYSQLCatalogVersion(new_version);
   } else if (new_version < ysql_catalog_version_) {
     LOG(DFATAL) << "Ignoring ysql catalog version update: new version too old. "
@@ -463,6 +475,22 @@ void TabletServer::SetYSQLCatalogVersion(uint64_t new_version) {
   }
 }
 
+Status TabletServer::UpdateYsqlCatalogCache(
+    uint64_t access_token, uint64_t ysql_catalog_version, const Slice& key, const Slice& value) {
+  if (!ysql_catalog_cache_object_) {
+    return STATUS(NotSupported, "Shared YSQL catalog cache is disabled");
+  }
+  if (access_token != (*ysql_catalog_cache_object_)->access_token()) {
+    return STATUS(NotAuthorized, "Invalid YSQL catalog cache access token");
+  }
+  // Holding the lock orders the insert with respect to resets on catalog version changes.
+  std::lock_guard<simple_spinlock> l(lock_);
+  if (ysql_catalog_version == ysql_catalog_version_) {
+    (*ysql_catalog_cache_object_)->Insert(ysql_catalog_version, key, value);
+  }
+  return Status::OK();
+}
+
 TabletPeerLookupIf* TabletServer::tablet_peer_lookup() {
   return tablet_manager_.get();
 }
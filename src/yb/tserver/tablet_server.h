@@ -178,6 +178,10 @@ class TabletServer : public server::RpcAndWebServerBase, public TabletServerIf {
     return ysql_catalog_version_;
   }
 
+  CHECKED_STATUS UpdateYsqlCatalogCache(
+      uint64_t access_token, uint64_t ysql_catalog_version, const Slice& key,
+      const Slice& value) override;
+
   virtual Env* GetEnv();
 
   virtual rocksdb::Env* GetRocksDBEnv();
@@ -188,6 +192,10 @@ class TabletServer : public server::RpcAndWebServerBase, public TabletServerIf {
   // Returns the file descriptor of this tablet server's shared memory segment.
   int GetSharedMemoryFd();
 
+  // Returns the file descriptor of the shared YSQL catalog cache segment, or -1 when the cache is
+  // disabled.
+  int GetYsqlCatalogCacheSharedMemoryFd();
+
   // Currently only used by cdc.
   virtual int32_t cluster_config_version() const {
     return std::numeric_limits<int32_t>::max();
@@ -259,6 +267,9 @@ class TabletServer : public server::RpcAndWebServerBase, public TabletServerIf {
   // Shared memory owned by the tablet server.
   TServerSharedObject shared_object_;
 
+  // Shared YSQL catalog cache, only allocated when --ysql_enable_shared_catalog_cache is set.
+  std::unique_ptr<YsqlCatalogCacheSharedObject> ysql_catalog_cache_object_;
+
   std::atomic<client::TransactionPool*> transaction_pool_{nullptr};
   std::mutex transaction_pool_mutex_;
   std::unique_ptr<client::TransactionManager> transaction_manager_holder_;
@@ -17,6 +17,7 @@
 #include "yb/client/meta_cache.h"
 #include "yb/server/clock.h"
 #include "yb/util/metrics.h"
+#include "yb/util/slice.h"
 
 namespace yb {
 
@@ -43,6 +44,13 @@ class TabletServerIf : public LocalTabletServer {
 
   virtual uint64_t ysql_catalog_version() const = 0;
 
+  // Stores the result of a YSQL catalog read in the catalog cache shared with the local postgres
+  // backends. The entry is ignored if the catalog version is not the current one. Fails unless
+  // access_token is the token of the shared catalog cache, which only local backends can read.
+  virtual CHECKED_STATUS UpdateYsqlCatalogCache(
+      uint64_t access_token, uint64_t ysql_catalog_version, const Slice& key,
+      const Slice& value) = 0;
+
   virtual const scoped_refptr<MetricEntity>& MetricEnt() const = 0;
 
   virtual client::TransactionPool* TransactionPool() = 0;
@@ -1574,12 +1574,24 @@ Result<ReadHybridTime> TabletServiceImpl::DoRead(ReadContext* read_context) {
     DCHECK_EQ(read_context->tablet->table_type(), TableType::YQL_TABLE_TYPE);
     ReadRequestPB* mutable_req = const_cast<ReadRequestPB*>(read_context->req);
     for (QLReadRequestPB& ql_read_req : *mutable_req->mutable_ql_batch()) {
-      // Update the remote endpoint.
-      ql_read_req.set_allocated_remote_endpoint(read_context->host_port_pb);
-      ql_read_req.set_allocated_proxy_uuid(mutable_req->mutable_proxy_uuid());
-      auto se = ScopeExit([&ql_read_req] {
-        ql_read_req.release_remote_endpoint();
-        ql_read_req.release_proxy_uuid();
+      // Update the remote endpoint. When the request was parsed into the RPC arena, the borrowed
+      // fields must not be handed over to the arena, since it would free them with the call.
+      const bool on_arena = ql_read_req.GetArena() != nullptr;
+      if (on_arena) {
+        ql_read_req.unsafe_arena_set_allocated_remote_endpoint(read_context->host_port_pb);
+        ql_read_req.unsafe_arena_set_allocated_proxy_uuid(mutable_req->mutable_proxy_uuid());
+      } else {
+        ql_read_req.set_allocated_remote_endpoint(read_context->host_port_pb);
+        ql_read_req.set_allocated_proxy_uuid(mutable_req->mutable_proxy_uuid());
+      }
+      auto se = ScopeExit([&ql_read_req, on_arena] {
+        if (on_arena) {
+          ql_read_req.unsafe_arena_release_remote_endpoint();
+          ql_read_req.unsafe_arena_release_proxy_uuid();
+        } else {
+          ql_read_req.release_remote_endpoint();
+          ql_read_req.release_proxy_uuid();
+        }
       });
 
       tablet::QLReadRequestResult result;
@@ -2100,6 +2112,18 @@ void TabletServiceImpl::TakeTransaction(const TakeTransactionRequestPB* req,
   context.RespondSuccess();
 }
 
+void TabletServiceImpl::UpdateYsqlCatalogCache(const UpdateYsqlCatalogCacheRequestPB* req,
+                                               UpdateYsqlCatalogCacheResponsePB* resp,
+                                               rpc::RpcContext context) {
+  const Status s = server_->UpdateYsqlCatalogCache(
+      req->access_token(), req->ysql_catalog_version(), req->key(), req->value());
+  if (!s.ok()) {
+    context.RespondFailure(s);
+    return;
+  }
+  context.RespondSuccess();
+}
+
 void TabletServiceImpl::Shutdown() {
 }
 
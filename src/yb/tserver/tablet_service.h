@@ -128,6 +128,10 @@ class TabletServiceImpl : public TabletServerServiceIf {
                        TakeTransactionResponsePB* resp,
                        rpc::RpcContext context) override;
 
+  void UpdateYsqlCatalogCache(const UpdateYsqlCatalogCacheRequestPB* req,
+                              UpdateYsqlCatalogCacheResponsePB* resp,
+                              rpc::RpcContext context) override;
+
   void Shutdown() override;
 
  private:
@@ -37,6 +37,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "yb/consensus/consensus.h"
@@ -182,6 +183,10 @@ Status TabletServerPathHandlers::Register(Webserver* server) {
       "/maintenance-manager", "",
       std::bind(&TabletServerPathHandlers::HandleMaintenanceManagerPage, this, _1, _2),
       true /* styled */, false /* is_on_nav_bar */);
+  server->RegisterPathHandler(
+      "/compactions", "",
+      std::bind(&TabletServerPathHandlers::HandleCompactionsPage, this, _1, _2),
+      true /* styled */, false /* is_on_nav_bar */);
 
   return Status::OK();
 }
@@ -415,6 +420,51 @@ void TabletServerPathHandlers::HandleTabletsPage(const Webserver::WebRequest& re
   *output << "</table>\n";
 }
 
+void TabletServerPathHandlers::HandleCompactionsPage(const Webserver::WebRequest& req,
+                                                     std::stringstream* output) {
+  vector<std::shared_ptr<TabletPeer>> peers;
+  tserver_->tablet_manager()->GetTabletPeers(&peers);
+
+  struct TabletCompactionInfo {
+    std::shared_ptr<TabletPeer> peer;
+    tablet::TabletCompactionDebt debt;
+  };
+  vector<TabletCompactionInfo> infos;
+  infos.reserve(peers.size());
+  for (auto& peer : peers) {
+    auto tablet = peer->shared_tablet();
+    if (tablet) {
+      infos.push_back({std::move(peer), tablet->GetCompactionDebt()});
+    }
+  }
+  // Tablets whose compactions are the most urgent first.
+  std::sort(infos.begin(), infos.end(), [](const auto& lhs, const auto& rhs) {
+    return std::make_tuple(lhs.debt.compaction_priority, lhs.debt.num_sorted_runs,
+                           lhs.debt.num_sst_files) >
+           std::make_tuple(rhs.debt.compaction_priority, rhs.debt.num_sorted_runs,
+                           rhs.debt.num_sst_files);
+  });
+
+  *output << "<h1>Compactions</h1>\n";
+  *output << "<table class='table table-striped'>\n";
+  *output << "  <tr><th>Table name</th><th>Tablet ID</th><th>Num SST Files</th>"
+      "<th>Num Sorted Runs</th><th>Compaction Pending</th><th>Running Compactions</th>"
+      "<th>Compaction Priority</th></tr>\n";
+  for (const auto& info : infos) {
+    const auto& debt = info.debt;
+    *output << Substitute(
+        "<tr><td>$0</td><td>$1</td><td>$2</td><td>$3</td><td>$4</td><td>$5</td><td>$6</td></tr>\n",
+        EscapeForHtmlToString(info.peer->tablet_metadata()->table_name()),
+        TabletLink(info.peer->tablet_id()),
+        debt.num_sst_files,
+        debt.num_sorted_runs,
+        debt.compaction_pending ? "yes" : "no",
+        debt.running_compactions,
+        debt.compaction_priority);
+  }
+  *output << "</table>\n";
+}
+
 namespace {
 
 bool CompareByMemberType(const RaftPeerPB& a, const RaftPeerPB& b) {
@@ -582,6 +632,8 @@ void TabletServerPathHandlers::HandleDashboardsPage(const Webserver::WebRequest&
   *output << GetDashboardLine("maintenance-manager", "Maintenance Manager",
                               "List of operations that are currently running and those "
                               "that are registered.");
+  *output << GetDashboardLine("compactions", "Compactions",
+                              "Compaction debt of the tablets, most urgent first.");
 }
 
 string TabletServerPathHandlers::GetDashboardLine(const std::string& link,
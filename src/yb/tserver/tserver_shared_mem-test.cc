@@ -0,0 +1,71 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "yb/tserver/tserver_shared_mem.h"
+
+#include "yb/util/test_util.h"
+
+namespace yb {
+namespace tserver {
+
+class TServerSharedMemoryTest : public YBTest {};
+
+TEST_F(TServerSharedMemoryTest, TestYsqlCatalogCache) {
+  auto owner = ASSERT_RESULT(YsqlCatalogCacheSharedObject::Create());
+  auto reader = ASSERT_RESULT(YsqlCatalogCacheSharedObject::OpenReadOnly(owner.GetFd()));
+
+  auto& cache = *owner;
+  const auto& shared_cache = *reader;
+  std::string value;
+
+  // Publishers need the token, which is only readable through the shared memory.
+  ASSERT_NE(0, shared_cache.access_token());
+  ASSERT_EQ(cache.access_token(), shared_cache.access_token());
+
+  // Nothing is cached for a version the cache does not hold.
+  ASSERT_FALSE(cache.Insert(1, "key1", "value1"));
+  cache.Reset(1);
+  ASSERT_EQ(1, shared_cache.catalog_version());
+
+  ASSERT_TRUE(cache.Insert(1, "key1", "value1"));
+  ASSERT_TRUE(cache.Insert(1, "key2", ""));
+  ASSERT_FALSE(cache.Insert(1, "key1", "other"));
+
+  // Entries are visible through the read-only mapping.
+  ASSERT_TRUE(shared_cache.Lookup(1, "key1", &value));
+  ASSERT_EQ("value1", value);
+  ASSERT_TRUE(shared_cache.Lookup(1, "key2", &value));
+  ASSERT_EQ("", value);
+  ASSERT_FALSE(shared_cache.Lookup(1, "key3", &value));
+  ASSERT_FALSE(shared_cache.Lookup(2, "key1", &value));
+
+  // A new catalog version invalidates all entries.
+  cache.Reset(2);
+  ASSERT_FALSE(shared_cache.Lookup(1, "key1", &value));
+  ASSERT_FALSE(shared_cache.Lookup(2, "key1", &value));
+  ASSERT_TRUE(cache.Insert(2, "key1", "value2"));
+  ASSERT_TRUE(shared_cache.Lookup(2, "key1", &value));
+  ASSERT_EQ("value2", value);
+
+  // Entries that don't fit are rejected.
+  std::string large_value(YsqlCatalogCacheSharedData::kDataSize, 'x');
+  ASSERT_FALSE(cache.Insert(2, "large", large_value));
+  ASSERT_FALSE(shared_cache.Lookup(2, "large", &value));
+}
+
+}  // namespace tserver
+}  // namespace yb
@@ -0,0 +1,131 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tserver/tserver_shared_mem.h"
+
+#include <string.h>
+
+#include <limits>
+
+#include "yb/util/hash_util.h"
+#include "yb/util/random_util.h"
+
+namespace yb {
+namespace tserver {
+
+static_assert((YsqlCatalogCacheSharedData::kNumBuckets &
+               (YsqlCatalogCacheSharedData::kNumBuckets - 1)) == 0,
+              "Number of catalog cache buckets must be a power of 2");
+
+YsqlCatalogCacheSharedData::YsqlCatalogCacheSharedData()
+    : access_token_(RandomUniformInt<uint64_t>(1, std::numeric_limits<uint64_t>::max())) {
+  for (auto& bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+size_t YsqlCatalogCacheSharedData::BucketIndex(const Slice& key) {
+  return HashUtil::MurmurHash2_64(key.data(), static_cast<int>(key.size()), 0 /* seed */) &
+         (kNumBuckets - 1);
+}
+
+void YsqlCatalogCacheSharedData::Reset(uint64_t catalog_version) {
+  const auto generation = generation_.load(std::memory_order_relaxed);
+  generation_.store(generation + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  for (auto& bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  used_bytes_.store(0, std::memory_order_relaxed);
+  catalog_version_.store(catalog_version, std::memory_order_relaxed);
+
+  generation_.store(generation + 2, std::memory_order_release);
+}
+
+bool YsqlCatalogCacheSharedData::Insert(
+    uint64_t catalog_version, const Slice& key, const Slice& value) {
+  if (catalog_version != catalog_version_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  const uint64_t used_bytes = used_bytes_.load(std::memory_order_relaxed);
+  const size_t entry_size = kEntryHeaderSize + key.size() + value.size();
+  if (entry_size > kDataSize - used_bytes) {
+    return false;
+  }
+
+  const size_t start = BucketIndex(key);
+  for (size_t probe = 0; probe != kNumBuckets; ++probe) {
+    auto& bucket = buckets_[(start + probe) & (kNumBuckets - 1)];
+    const uint64_t offset = bucket.load(std::memory_order_relaxed);
+    if (offset == 0) {
+      char* entry = data_ + used_bytes;
+      const uint32_t key_size = static_cast<uint32_t>(key.size());
+      const uint32_t value_size = static_cast<uint32_t>(value.size());
+      memcpy(entry, &key_size, sizeof(key_size));
+      memcpy(entry + sizeof(key_size), &value_size, sizeof(value_size));
+      memcpy(entry + kEntryHeaderSize, key.data(), key.size());
+      memcpy(entry + kEntryHeaderSize + key.size(), value.data(), value.size());
+      used_bytes_.store(used_bytes + entry_size, std::memory_order_relaxed);
+      // Publish the entry only after its bytes are in place.
+      bucket.store(used_bytes + 1, std::memory_order_release);
+      return true;
+    }
+    const char* entry = data_ + offset - 1;
+    uint32_t key_size;
+    memcpy(&key_size, entry, sizeof(key_size));
+    if (Slice(entry + kEntryHeaderSize, key_size) == key) {
+      return false;
+    }
+  }
+  return false;
+}
+
+bool YsqlCatalogCacheSharedData::Lookup(
+    uint64_t catalog_version, const Slice& key, std::string* value) const {
+  const auto generation = generation_.load(std::memory_order_acquire);
+  if ((generation & 1) != 0 ||
+      catalog_version != catalog_version_.load(std::memory_order_acquire)) {
+    return false;
+  }
+
+  bool found = false;
+  const size_t start = BucketIndex(key);
+  for (size_t probe = 0; probe != kNumBuckets; ++probe) {
+    const uint64_t offset = buckets_[(start + probe) & (kNumBuckets - 1)].load(
+        std::memory_order_acquire);
+    // The bounds checks protect against entries that are overwritten by a concurrent reset.
+    if (offset == 0 || offset - 1 > kDataSize - kEntryHeaderSize) {
+      break;
+    }
+    const char* entry = data_ + offset - 1;
+    uint32_t key_size;
+    uint32_t value_size;
+    memcpy(&key_size, entry, sizeof(key_size));
+    memcpy(&value_size, entry + sizeof(key_size), sizeof(value_size));
+    if (static_cast<uint64_t>(key_size) + value_size > kDataSize - kEntryHeaderSize - offset + 1) {
+      break;
+    }
+    if (Slice(entry + kEntryHeaderSize, key_size) == key) {
+      value->assign(entry + kEntryHeaderSize + key_size, value_size);
+      found = true;
+      break;
+    }
+  }
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return found && generation_.load(std::memory_order_relaxed) == generation;
+}
+
+}  // namespace tserver
+}  // namespace yb
@@ -15,14 +15,74 @@
 #define YB_TSERVER_TSERVER_SHARED_MEM_H
 
 #include <atomic>
+#include <string>
 
 #include "yb/util/shared_mem.h"
+#include "yb/util/slice.h"
 
 #include "yb/tserver/tserver_util_fwd.h"
 
 namespace yb {
 namespace tserver {
 
+// Serialized results of YSQL catalog reads, shared by the postgres backends of a tablet server.
+// All entries belong to a single catalog version, the cache is reset when the version changes.
+//
+// The tablet server is the only writer and must serialize Reset and Insert calls. Entries are
+// append-only within a generation, so backends read the segment without locks: they copy an
+// entry out and discard the copy if the generation changed meanwhile (seqlock).
+//
+// Backends publish entries through the tablet server, presenting the access token stored here.
+// Only processes that map this segment can read the token, so remote clients cannot add entries.
+//
+// The cache lives in its own segment, which the tablet server only creates when
+// --ysql_enable_shared_catalog_cache is set.
+class YsqlCatalogCacheSharedData {
+ public:
+  static constexpr size_t kNumBuckets = 16384;
+  static constexpr size_t kDataSize = 32 * 1024 * 1024;
+
+  YsqlCatalogCacheSharedData();
+
+  // Drops all entries and starts caching reads of the given catalog version.
+  void Reset(uint64_t catalog_version);
+
+  // Adds an entry if the cache holds the given catalog version, has room for the entry and does
+  // not contain the key yet. Returns true if the entry was added.
+  bool Insert(uint64_t catalog_version, const Slice& key, const Slice& value);
+
+  // Copies the value cached for key to value if the cache holds the given catalog version.
+  // Returns false on miss, including when the cache was reset during the lookup.
+  bool Lookup(uint64_t catalog_version, const Slice& key, std::string* value) const;
+
+  uint64_t catalog_version() const {
+    return catalog_version_.load(std::memory_order_acquire);
+  }
+
+  uint64_t access_token() const {
+    return access_token_;
+  }
+
+ private:
+  // Entry layout: key size (uint32), value size (uint32), key bytes, value bytes.
+  static constexpr size_t kEntryHeaderSize = 2 * sizeof(uint32_t);
+
+  static size_t BucketIndex(const Slice& key);
+
+  const uint64_t access_token_;
+
+  // Incremented before and after a reset, so it is odd while a reset is in progress.
+  std::atomic<uint64_t> generation_{0};
+  std::atomic<uint64_t> catalog_version_{0};
+  std::atomic<uint64_t> used_bytes_{0};
+
+  // Offset of an entry in data_ plus one, or zero for an empty bucket. Open addressing with
+  // linear probing.
+  std::atomic<uint64_t> buckets_[kNumBuckets];
+
+  char data_[kDataSize];
+};
+
 class TServerSharedData {
  public:
   TServerSharedData() {
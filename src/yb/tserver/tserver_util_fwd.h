@@ -22,6 +22,9 @@ namespace tserver {
 class TServerSharedData;
 typedef SharedMemoryObject<TServerSharedData> TServerSharedObject;
 
+class YsqlCatalogCacheSharedData;
+typedef SharedMemoryObject<YsqlCatalogCacheSharedData> YsqlCatalogCacheSharedObject;
+
 } // namespace tserver
 } // namespace yb
 
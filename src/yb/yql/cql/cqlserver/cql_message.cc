@@ -978,6 +978,13 @@ void CQLResponse::Serialize(const CompressionScheme compression_scheme, faststri
       mesg->data(), start_pos + kHeaderPosLength, mesg->size() - start_pos - kMessageHeaderLength);
 }
 
+void CQLResponse::SerializeToBuffers(const CompressionScheme compression_scheme,
+                                     CQLResponseBuffers* buffers) const {
+  faststring mesg;
+  Serialize(compression_scheme, &mesg);
+  buffers->emplace_back(mesg);
+}
+
 void CQLResponse::SerializeHeader(const bool compress, faststring* mesg) const {
   uint8_t buffer[kMessageHeaderLength];
   SERIALIZE_BYTE(buffer, kHeaderPosVersion, version());
@@ -1527,6 +1534,31 @@ RowsResultResponse::RowsResultResponse(
 RowsResultResponse::~RowsResultResponse() {
 }
 
+void RowsResultResponse::SerializeToBuffers(const CompressionScheme compression_scheme,
+                                            CQLResponseBuffers* buffers) const {
+  // The whole body needs to be in one piece to be compressed. Small rows data is cheaper to copy
+  // than to send as a separate buffer.
+  const string& rows_data = result_->rows_data();
+  if (compression_scheme != CQLMessage::CompressionScheme::kNone ||
+      rows_data.size() < kMinSeparateRowsDataSize) {
+    return ResultResponse::SerializeToBuffers(compression_scheme, buffers);
+  }
+
+  // Serialize the header, the result kind and the rows metadata, then set the length in the
+  // header to cover the rows data that follows in the next buffer.
+  faststring mesg;
+  SerializeHeader(false /* compress */, &mesg);
+  SerializeInt(static_cast<int32_t>(Kind::ROWS), &mesg);
+  SerializeRowsMetadata(
+      RowsMetadata(result_->table_name(), result_->column_schemas(),
+                   result_->paging_state(), skip_metadata_), &mesg);
+  NetworkByteOrder::Store32(
+      mesg.data() + kHeaderPosLength,
+      static_cast<int32_t>(mesg.size() + rows_data.size() - kMessageHeaderLength));
+  buffers->emplace_back(mesg);
+  buffers->emplace_back(rows_data);
+}
+
 void RowsResultResponse::SerializeResultBody(faststring* mesg) const {
   SerializeRowsMetadata(
       RowsMetadata(result_->table_name(), result_->column_schemas(),
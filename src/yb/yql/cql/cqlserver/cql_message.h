@@ -25,12 +25,15 @@
 #include <set>
 #include <unordered_map>
 
+#include <boost/container/small_vector.hpp>
+
 #include "yb/common/wire_protocol.h"
 #include "yb/rpc/server_event.h"
 #include "yb/yql/cql/ql/util/statement_params.h"
 #include "yb/yql/cql/ql/util/statement_result.h"
 
 #include "yb/util/memory/memory_usage.h"
+#include "yb/util/ref_cnt_buffer.h"
 #include "yb/util/slice.h"
 #include "yb/util/status.h"
 #include "yb/util/net/sockaddr.h"
@@ -476,11 +479,20 @@ class RegisterRequest : public CQLRequest {
 };
 
 // ------------------------------------ CQL response -----------------------------------
+// Buffers of a serialized response that are sent to the client one after another.
+using CQLResponseBuffers = boost::container::small_vector<RefCntBuffer, 2>;
+
 class CQLResponse : public CQLMessage {
  public:
   virtual ~CQLResponse();
   virtual void Serialize(CompressionScheme compression_scheme, faststring* mesg) const;
 
+  // Serialize the response into the buffers to send. By default, the whole response is serialized
+  // into one buffer. A response that carries a large, already serialized part of its body can send
+  // it as a buffer of its own instead of copying it into the message.
+  virtual void SerializeToBuffers(CompressionScheme compression_scheme,
+                                  CQLResponseBuffers* buffers) const;
+
   Events registered_events() const { return registered_events_; }
   void set_registered_events(Events events) { registered_events_ = events; }
 
@@ -751,10 +763,18 @@ class RowsResultResponse : public ResultResponse {
 
   virtual ~RowsResultResponse() override;
 
+  // Send the rows data, which the tablet servers have already encoded in the CQL wire format, as
+  // a separate buffer unless the response is compressed.
+  void SerializeToBuffers(CompressionScheme compression_scheme,
+                          CQLResponseBuffers* buffers) const override;
+
  protected:
   virtual void SerializeResultBody(faststring* mesg) const override;
 
  private:
+  // Rows data smaller than this is copied into the message rather than sent as a separate buffer.
+  static constexpr size_t kMinSeparateRowsDataSize = 4096;
+
   const ql::RowsResult::SharedPtr result_;
   const bool skip_metadata_;
 };
@@ -24,9 +24,16 @@
 #include "yb/rpc/rpc_context.h"
 
 #include "yb/util/crypt.h"
+#include "yb/util/flag_tags.h"
 
 #include "yb/yql/cql/cqlserver/cql_service.h"
 
+DEFINE_bool(cql_auto_parameterize_queries, false,
+            "Execute unprepared DML queries as cached prepared statements of their text with "
+            "the integer and string literals replaced by bind markers, instead of parsing and "
+            "analyzing every query.");
+TAG_FLAG(cql_auto_parameterize_queries, advanced);
+
 METRIC_DEFINE_histogram(
     server, handler_latency_yb_cqlserver_CQLServerService_GetProcessor,
     "Time spent to get a processor for processing a CQL query request.",
@@ -139,7 +146,9 @@ CQLProcessor::CQLProcessor(CQLServiceImpl* service_impl, const CQLProcessorListP
       service_impl_(service_impl),
       cql_metrics_(service_impl->cql_metrics()),
       pos_(pos),
-      statement_executed_cb_(Bind(&CQLProcessor::StatementExecuted, Unretained(this))) {
+      statement_executed_cb_(Bind(&CQLProcessor::StatementExecuted, Unretained(this))),
+      auto_parameterized_statement_executed_cb_(
+          Bind(&CQLProcessor::AutoParameterizedStatementExecuted, Unretained(this))) {
   IncrementCounter(cql_metrics_->cql_processors_created_);
   IncrementGauge(cql_metrics_->cql_processors_alive_);
 }
@@ -192,9 +201,9 @@ void CQLProcessor::SendResponse(const CQLResponse& response) {
   MonoTime response_begin = MonoTime::Now();
   const auto& context = static_cast<const CQLConnectionContext&>(call_->connection()->context());
   const auto compression_scheme = context.compression_scheme();
-  faststring msg;
-  response.Serialize(compression_scheme, &msg);
-  call_->RespondSuccess(RefCntBuffer(msg), cql_metrics_->rpc_method_metrics_);
+  CQLResponseBuffers buffers;
+  response.SerializeToBuffers(compression_scheme, &buffers);
+  call_->RespondSuccess(std::move(buffers), cql_metrics_->rpc_method_metrics_);
 
   MonoTime response_done = MonoTime::Now();
   cql_metrics_->time_to_process_request_->Increment(
@@ -211,6 +220,8 @@ void CQLProcessor::SendResponse(const CQLResponse& response) {
   request_ = nullptr;
   stmts_.clear();
   parse_trees_.clear();
+  auto_parameterized_stmt_ = nullptr;
+  auto_parameterized_params_ = nullptr;
   SetCurrentSession(nullptr);
   service_impl_->ReturnProcessor(pos_);
 }
@@ -318,10 +329,76 @@ CQLResponse* CQLProcessor::ProcessRequest(const ExecuteRequest& req) {
 
 CQLResponse* CQLProcessor::ProcessRequest(const QueryRequest& req) {
   VLOG(1) << "QUERY " << req.query();
+  if (FLAGS_cql_auto_parameterize_queries && req.params().values.empty() &&
+      ExecuteAutoParameterized(req)) {
+    return nullptr;
+  }
   RunAsync(req.query(), req.params(), statement_executed_cb_);
   return nullptr;
 }
 
+bool CQLProcessor::ExecuteAutoParameterized(const QueryRequest& req) {
+  std::string normalized;
+  std::vector<CQLQueryLiteral> literals;
+  if (!AutoParameterizeQuery(req.query(), &normalized, &literals)) {
+    return false;
+  }
+  const CQLMessage::QueryId query_id = CQLStatement::GetQueryId(
+      ql_env_.CurrentKeyspace(), normalized);
+  if (!service_impl_->IsAutoParameterizable(query_id)) {
+    return false;
+  }
+
+  // Look up or prepare the statement the same way as a PREPARE request does, so that its parse
+  // tree is accounted for and aged out together with the other prepared statements.
+  shared_ptr<CQLStatement> stmt = service_impl_->AllocatePreparedStatement(
+      query_id, ql_env_.CurrentKeyspace(), normalized);
+  PreparedResult::UniPtr result;
+  Status s = stmt->Prepare(this, service_impl_->prepared_stmts_mem_tracker(),
+                           false /* internal */, &result);
+  if (!s.ok()) {
+    VLOG(1) << "Failed to prepare auto-parameterized query " << normalized << ": " << s;
+    service_impl_->DeletePreparedStatement(stmt);
+    // Lexical and syntax errors will not go away, while semantic errors may depend on the current
+    // metadata and the other errors (stale metadata, server errors etc.) may be transient.
+    if (s.IsQLError() && GetErrorCode(s) <= ErrorCode::LEXICAL_ERROR &&
+        GetErrorCode(s) > ErrorCode::SEM_ERROR) {
+      service_impl_->SetNotAutoParameterizable(query_id);
+    }
+    return false;
+  }
+  if (result == nullptr) {
+    service_impl_->SetNotAutoParameterizable(query_id);
+    return false;
+  }
+
+  auto params = std::make_unique<CQLLiteralParameters>(req.params());
+  s = params->Bind(literals, result->bind_variable_schemas());
+  if (!s.ok()) {
+    VLOG(1) << "Failed to bind literals of auto-parameterized query " << normalized << ": " << s;
+    // A literal of a type that cannot be bound directly will not be bound in later queries either.
+    if (s.IsNotSupported()) {
+      service_impl_->SetNotAutoParameterizable(query_id);
+    }
+    return false;
+  }
+
+  // The statement and its parameters must be in place before the execution starts, since the
+  // executed callback may run, and release this processor, before ExecuteAsync returns.
+  auto_parameterized_stmt_ = stmt;
+  auto_parameterized_params_ = std::move(params);
+  s = stmt->ExecuteAsync(this, *auto_parameterized_params_,
+                         auto_parameterized_statement_executed_cb_);
+  if (!s.ok()) {
+    // The execution was not started, so the callback has not run and the query can fall back to
+    // the regular parse and analysis.
+    auto_parameterized_stmt_ = nullptr;
+    auto_parameterized_params_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
 CQLResponse* CQLProcessor::ProcessRequest(const BatchRequest& req) {
   VLOG(1) << "BATCH " << req.queries().size();
 
@@ -392,6 +469,16 @@ shared_ptr<const CQLStatement> CQLProcessor::GetPreparedStatement(const CQLMessa
   return stmt;
 }
 
+void CQLProcessor::AutoParameterizedStatementExecuted(const Status& s,
+                                                      const ExecutedResult::SharedPtr& result) {
+  // Drop the statement from the cache if its metadata has become stale, so that the retry of the
+  // query prepares it again.
+  if (!s.ok() && auto_parameterized_stmt_->stale()) {
+    service_impl_->DeletePreparedStatement(auto_parameterized_stmt_);
+  }
+  StatementExecuted(s, result);
+}
+
 void CQLProcessor::StatementExecuted(const Status& s, const ExecutedResult::SharedPtr& result) {
   unique_ptr<CQLResponse> response(s.ok() ? ProcessResult(result) : ProcessError(s));
   PrepareAndSendResponse(response);
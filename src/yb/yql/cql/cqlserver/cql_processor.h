@@ -88,9 +88,17 @@ class CQLProcessor : public ql::QLProcessor {
   // Get a prepared statement and adds it to the set of statements currently being executed.
   std::shared_ptr<const CQLStatement> GetPreparedStatement(const CQLMessage::QueryId& id);
 
+  // Execute a query as the cached prepared statement of its auto-parameterized text, with its
+  // literals as bind variables. Returns false if the query has to be parsed and analyzed instead.
+  bool ExecuteAutoParameterized(const QueryRequest& req);
+
   // Statement executed callback.
   void StatementExecuted(const Status& s, const ql::ExecutedResult::SharedPtr& result = nullptr);
 
+  // Auto-parameterized statement executed callback.
+  void AutoParameterizedStatementExecuted(const Status& s,
+                                          const ql::ExecutedResult::SharedPtr& result);
+
   // Process statement execution result and error.
   CQLResponse* ProcessResult(const ql::ExecutedResult::SharedPtr& result);
   CQLResponse* ProcessError(const Status& s,
@@ -117,6 +125,11 @@ class CQLProcessor : public ql::QLProcessor {
   std::unordered_set<std::shared_ptr<const CQLStatement>> stmts_;
   std::unordered_set<ql::ParseTree::UniPtr> parse_trees_;
 
+  // Auto-parameterized statement being executed for a query and the literals bound to it. The
+  // statement is kept apart from "stmts_" because the client did not prepare it.
+  std::shared_ptr<const CQLStatement> auto_parameterized_stmt_;
+  std::unique_ptr<CQLLiteralParameters> auto_parameterized_params_;
+
   // Current retry count.
   int retry_count_ = 0;
 
@@ -124,8 +137,9 @@ class CQLProcessor : public ql::QLProcessor {
   MonoTime parse_begin_;
   MonoTime execute_begin_;
 
-  // Statement executed callback.
+  // Statement executed callbacks.
   ql::StatementExecutedCallback statement_executed_cb_;
+  ql::StatementExecutedCallback auto_parameterized_statement_executed_cb_;
 
   //----------------------------------------------------------------------------------------------
 
@@ -18,12 +18,15 @@
 #include "yb/yql/cql/cqlserver/cql_service.h"
 #include "yb/yql/cql/cqlserver/cql_statement.h"
 
+#include "yb/yql/cql/ql/util/prefetched_pages.h"
+
 #include "yb/rpc/connection.h"
 #include "yb/rpc/messenger.h"
 #include "yb/rpc/reactor.h"
 #include "yb/rpc/rpc_introspection.pb.h"
 
 #include "yb/util/debug/trace_event.h"
+#include "yb/util/flag_tags.h"
 #include "yb/util/size_literals.h"
 
 using yb::cqlserver::CQLMessage;
@@ -55,6 +58,11 @@ DEFINE_int32(max_message_length, 254_MB,
 DEFINE_bool(cql_server_always_send_events, false,
             "All CQL connections automatically subscribed for all CQL events.");
 
+DEFINE_int64(cql_prefetched_pages_memory_limit, 256_MB,
+             "The maximum memory used by the pages of SELECT results read ahead for all CQL "
+             "connections. Pages that do not fit are dropped and read again when requested.");
+TAG_FLAG(cql_prefetched_pages_memory_limit, advanced);
+
 namespace yb {
 namespace cqlserver {
 
@@ -73,6 +81,12 @@ CQLConnectionContext::CQLConnectionContext(
   if (FLAGS_cql_server_always_send_events) {
     registered_events_ = CQLMessage::kAllEvents;
   }
+
+  if (call_tracker) {
+    ql_session_->set_prefetched_pages(std::make_shared<ql::PrefetchedPages>(
+        MemTracker::FindOrCreateTracker(FLAGS_cql_prefetched_pages_memory_limit,
+                                        "CQL Prefetched Pages", call_tracker)));
+  }
 }
 
 Result<rpc::ProcessDataResult> CQLConnectionContext::ProcessCalls(
@@ -154,9 +168,11 @@ const std::string& CQLInboundCall::method_name() const {
 
 void CQLInboundCall::Serialize(boost::container::small_vector_base<RefCntBuffer>* output) {
   TRACE_EVENT0("rpc", "CQLInboundCall::Serialize");
-  CHECK_GT(response_msg_buf_.size(), 0);
+  CHECK(!response_msg_bufs_.empty());
 
-  output->push_back(std::move(response_msg_buf_));
+  for (auto& buffer : response_msg_bufs_) {
+    output->push_back(std::move(buffer));
+  }
 }
 
 void CQLInboundCall::RespondFailure(rpc::ErrorStatusPB::RpcErrorCodePB error_code,
@@ -187,15 +203,16 @@ void CQLInboundCall::RespondFailure(rpc::ErrorStatusPB::RpcErrorCodePB error_cod
       break;
     }
   }
-  response_msg_buf_ = RefCntBuffer(msg);
+  response_msg_bufs_.clear();
+  response_msg_bufs_.emplace_back(msg);
 
   QueueResponse(/* is_success */ false);
 }
 
-void CQLInboundCall::RespondSuccess(const RefCntBuffer& buffer,
+void CQLInboundCall::RespondSuccess(CQLResponseBuffers buffers,
                                     const yb::rpc::RpcMethodMetrics& metrics) {
   RecordHandlingCompleted(metrics.handler_latency);
-  response_msg_buf_ = buffer;
+  response_msg_bufs_ = std::move(buffers);
 
   QueueResponse(/* is_success */ true);
 }
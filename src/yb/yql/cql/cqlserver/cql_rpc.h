@@ -113,9 +113,9 @@ class CQLInboundCall : public rpc::InboundCall {
 
   CoarseTimePoint GetClientDeadline() const override;
 
-  // Return the response message buffer.
-  RefCntBuffer& response_msg_buf() {
-    return response_msg_buf_;
+  // Return the response message buffers.
+  CQLResponseBuffers& response_msg_bufs() {
+    return response_msg_bufs_;
   }
 
   // Return the SQL session of this CQL call.
@@ -128,7 +128,7 @@ class CQLInboundCall : public rpc::InboundCall {
   const std::string& service_name() const override;
   const std::string& method_name() const override;
   void RespondFailure(rpc::ErrorStatusPB::RpcErrorCodePB error_code, const Status& status) override;
-  void RespondSuccess(const RefCntBuffer& buffer, const yb::rpc::RpcMethodMetrics& metrics);
+  void RespondSuccess(CQLResponseBuffers buffers, const yb::rpc::RpcMethodMetrics& metrics);
   void GetCallDetails(rpc::RpcCallInProgressPB *call_in_progress_pb) const;
   void SetRequest(std::shared_ptr<const CQLRequest> request, CQLServiceImpl* service_impl) {
     service_impl_ = service_impl;
@@ -143,11 +143,11 @@ class CQLInboundCall : public rpc::InboundCall {
 
   size_t DynamicMemoryUsage() const override {
     // TODO - who is tracking request_ memory usage ?
-    return DynamicMemoryUsageOf(response_msg_buf_);
+    return DynamicMemoryUsageOf(response_msg_bufs_);
   }
 
  private:
-  RefCntBuffer response_msg_buf_;
+  CQLResponseBuffers response_msg_bufs_;
   const ql::QLSession::SharedPtr ql_session_;
   uint16_t stream_id_;
   std::shared_ptr<const CQLRequest> request_;
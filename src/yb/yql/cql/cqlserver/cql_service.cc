@@ -31,6 +31,7 @@
 
 #include "yb/util/bytes_formatter.h"
 #include "yb/util/mem_tracker.h"
+#include "yb/util/shared_lock.h"
 
 using namespace std::placeholders;
 using namespace yb::size_literals;
@@ -70,6 +71,7 @@ CQLServiceImpl::CQLServiceImpl(CQLServer* server, const CQLServerOptions& opts,
           &opts, server->metric_entity(), server->mem_tracker(),
           server->tserver() ? server->tserver()->messenger() : nullptr),
       next_available_processor_(processors_.end()),
+      prepared_stmts_clock_hand_(prepared_stmts_list_.end()),
       messenger_(server->messenger()),
       transaction_pool_provider_(std::move(transaction_pool_provider)) {
   // TODO(ENG-446): Handle metrics for all the methods individually.
@@ -167,8 +169,18 @@ void CQLServiceImpl::ReturnProcessor(const CQLProcessorListPos& pos) {
 
 shared_ptr<CQLStatement> CQLServiceImpl::AllocatePreparedStatement(
     const CQLMessage::QueryId& query_id, const string& keyspace, const string& query) {
-  // Get exclusive lock before allocating a prepared statement and updating the LRU list.
-  std::lock_guard<std::mutex> guard(prepared_stmts_mutex_);
+  // Return existing statement if found.
+  {
+    SharedLock<rw_spinlock> read_lock(prepared_stmts_lock_.get_lock());
+    const auto itr = prepared_stmts_map_.find(query_id);
+    if (itr != prepared_stmts_map_.end()) {
+      itr->second->MarkUsed();
+      return itr->second;
+    }
+  }
+
+  // Get exclusive lock before allocating a prepared statement and updating the clock list.
+  std::lock_guard<percpu_rwlock> guard(prepared_stmts_lock_);
 
   shared_ptr<CQLStatement> stmt;
   const auto itr = prepared_stmts_map_.find(query_id);
@@ -179,11 +191,11 @@ shared_ptr<CQLStatement> CQLServiceImpl::AllocatePreparedStatement(
     stmt = prepared_stmts_map_.emplace(
         query_id, std::make_shared<CQLStatement>(
             keyspace, query, prepared_stmts_list_.end())).first->second;
-    InsertLruPreparedStatementUnlocked(stmt);
+    InsertClockPreparedStatementUnlocked(stmt);
   } else {
-    // Return existing statement if found.
+    // Return the statement allocated by another client in the meantime.
     stmt = itr->second;
-    MoveLruPreparedStatementUnlocked(stmt);
+    stmt->MarkUsed();
   }
 
   VLOG(1) << "InsertPreparedStatement: CQL prepared statement cache count = "
@@ -195,33 +207,34 @@ shared_ptr<CQLStatement> CQLServiceImpl::AllocatePreparedStatement(
 
 shared_ptr<const CQLStatement> CQLServiceImpl::GetPreparedStatement(
     const CQLMessage::QueryId& query_id) {
-  // Get exclusive lock before looking up a prepared statement and updating the LRU list.
-  std::lock_guard<std::mutex> guard(prepared_stmts_mutex_);
-
-  const auto itr = prepared_stmts_map_.find(query_id);
-  if (itr == prepared_stmts_map_.end()) {
-    return nullptr;
+  shared_ptr<CQLStatement> stmt;
+  {
+    // Get shared lock to look up a prepared statement. Lookups do not reorder the clock list.
+    SharedLock<rw_spinlock> read_lock(prepared_stmts_lock_.get_lock());
+    const auto itr = prepared_stmts_map_.find(query_id);
+    if (itr == prepared_stmts_map_.end()) {
+      return nullptr;
+    }
+    stmt = itr->second;
   }
 
-  shared_ptr<CQLStatement> stmt = itr->second;
-
   // If the statement has not finished preparing, do not return it.
   if (stmt->unprepared()) {
     return nullptr;
   }
   // If the statement is stale, delete it.
   if (stmt->stale()) {
-    DeletePreparedStatementUnlocked(stmt);
+    DeletePreparedStatement(stmt);
     return nullptr;
   }
 
-  MoveLruPreparedStatementUnlocked(stmt);
+  stmt->MarkUsed();
   return stmt;
 }
 
 void CQLServiceImpl::DeletePreparedStatement(const shared_ptr<const CQLStatement>& stmt) {
   // Get exclusive lock before deleting the prepared statement.
-  std::lock_guard<std::mutex> guard(prepared_stmts_mutex_);
+  std::lock_guard<percpu_rwlock> guard(prepared_stmts_lock_);
 
   DeletePreparedStatementUnlocked(stmt);
 
@@ -230,14 +243,23 @@ void CQLServiceImpl::DeletePreparedStatement(const shared_ptr<const CQLStatement
           << ", memory usage = " << prepared_stmts_mem_tracker_->consumption();
 }
 
-void CQLServiceImpl::InsertLruPreparedStatementUnlocked(const shared_ptr<CQLStatement>& stmt) {
-  // Insert the statement at the front of the LRU list.
-  stmt->set_pos(prepared_stmts_list_.insert(prepared_stmts_list_.begin(), stmt));
+bool CQLServiceImpl::IsAutoParameterizable(const CQLMessage::QueryId& id) {
+  SharedLock<rw_spinlock> read_lock(prepared_stmts_lock_.get_lock());
+  return unparameterizable_stmts_.count(id) == 0;
+}
+
+void CQLServiceImpl::SetNotAutoParameterizable(const CQLMessage::QueryId& id) {
+  std::lock_guard<percpu_rwlock> guard(prepared_stmts_lock_);
+  // Start over rather than grow without bounds when there are too many distinct statements.
+  if (unparameterizable_stmts_.size() >= kMaxUnparameterizableStatements) {
+    unparameterizable_stmts_.clear();
+  }
+  unparameterizable_stmts_.insert(id);
 }
 
-void CQLServiceImpl::MoveLruPreparedStatementUnlocked(const shared_ptr<CQLStatement>& stmt) {
-  // Move the statement to the front of the LRU list.
-  prepared_stmts_list_.splice(prepared_stmts_list_.begin(), prepared_stmts_list_, stmt->pos());
+void CQLServiceImpl::InsertClockPreparedStatementUnlocked(const shared_ptr<CQLStatement>& stmt) {
+  // Insert the statement just behind the clock hand so that it is the last one the hand reaches.
+  stmt->set_pos(prepared_stmts_list_.insert(prepared_stmts_clock_hand_, stmt));
 }
 
 void CQLServiceImpl::DeletePreparedStatementUnlocked(
@@ -250,23 +272,39 @@ void CQLServiceImpl::DeletePreparedStatementUnlocked(
   if (itr != prepared_stmts_map_.end() && itr->second == stmt) {
     prepared_stmts_map_.erase(itr);
   }
-  // Remove statement from LRU list only when it is in the list, i.e. pos() != end().
+  // Remove statement from clock list only when it is in the list, i.e. pos() != end(). Move the
+  // clock hand past the statement first if it points to it.
   if (stmt->pos() != prepared_stmts_list_.end()) {
+    if (prepared_stmts_clock_hand_ == stmt->pos()) {
+      ++prepared_stmts_clock_hand_;
+    }
     prepared_stmts_list_.erase(stmt->pos());
     stmt->set_pos(prepared_stmts_list_.end());
   }
 }
 
 void CQLServiceImpl::CollectGarbage(size_t required) {
-  // Get exclusive lock before deleting the least recently used statement at the end of the LRU
-  // list from the cache.
-  std::lock_guard<std::mutex> guard(prepared_stmts_mutex_);
-
-  if (!prepared_stmts_list_.empty()) {
-    DeletePreparedStatementUnlocked(prepared_stmts_list_.back());
+  // Get exclusive lock before deleting a statement from the cache.
+  std::lock_guard<percpu_rwlock> guard(prepared_stmts_lock_);
+
+  // Advance the clock hand, clearing the reference bits of the statements it passes, until it
+  // reaches a statement whose bit is not set. Concurrent lookups may set the bits again, so give
+  // up after two rounds and delete the statement the hand points to anyway.
+  const size_t max_steps = 2 * prepared_stmts_list_.size();
+  for (size_t steps = 0; !prepared_stmts_list_.empty(); ++steps) {
+    if (prepared_stmts_clock_hand_ == prepared_stmts_list_.end()) {
+      prepared_stmts_clock_hand_ = prepared_stmts_list_.begin();
+    }
+    const auto& stmt = *prepared_stmts_clock_hand_;
+    if (steps < max_steps && stmt->ResetUsed()) {
+      ++prepared_stmts_clock_hand_;
+      continue;
+    }
+    DeletePreparedStatementUnlocked(stmt);
+    break;
   }
 
-  VLOG(1) << "DeleteLruPreparedStatement: CQL prepared statement cache count = "
+  VLOG(1) << "DeleteClockPreparedStatement: CQL prepared statement cache count = "
           << prepared_stmts_map_.size() << "/" << prepared_stmts_list_.size()
           << ", memory usage = " << prepared_stmts_mem_tracker_->consumption();
 }
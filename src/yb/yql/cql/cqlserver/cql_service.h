@@ -17,6 +17,7 @@
 #ifndef YB_YQL_CQL_CQLSERVER_CQL_SERVICE_H_
 #define YB_YQL_CQL_CQLSERVER_CQL_SERVICE_H_
 
+#include <unordered_set>
 #include <vector>
 
 #include "yb/client/client_fwd.h"
@@ -28,6 +29,7 @@
 #include "yb/yql/cql/cqlserver/cql_server_options.h"
 #include "yb/yql/cql/ql/statement.h"
 
+#include "yb/util/locks.h"
 #include "yb/util/string_case.h"
 
 #include "yb/client/async_initializer.h"
@@ -74,6 +76,11 @@ class CQLServiceImpl : public CQLServerServiceIf,
   // Delete the prepared statement from the cache.
   void DeletePreparedStatement(const std::shared_ptr<const CQLStatement>& stmt);
 
+  // Check or record whether queries auto-parameterized to the statement with the given id can be
+  // executed as that statement (see CQLProcessor::ExecuteAutoParameterized).
+  bool IsAutoParameterizable(const CQLMessage::QueryId& id);
+  void SetNotAutoParameterizable(const CQLMessage::QueryId& id);
+
   // Return the memory tracker for prepared statements.
   const MemTrackerPtr& prepared_stmts_mem_tracker() const {
     return prepared_stmts_mem_tracker_;
@@ -99,23 +106,21 @@ class CQLServiceImpl : public CQLServerServiceIf,
 
  private:
   constexpr static int kRpcTimeoutSec = 5;
+  constexpr static size_t kMaxUnparameterizableStatements = 10000;
 
   // Either gets an available processor or creates a new one.
   CQLProcessor *GetProcessor();
 
-  // Insert a prepared statement at the front of the LRU list. "prepared_stmts_mutex_" needs to be
-  // locked before this call.
-  void InsertLruPreparedStatementUnlocked(const std::shared_ptr<CQLStatement>& stmt);
-
-  // Move a prepared statement to the front of the LRU list. "prepared_stmts_mutex_" needs to be
-  // locked before this call.
-  void MoveLruPreparedStatementUnlocked(const std::shared_ptr<CQLStatement>& stmt);
+  // Insert a prepared statement into the clock list just behind the clock hand.
+  // "prepared_stmts_lock_" needs to be locked exclusively before this call.
+  void InsertClockPreparedStatementUnlocked(const std::shared_ptr<CQLStatement>& stmt);
 
-  // Delete a prepared statement from the cache and the LRU list. "prepared_stmts_mutex_" needs to
-  // be locked before this call.
+  // Delete a prepared statement from the cache and the clock list. "prepared_stmts_lock_" needs to
+  // be locked exclusively before this call.
   void DeletePreparedStatementUnlocked(const std::shared_ptr<const CQLStatement> stmt);
 
-  // Delete the least recently used prepared statement from the cache to free up memory.
+  // Delete a prepared statement that has not been used since the clock hand last passed it from
+  // the cache to free up memory.
   void CollectGarbage(size_t required) override;
 
   // CQLServer of this service.
@@ -142,11 +147,19 @@ class CQLServiceImpl : public CQLServerServiceIf,
   // Prepared statements cache.
   CQLStatementMap prepared_stmts_map_;
 
-  // Prepared statements LRU list (least recently used one at the end).
+  // Prepared statements clock list and the clock hand that points to the next statement to be
+  // considered for eviction. Lookups only set the reference bit of a statement and do not reorder
+  // the list, so that they need not take the lock exclusively.
   CQLStatementList prepared_stmts_list_;
+  CQLStatementListPos prepared_stmts_clock_hand_;
+
+  // Ids of auto-parameterized statements that failed to prepare or to bind their literals.
+  std::unordered_set<CQLMessage::QueryId> unparameterizable_stmts_;
 
-  // Mutex that protects the prepared statements and the LRU list.
-  std::mutex prepared_stmts_mutex_;
+  // Lock that protects the prepared statements, the clock list and the unparameterizable
+  // statements. Lookups take the shared lock of the current CPU only, so they do not contend
+  // with each other. Insertions and deletions take the lock exclusively.
+  percpu_rwlock prepared_stmts_lock_;
 
   std::shared_ptr<ql::Statement> auth_prepared_stmt_;
 
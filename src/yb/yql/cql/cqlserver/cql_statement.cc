@@ -17,6 +17,13 @@
 
 #include <openssl/md5.h>
 
+#include <cctype>
+#include <limits>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "yb/util/stol_utils.h"
+
 namespace yb {
 namespace cqlserver {
 
@@ -39,5 +46,200 @@ CQLMessage::QueryId CQLStatement::GetQueryId(const string& keyspace, const strin
   return CQLMessage::QueryId(util::to_char_ptr(md5), sizeof(md5));
 }
 
+namespace {
+
+bool IsWordChar(char c) {
+  return isalnum(c) || c == '_';
+}
+
+// Characters after which a literal is a value being compared with or assigned to.
+bool IsValueContext(char c) {
+  return c == '=' || c == '<' || c == '>' || c == '(' || c == ',' || c == '[' || c == '{' ||
+         c == ':';
+}
+
+// Returns the last non-space character of "text", or '\0' if there is none.
+char LastNonSpace(const std::string& text) {
+  for (auto it = text.rbegin(); it != text.rend(); ++it) {
+    if (!isspace(*it)) {
+      return *it;
+    }
+  }
+  return '\0';
+}
+
+template <class Int>
+Status SetIntegerValue(const std::string& text, QLValue* value, void (QLValue::*setter)(Int)) {
+  const int64_t int_value = VERIFY_RESULT(CheckedStoll(text));
+  if (int_value < std::numeric_limits<Int>::min() || int_value > std::numeric_limits<Int>::max()) {
+    return STATUS_FORMAT(InvalidArgument, "Literal $0 out of range", text);
+  }
+  (value->*setter)(static_cast<Int>(int_value));
+  return Status::OK();
+}
+
+Status ConvertLiteral(const CQLQueryLiteral& literal, const QLType& type, QLValue* value) {
+  switch (literal.kind) {
+    case CQLQueryLiteral::Kind::kInteger:
+      switch (type.main()) {
+        case DataType::INT8:
+          return SetIntegerValue<int8_t>(literal.text, value, &QLValue::set_int8_value);
+        case DataType::INT16:
+          return SetIntegerValue<int16_t>(literal.text, value, &QLValue::set_int16_value);
+        case DataType::INT32:
+          return SetIntegerValue<int32_t>(literal.text, value, &QLValue::set_int32_value);
+        case DataType::INT64:
+          return SetIntegerValue<int64_t>(literal.text, value, &QLValue::set_int64_value);
+        default:
+          break;
+      }
+      break;
+    case CQLQueryLiteral::Kind::kString:
+      if (type.main() == DataType::STRING) {
+        value->set_string_value(literal.text);
+        return Status::OK();
+      }
+      break;
+  }
+  return STATUS_FORMAT(NotSupported, "Cannot bind literal $0 to type $1", literal.text, type);
+}
+
+} // namespace
+
+bool AutoParameterizeQuery(const std::string& query,
+                           std::string* normalized,
+                           std::vector<CQLQueryLiteral>* literals) {
+  size_t pos = 0;
+  while (pos < query.size() && isspace(query[pos])) {
+    pos++;
+  }
+  const char* const start = query.c_str() + pos;
+  if (!boost::istarts_with(start, "SELECT ") && !boost::istarts_with(start, "INSERT ") &&
+      !boost::istarts_with(start, "UPDATE ") && !boost::istarts_with(start, "DELETE ")) {
+    return false;
+  }
+
+  normalized->clear();
+  normalized->reserve(query.size());
+  literals->clear();
+  pos = 0;
+  while (pos < query.size()) {
+    const char c = query[pos];
+    const char next = pos + 1 < query.size() ? query[pos + 1] : '\0';
+
+    // Bind markers, comments and dollar-quoted strings are left to the regular parser.
+    if (c == '?' || (c == ':' && (isalpha(next) || next == '_')) ||
+        (c == '-' && next == '-') || (c == '/' && (next == '/' || next == '*')) ||
+        (c == '$' && next == '$')) {
+      return false;
+    }
+
+    // Quoted identifiers are copied as they are.
+    if (c == '"') {
+      const size_t end = query.find('"', pos + 1);
+      if (end == std::string::npos) {
+        return false;
+      }
+      normalized->append(query, pos, end + 1 - pos);
+      pos = end + 1;
+      continue;
+    }
+
+    if (c == '\'') {
+      // Find the closing quote, unescaping doubled quotes.
+      std::string text;
+      size_t end = pos + 1;
+      for (;;) {
+        if (end >= query.size()) {
+          return false;
+        }
+        if (query[end] == '\'') {
+          if (end + 1 < query.size() && query[end + 1] == '\'') {
+            text.push_back('\'');
+            end += 2;
+            continue;
+          }
+          break;
+        }
+        text.push_back(query[end]);
+        end++;
+      }
+      if (IsValueContext(LastNonSpace(*normalized))) {
+        literals->push_back(CQLQueryLiteral{CQLQueryLiteral::Kind::kString, std::move(text)});
+        normalized->push_back('?');
+      } else {
+        normalized->append(query, pos, end + 1 - pos);
+      }
+      pos = end + 1;
+      continue;
+    }
+
+    // An integer, possibly negative, that is not part of an identifier or of another kind of
+    // constant such as a float, a uuid or a duration.
+    const bool negative = c == '-' && isdigit(next);
+    if ((isdigit(c) || negative) &&
+        (pos == 0 || (!IsWordChar(query[pos - 1]) && query[pos - 1] != '.' &&
+                      query[pos - 1] != '-'))) {
+      size_t end = pos + (negative ? 1 : 0);
+      while (end < query.size() && isdigit(query[end])) {
+        end++;
+      }
+      const bool is_integer = end == query.size() ||
+          (!IsWordChar(query[end]) && query[end] != '.' && query[end] != '-');
+      if (is_integer && IsValueContext(LastNonSpace(*normalized))) {
+        literals->push_back(
+            CQLQueryLiteral{CQLQueryLiteral::Kind::kInteger, query.substr(pos, end - pos)});
+        normalized->push_back('?');
+      } else {
+        normalized->append(query, pos, end - pos);
+      }
+      pos = end;
+      continue;
+    }
+
+    // Copy identifiers and keywords as a whole so that digits inside them are not taken as
+    // literals.
+    if (IsWordChar(c)) {
+      size_t end = pos + 1;
+      while (end < query.size() && IsWordChar(query[end])) {
+        end++;
+      }
+      normalized->append(query, pos, end - pos);
+      pos = end;
+      continue;
+    }
+
+    normalized->push_back(c);
+    pos++;
+  }
+  return true;
+}
+
+Status CQLLiteralParameters::Bind(const std::vector<CQLQueryLiteral>& literals,
+                                  const std::vector<ColumnSchema>& bind_variable_schemas) {
+  if (literals.size() != bind_variable_schemas.size()) {
+    return STATUS_FORMAT(InvalidArgument, "Expected $0 bind variables, got $1",
+                         literals.size(), bind_variable_schemas.size());
+  }
+  literal_values_.resize(literals.size());
+  for (size_t i = 0; i < literals.size(); i++) {
+    RETURN_NOT_OK(ConvertLiteral(literals[i], *bind_variable_schemas[i].type(),
+                                 &literal_values_[i]));
+  }
+  return Status::OK();
+}
+
+Status CQLLiteralParameters::GetBindVariable(const std::string& name,
+                                             int64_t pos,
+                                             const std::shared_ptr<QLType>& type,
+                                             QLValue* value) const {
+  if (pos < 0 || pos >= literal_values_.size()) {
+    // Return error with 1-based position.
+    return STATUS_SUBSTITUTE(RuntimeError, "Bind variable at position $0 not found", pos + 1);
+  }
+  *value = literal_values_[pos].value();
+  return Status::OK();
+}
+
 }  // namespace cqlserver
 }  // namespace yb
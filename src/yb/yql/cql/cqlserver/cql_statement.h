@@ -19,7 +19,12 @@
 #ifndef YB_YQL_CQL_CQLSERVER_CQL_STATEMENT_H_
 #define YB_YQL_CQL_CQLSERVER_CQL_STATEMENT_H_
 
+#include <atomic>
 #include <list>
+#include <vector>
+
+#include "yb/common/ql_value.h"
+#include "yb/common/schema.h"
 
 #include "yb/yql/cql/cqlserver/cql_message.h"
 #include "yb/yql/cql/ql/statement.h"
@@ -34,7 +39,7 @@ class CQLStatement;
 // it when it is being executed by another client in another thread.
 using CQLStatementMap = std::unordered_map<CQLMessage::QueryId, std::shared_ptr<CQLStatement>>;
 
-// A LRU list of CQL statements and position in the list.
+// A clock list of CQL statements for approximate-LRU eviction and position in the list.
 using CQLStatementList = std::list<std::shared_ptr<CQLStatement>>;
 using CQLStatementListPos = CQLStatementList::iterator;
 
@@ -47,16 +52,72 @@ class CQLStatement : public ql::Statement {
   // Return the query id.
   CQLMessage::QueryId query_id() const { return GetQueryId(keyspace_, text_); }
 
-  // Get/set position of the statement in the LRU.
+  // Get/set position of the statement in the clock list.
   CQLStatementListPos pos() const { return pos_; }
   void set_pos(CQLStatementListPos pos) const { pos_ = pos; }
 
+  // Set the reference bit of the statement when it is looked up. The bit is only written when it
+  // is not set already so that concurrent lookups of a hot statement do not bounce its cacheline.
+  void MarkUsed() const {
+    if (!used_.load(std::memory_order_relaxed)) {
+      used_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  // Clear the reference bit of the statement and return whether it was set.
+  bool ResetUsed() const { return used_.exchange(false, std::memory_order_relaxed); }
+
   // Return the query id of a statement.
   static CQLMessage::QueryId GetQueryId(const std::string& keyspace, const std::string& query);
 
  private:
-  // Position of the statement in the LRU.
+  // Position of the statement in the clock list.
   mutable CQLStatementListPos pos_;
+
+  // Reference bit of the statement. The clock hand clears it and evicts the statement if it is
+  // not set again before the hand comes around.
+  mutable std::atomic<bool> used_{true};
+};
+
+// A literal value extracted from a query by AutoParameterizeQuery().
+struct CQLQueryLiteral {
+  enum class Kind {
+    kInteger,
+    kString
+  };
+
+  Kind kind;
+  // The digits with an optional sign for an integer, the unquoted contents for a string.
+  std::string text;
+};
+
+// Auto-parameterizes a DML statement: the integer and string literals that are compared with or
+// assigned to a value are replaced by bind markers in "normalized", so that statements that differ
+// only in these literals share the same prepared statement. Returns false if the statement is not
+// a DML or it cannot be normalized safely, e.g. because it has bind markers or comments already.
+bool AutoParameterizeQuery(const std::string& query,
+                           std::string* normalized,
+                           std::vector<CQLQueryLiteral>* literals);
+
+// Parameters to execute an auto-parameterized statement: the parameters of the original query
+// with the extracted literals as the values of the bind variables.
+class CQLLiteralParameters : public CQLMessage::QueryParameters {
+ public:
+  explicit CQLLiteralParameters(const CQLMessage::QueryParameters& params)
+      : CQLMessage::QueryParameters(params) {}
+
+  // Converts the literals to the types of the bind variables of the prepared statement. Fails if
+  // a literal cannot be converted without going through the regular parse and analysis.
+  CHECKED_STATUS Bind(const std::vector<CQLQueryLiteral>& literals,
+                      const std::vector<ColumnSchema>& bind_variable_schemas);
+
+  CHECKED_STATUS GetBindVariable(const std::string& name,
+                                 int64_t pos,
+                                 const std::shared_ptr<QLType>& type,
+                                 QLValue* value) const override;
+
+ private:
+  std::vector<QLValue> literal_values_;
 };
 
 }  // namespace cqlserver
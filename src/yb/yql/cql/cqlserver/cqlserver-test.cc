@@ -20,8 +20,13 @@
 
 #include "yb/yql/cql/cqlserver/cql_message.h"
 #include "yb/yql/cql/cqlserver/cql_server.h"
+#include "yb/yql/cql/cqlserver/cql_service.h"
+#include "yb/yql/cql/cqlserver/cql_statement.h"
 
+#include "yb/gutil/endian.h"
 #include "yb/gutil/strings/join.h"
+#include "yb/rpc/messenger.h"
+#include "yb/rpc/service_pool.h"
 #include "yb/util/cast.h"
 #include "yb/util/net/net_util.h"
 #include "yb/util/test_util.h"
@@ -49,7 +54,18 @@ class TestCQLService : public YBTableTestBase {
 
   void SendRequestAndExpectResponse(const string& cmd, const string& resp);
 
+  // Prepare the query and return the id of the prepared statement.
+  Result<CQLMessage::QueryId> PrepareQuery(const string& query);
+
+  // The CQL service registered by the server.
+  std::shared_ptr<CQLServiceImpl> service();
+
   int server_port() { return cql_server_port_; }
+
+  CQLServer* server() { return server_.get(); }
+
+  const CQLServerOptions& server_options() const { return server_options_; }
+
  private:
   Status SendRequestAndGetResponse(
       const string& cmd, int expected_resp_length, int timeout_in_millis = 60000);
@@ -57,6 +73,7 @@ class TestCQLService : public YBTableTestBase {
   Socket client_sock_;
   unique_ptr<boost::asio::io_service> io_;
   unique_ptr<CQLServer> server_;
+  CQLServerOptions server_options_;
   int cql_server_port_ = 0;
   unique_ptr<FileLock> cql_port_lock_;
   unique_ptr<FileLock> cql_webserver_lock_;
@@ -86,6 +103,8 @@ void TestCQLService::SetUp() {
   }
   opts.SetMasterAddresses(master_addresses);
 
+  server_options_ = opts;
+
   io_.reset(new boost::asio::io_service());
   server_.reset(new CQLServer(opts, io_.get(), nullptr));
   LOG(INFO) << "Starting CQL server...";
@@ -147,6 +166,41 @@ void TestCQLService::SendRequestAndExpectResponse(const string& cmd, const strin
   CHECK_EQ(resp, string(reinterpret_cast<char*>(resp_), resp.length()));
 }
 
+Result<CQLMessage::QueryId> TestCQLService::PrepareQuery(const string& query) {
+  // Send a PREPARE request (opcode=9) with the query as its body.
+  string cmd = BINARY_STRING("\x04\x00\x00\x00\x09");
+  uint8_t length[sizeof(uint32_t)];
+  BigEndian::Store32(length, sizeof(uint32_t) + query.length());
+  cmd.append(reinterpret_cast<const char*>(length), sizeof(length));
+  BigEndian::Store32(length, query.length());
+  cmd.append(reinterpret_cast<const char*>(length), sizeof(length));
+  cmd.append(query);
+  int32_t bytes_written = 0;
+  RETURN_NOT_OK(client_sock_.Write(util::to_uchar_ptr(cmd.c_str()), cmd.length(), &bytes_written));
+
+  // Receive the response header and then the body.
+  constexpr size_t kHeaderLength = 9;
+  const MonoTime deadline = MonoTime::Now() + MonoDelta::FromSeconds(60);
+  uint8_t header[kHeaderLength];
+  size_t bytes_read = 0;
+  RETURN_NOT_OK(client_sock_.BlockingRecv(header, kHeaderLength, &bytes_read, deadline));
+  std::vector<uint8_t> body(BigEndian::Load32(header + 5));
+  RETURN_NOT_OK(client_sock_.BlockingRecv(body.data(), body.size(), &bytes_read, deadline));
+
+  // Expect a RESULT (opcode=8) of kind PREPARED (0x0004) that starts with the query id.
+  if (header[4] != 0x08 || body.size() < 6 || BigEndian::Load32(body.data()) != 0x0004) {
+    return STATUS_FORMAT(IllegalState, "Failed to prepare $0", query);
+  }
+  const size_t id_length = BigEndian::Load16(body.data() + 4);
+  return CQLMessage::QueryId(reinterpret_cast<const char*>(body.data() + 6), id_length);
+}
+
+std::shared_ptr<CQLServiceImpl> TestCQLService::service() {
+  auto service_pool = server_->messenger()->rpc_service("yb.cqlserver.CQLServerService");
+  return std::static_pointer_cast<CQLServiceImpl>(
+      down_cast<rpc::ServicePool*>(service_pool.get())->TEST_get_service());
+}
+
 // The following test cases test the CQL protocol marshalling/unmarshalling with hand-coded
 // request messages and expected responses. They are good as basic and error-handling tests.
 // These are expected to be few.
@@ -404,5 +458,74 @@ TEST_F(TestCQLServiceWithGFlag, SchemaChangeEventWithGFlag) {
   TestSchemaChangeEvent();
 }
 
+// Measure the throughput of prepared statement lookups for EXECUTE requests by the number of
+// concurrent threads.
+TEST_F(TestCQLService, PreparedStatementCacheThroughput) {
+  constexpr int kNumStatements = 1000;
+  constexpr int kMaxThreads = 16;
+  const auto kTestDuration = std::chrono::seconds(2);
+
+  auto service = this->service();
+  ASSERT_NE(service, nullptr);
+  vector<CQLMessage::QueryId> ids;
+  for (int i = 0; i != kNumStatements; ++i) {
+    ids.push_back(ASSERT_RESULT(PrepareQuery(
+        Substitute("SELECT key FROM system.local WHERE key = 'key$0'", i))));
+  }
+
+  for (int num_threads = 1; num_threads <= kMaxThreads; num_threads *= 2) {
+    std::atomic<uint64_t> num_lookups(0);
+    TestThreadHolder holder;
+    for (int t = 0; t != num_threads; ++t) {
+      holder.AddThreadFunctor([&ids, &service, &num_lookups, &stop = holder.stop_flag(), t] {
+        uint64_t lookups = 0;
+        for (size_t i = t; !stop.load(std::memory_order_acquire); i = (i + 1) % ids.size()) {
+          ASSERT_NE(service->GetPreparedStatement(ids[i]), nullptr);
+          ++lookups;
+        }
+        num_lookups.fetch_add(lookups, std::memory_order_relaxed);
+      });
+    }
+    holder.WaitAndStop(kTestDuration);
+    holder.JoinAll();
+    LOG(INFO) << num_threads << " threads: "
+              << num_lookups.load() / kTestDuration.count()
+              << " lookups per second";
+  }
+}
+
+TEST(CQLStatementTest, AutoParameterizeQuery) {
+  string normalized;
+  vector<CQLQueryLiteral> literals;
+
+  ASSERT_TRUE(AutoParameterizeQuery(
+      "SELECT v1, v2 FROM t2 WHERE h = -12 AND r IN ('a''b', 'c') LIMIT 10",
+      &normalized, &literals));
+  ASSERT_EQ("SELECT v1, v2 FROM t2 WHERE h = ? AND r IN (?, ?) LIMIT 10", normalized);
+  ASSERT_EQ(3, literals.size());
+  ASSERT_EQ(CQLQueryLiteral::Kind::kInteger, literals[0].kind);
+  ASSERT_EQ("-12", literals[0].text);
+  ASSERT_EQ(CQLQueryLiteral::Kind::kString, literals[1].kind);
+  ASSERT_EQ("a'b", literals[1].text);
+  ASSERT_EQ("c", literals[2].text);
+
+  // Other kinds of constants and quoted identifiers are left in place.
+  ASSERT_TRUE(AutoParameterizeQuery(
+      "INSERT INTO \"T1\" (h, d, u, b) VALUES (1, 1.5, 123e4567-e89b-12d3-a456-426655440000, "
+      "0x12) USING TTL 100",
+      &normalized, &literals));
+  ASSERT_EQ("INSERT INTO \"T1\" (h, d, u, b) VALUES (?, 1.5, "
+            "123e4567-e89b-12d3-a456-426655440000, 0x12) USING TTL 100", normalized);
+  ASSERT_EQ(1, literals.size());
+  ASSERT_EQ("1", literals[0].text);
+
+  // Only DML statements without bind markers or comments are auto-parameterized.
+  ASSERT_FALSE(AutoParameterizeQuery("CREATE TABLE t (h int PRIMARY KEY)", &normalized, &literals));
+  ASSERT_FALSE(AutoParameterizeQuery("SELECT * FROM t WHERE h = ?", &normalized, &literals));
+  ASSERT_FALSE(AutoParameterizeQuery("SELECT * FROM t WHERE h = :h", &normalized, &literals));
+  ASSERT_FALSE(AutoParameterizeQuery("SELECT * FROM t -- all", &normalized, &literals));
+  ASSERT_FALSE(AutoParameterizeQuery("SELECT * FROM t WHERE r = 'a", &normalized, &literals));
+}
+
 }  // namespace cqlserver
 }  // namespace yb
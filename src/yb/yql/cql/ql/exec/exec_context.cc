@@ -204,18 +204,37 @@ void TnodeContext::InitializePartition(QLReadRequestPB *req, uint64_t start_part
     req->add_hashed_column_values();
   }
 
+  SetPartitionHashValues(req, start_partition);
+}
+
+void TnodeContext::SetPartitionHashValues(QLReadRequestPB *req, uint64_t partition_index) const {
+  const int unset_cols_size = hash_values_options_->size();
+  const int set_cols_size = req->hashed_column_values().size() - unset_cols_size;
+
   // Set the right values for the missing/unset columns by converting partition index into positions
   // for each hash column and using the corresponding values from the hash values options vector.
-  // E.g. In example above, with start_partition = 0:
-  //    h4 = 6 since pos is "0 % 1 = 0", (start_position becomes 0 / 1 = 0).
-  //    h3 = 4 since pos is "0 % 2 = 0", (start_position becomes 0 / 2 = 0).
-  //    h2 = 2 since pos is "0 % 2 = 0", (start_position becomes 0 / 2 = 0).
+  // E.g. for a query "h1 = 1 and h2 in (2,3) and h3 in (4,5) and h4 = 6", with partition index 0:
+  //    h4 = 6 since pos is "0 % 1 = 0", (partition_index becomes 0 / 1 = 0).
+  //    h3 = 4 since pos is "0 % 2 = 0", (partition_index becomes 0 / 2 = 0).
+  //    h2 = 2 since pos is "0 % 2 = 0", (partition_index becomes 0 / 2 = 0).
   for (int i = unset_cols_size - 1; i >= 0; i--) {
     const auto& options = (*hash_values_options_)[i];
-    int pos = start_partition % options.size();
+    int pos = partition_index % options.size();
     *req->mutable_hashed_column_values(i + set_cols_size) = options[pos];
-    start_partition /= options.size();
+    partition_index /= options.size();
+  }
+}
+
+YBqlReadOpPtr TnodeContext::TakePrefetchedPartition(uint64_t partition_index) {
+  YBqlReadOpPtr result;
+  auto it = prefetched_partitions_.begin();
+  while (it != prefetched_partitions_.end() && it->first <= partition_index) {
+    if (it->first == partition_index) {
+      result = std::move(it->second);
+    }
+    it = prefetched_partitions_.erase(it);
   }
+  return result;
 }
 
 void TnodeContext::AdvanceToNextPartition(QLReadRequestPB *req) {
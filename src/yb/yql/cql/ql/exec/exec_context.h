@@ -20,6 +20,8 @@
 #ifndef YB_YQL_CQL_QL_EXEC_EXEC_CONTEXT_H_
 #define YB_YQL_CQL_QL_EXEC_EXEC_CONTEXT_H_
 
+#include <map>
+
 #include "yb/yql/cql/ql/ptree/process_context.h"
 #include "yb/yql/cql/ql/util/ql_env.h"
 #include "yb/yql/cql/ql/util/statement_params.h"
@@ -105,6 +107,25 @@ class TnodeContext {
   // this will do, index: 2 -> 3 and hashed_column_values: [1, 3, 4, 6] -> [1, 3, 5, 6].
   void AdvanceToNextPartition(QLReadRequestPB *req);
 
+  // Used for multi-partition selects (i.e. with 'IN' conditions on hash columns).
+  // Sets the hashed column values of the given partition in a request that already has all its
+  // hashed columns set, without changing the current partition index.
+  void SetPartitionHashValues(QLReadRequestPB *req, uint64_t partition_index) const;
+
+  // Used for multi-partition selects (i.e. with 'IN' conditions on hash columns).
+  // Reads of the partitions after the current one that are sent in parallel with the read of the
+  // current partition. Their results are consumed in partition order by Executor::FetchMoreRows.
+  void AddPrefetchedPartition(uint64_t partition_index, const client::YBqlReadOpPtr& op) {
+    prefetched_partitions_.emplace(partition_index, op);
+  }
+  bool IsPartitionPrefetched(uint64_t partition_index) const {
+    return prefetched_partitions_.count(partition_index) != 0;
+  }
+
+  // Removes and returns the prefetched read of the given partition, if any. Reads of partitions
+  // before it are discarded since they will not be used anymore.
+  client::YBqlReadOpPtr TakePrefetchedPartition(uint64_t partition_index);
+
   std::vector<std::vector<QLExpressionPB>>& hash_values_options() {
     if (!hash_values_options_) {
       hash_values_options_.emplace();
@@ -164,6 +185,9 @@ class TnodeContext {
   uint64_t partitions_count_ = 0;
   uint64_t current_partition_index_ = 0;
 
+  // Reads of the partitions following the current one that were sent ahead, by partition index.
+  std::map<uint64_t, client::YBqlReadOpPtr> prefetched_partitions_;
+
   // Rows result of this statement tnode for DML statements.
   RowsResult::SharedPtr rows_result_;
 
@@ -14,6 +14,7 @@
 //--------------------------------------------------------------------------------------------------
 
 #include "yb/yql/cql/ql/util/errcodes.h"
+#include "yb/yql/cql/ql/util/prefetched_pages.h"
 #include "yb/yql/cql/ql/exec/executor.h"
 #include "yb/yql/cql/ql/ql_processor.h"
 
@@ -27,17 +28,34 @@
 #include "yb/client/yb_op.h"
 
 #include "yb/common/common.pb.h"
+#include "yb/common/consistent_read_point.h"
 #include "yb/common/ql_protocol_util.h"
 #include "yb/common/ql_value.h"
 #include "yb/common/wire_protocol.h"
 
 #include "yb/rpc/thread_pool.h"
 #include "yb/util/decimal.h"
+#include "yb/util/flag_tags.h"
 #include "yb/util/logging.h"
 #include "yb/util/random_util.h"
 #include "yb/util/thread_restrictions.h"
 #include "yb/util/trace.h"
 
+DEFINE_int32(cql_select_max_parallel_partitions, 16,
+             "Maximum number of partitions of a select with an IN condition on hash columns that "
+             "are read in parallel. Values of 1 or less read the partitions one at a time.");
+TAG_FLAG(cql_select_max_parallel_partitions, advanced);
+
+DEFINE_bool(cql_prefetch_next_page, false,
+            "Whether to read ahead the next page of a paging select in the background while the "
+            "client is consuming the current page.");
+TAG_FLAG(cql_prefetch_next_page, advanced);
+
+DEFINE_int32(cql_prefetched_page_timeout_ms, 10000,
+             "How long a page read ahead is kept for the client to request it before it is "
+             "dropped.");
+TAG_FLAG(cql_prefetched_page_timeout_ms, advanced);
+
 namespace yb {
 namespace ql {
 
@@ -95,6 +113,20 @@ void Executor::ExecuteAsync(const ParseTree& parse_tree, const StatementParamete
   FlushAsync();
 }
 
+namespace {
+
+// Can a write operation of the DML statement read the row it writes (see
+// YBqlWriteOp::ReadsPrimaryRow() and ReadsStaticRow()), or issue more writes to secondary indexes?
+bool MayReadRows(const PTDmlStmt* stmt) {
+  return stmt->if_clause() != nullptr ||
+         !stmt->column_refs().empty() ||
+         !stmt->static_column_refs().empty() ||
+         stmt->user_timestamp_usec() != nullptr ||
+         !stmt->table()->index_map().empty();
+}
+
+} // namespace
+
 void Executor::ExecuteAsync(const StatementBatch& batch, StatementExecutedCallback cb) {
   DCHECK(cb_.is_null()) << "Another execution is in progress.";
   cb_ = std::move(cb);
@@ -104,6 +136,12 @@ void Executor::ExecuteAsync(const StatementBatch& batch, StatementExecutedCallba
   // Table for DML batches, where all statements must modify the same table.
   client::YBTablePtr dml_batch_table;
 
+  // Write operations of a batch cannot depend on each other if none of the statements reads rows.
+  // In that case, skip tracking them so that all of them are applied in one round and grouped by
+  // tablet into one write request each, without the per-operation primary key bookkeeping. This
+  // is the common case for bulk ingestion with unlogged batches.
+  check_write_dependency_ = false;
+
   // Verify the statements in the batch.
   for (const auto& pair : batch) {
     const ParseTree& parse_tree = pair.first;
@@ -128,6 +166,10 @@ void Executor::ExecuteAsync(const StatementBatch& batch, StatementExecutedCallba
                             "supported yet"));
           }
 
+          if (!check_write_dependency_ && MayReadRows(stmt)) {
+            check_write_dependency_ = true;
+          }
+
           if (!returns_status_batch_opt_) {
             returns_status_batch_opt_ = stmt->returns_status();
           } else if (stmt->returns_status() != *returns_status_batch_opt_) {
@@ -971,8 +1013,68 @@ Status Executor::ExecPTNode(const PTSelectStmt *tnode, TnodeContext* tnode_conte
     return Status::OK();
   }
 
+  // If the page to continue with has been read ahead, take its rows and read only what it did not
+  // return, if anything.
+  if (continue_select) {
+    YBqlReadOpPtr prefetched_op = TakePrefetchedPage(select_op);
+    if (prefetched_op) {
+      RETURN_NOT_OK(tnode_context->AppendRowsResult(
+          std::make_shared<RowsResult>(prefetched_op.get())));
+      if (!VERIFY_RESULT(FetchMoreRows(tnode, prefetched_op, tnode_context, exec_context_))) {
+        return AppendRowsResult(std::move(tnode_context->rows_result()));
+      }
+      prefetched_op->mutable_response()->Clear();
+      select_op = prefetched_op;
+    }
+  }
+
   // Add the operation.
-  return AddOperation(select_op, tnode_context);
+  RETURN_NOT_OK(AddOperation(select_op, tnode_context));
+
+  // For a multi-partition select, read the following partitions in parallel with the first one.
+  if (tnode_context->UnreadPartitionsRemaining() > 1) {
+    return PrefetchPartitions(tnode, select_op, tnode_context);
+  }
+  return Status::OK();
+}
+
+Status Executor::PrefetchPartitions(const PTSelectStmt* tnode,
+                                    const YBqlReadOpPtr& op,
+                                    TnodeContext* tnode_context) {
+  const QLReadRequestPB& req = op->request();
+  // The rows skipped by an offset and the aggregate values carry over from one partition to the
+  // next, so these selects still read the partitions one at a time.
+  if (FLAGS_cql_select_max_parallel_partitions <= 1 || req.has_offset() || req.is_aggregate()) {
+    return Status::OK();
+  }
+
+  // The current partition is read by 'op', so it counts towards the fan-out limit too.
+  const uint64_t start_partition = tnode_context->current_partition_index();
+  const uint64_t end_partition = start_partition + std::min<uint64_t>(
+      FLAGS_cql_select_max_parallel_partitions, tnode_context->UnreadPartitionsRemaining());
+  for (uint64_t index = start_partition + 1; index < end_partition; index++) {
+    if (tnode_context->IsPartitionPrefetched(index)) {
+      continue;
+    }
+
+    // Read the partition from its beginning with the same limit as the current read.
+    YBqlReadOpPtr prefetch_op(tnode->table()->NewQLSelect());
+    QLReadRequestPB* prefetch_req = prefetch_op->mutable_request();
+    prefetch_req->CopyFrom(req);
+    if (prefetch_req->has_paging_state()) {
+      prefetch_req->mutable_paging_state()->clear_next_partition_key();
+      prefetch_req->mutable_paging_state()->clear_next_row_key();
+    }
+    tnode_context->SetPartitionHashValues(prefetch_req, index);
+    prefetch_req->clear_hash_code();
+    prefetch_req->clear_max_hash_code();
+    prefetch_op->set_yb_consistency_level(op->yb_consistency_level());
+
+    tnode_context->AddPrefetchedPartition(index, prefetch_op);
+    TRACE("Apply");
+    RETURN_NOT_OK(session_->Apply(prefetch_op));
+  }
+  return Status::OK();
 }
 
 Result<bool> Executor::FetchMoreRows(const PTSelectStmt* tnode,
@@ -1040,6 +1142,22 @@ Result<bool> Executor::FetchMoreRows(const PTSelectStmt* tnode,
 
     // Otherwise, we continue to the next partition.
     tnode_context->AdvanceToNextPartition(op->mutable_request());
+
+    // If the next partition has been read in parallel already, take its rows as long as they fit
+    // in the rows still to be fetched, and continue from where that read stopped. Otherwise, the
+    // partition is read again from its beginning.
+    YBqlReadOpPtr prefetched_op =
+        tnode_context->TakePrefetchedPartition(tnode_context->current_partition_index());
+    if (prefetched_op && current_fetch_row_count < fetch_limit &&
+        prefetched_op->response().has_status() &&
+        prefetched_op->response().status() == QLResponsePB::YQL_STATUS_OK &&
+        !prefetched_op->rows_data().empty() &&
+        VERIFY_RESULT(QLRowBlock::GetRowCount(YQL_CLIENT_CQL, prefetched_op->rows_data())) <=
+            fetch_limit - current_fetch_row_count) {
+      RETURN_NOT_OK(tnode_context->AppendRowsResult(
+          std::make_shared<RowsResult>(prefetched_op.get())));
+      return FetchMoreRows(tnode, op, tnode_context, exec_context);
+    }
   }
 
   // If we reached the fetch limit (min of paging state and limit clause) we are done.
@@ -1063,7 +1181,15 @@ Result<bool> Executor::FetchMoreRows(const PTSelectStmt* tnode,
 
       paging_state.set_original_request_id(exec_context_->params().request_id());
 
+      // Continue the select at the read time picked by the tablet server for this page.
+      current_params.read_time().AddToPB(&paging_state);
+
       current_result->SetPagingState(paging_state);
+
+      // Multi-partition selects are continued from the partition index rather than the request.
+      if (tnode_context->UnreadPartitionsRemaining() == 0) {
+        RETURN_NOT_OK(PrefetchNextPage(tnode, op, paging_state, current_result->paging_state()));
+      }
     }
 
     return false;
@@ -1088,10 +1214,84 @@ Result<bool> Executor::FetchMoreRows(const PTSelectStmt* tnode,
   paging_state->set_next_row_key(current_params.next_row_key());
   paging_state->set_total_num_rows_read(total_row_count);
   paging_state->set_total_rows_skipped(total_rows_skipped);
+
+  // Keep the following partitions of a multi-partition select read ahead in parallel.
+  if (tnode_context->UnreadPartitionsRemaining() > 1) {
+    RETURN_NOT_OK(PrefetchPartitions(tnode, op, tnode_context));
+  }
   return true;
 }
 
 
+Status Executor::PrefetchNextPage(const PTSelectStmt* tnode,
+                                  const YBqlReadOpPtr& op,
+                                  const QLPagingStatePB& paging_state,
+                                  const std::string& encoded_paging_state) {
+  // The rows skipped by an offset are counted on the fly, and a select from an index returns the
+  // index rows or keys rather than the page itself, so only plain selects are read ahead.
+  // The page is read at the read time of the paging state, which is also the read time of the
+  // request continuing from it, so a page without one is not read ahead.
+  const auto& prefetched_pages = ql_env_->ql_session()->prefetched_pages();
+  const ReadHybridTime read_time = ReadHybridTime::FromReadTimePB(paging_state);
+  if (!FLAGS_cql_prefetch_next_page || prefetched_pages == nullptr || !read_time ||
+      !tnode->index_id().empty() || tnode->offset() || tnode->is_aggregate()) {
+    return Status::OK();
+  }
+
+  // Build the request the way ExecPTNode() does for the select continuing from the paging state.
+  YBqlReadOpPtr prefetch_op(tnode->table()->NewQLSelect());
+  QLReadRequestPB* req = prefetch_op->mutable_request();
+  req->CopyFrom(op->request());
+  req->set_limit(exec_context_->params().page_size());
+  req->set_return_paging_state(true);
+  if (tnode->limit()) {
+    QLExpressionPB limit_pb;
+    RETURN_NOT_OK(PTExprToPB(tnode->limit(), &limit_pb));
+    const int64_t limit = limit_pb.value().int32_value() - paging_state.total_num_rows_read();
+    if (limit <= 0) {
+      return Status::OK();
+    }
+    if (limit <= req->limit()) {
+      req->set_limit(limit);
+      req->set_return_paging_state(false);
+    }
+  }
+  QLPagingStatePB* next_paging_state = req->mutable_paging_state();
+  next_paging_state->Clear();
+  next_paging_state->set_next_partition_key(paging_state.next_partition_key());
+  next_paging_state->set_next_row_key(paging_state.next_row_key());
+  next_paging_state->set_total_num_rows_read(paging_state.total_num_rows_read());
+  next_paging_state->set_total_rows_skipped(paging_state.total_rows_skipped());
+  prefetch_op->set_yb_consistency_level(op->yb_consistency_level());
+
+  YBSessionPtr session = ql_env_->NewSession();
+  session->SetReadPoint(read_time);
+  if (req->hashed_column_values().empty()) {
+    session->SetForceConsistentRead(client::ForceConsistentRead::kTrue);
+  }
+  TRACE("Prefetch Next Page");
+  prefetched_pages->Prefetch(
+      encoded_paging_state, prefetch_op, session,
+      CoarseMonoClock::now() + std::chrono::milliseconds(FLAGS_cql_prefetched_page_timeout_ms));
+  return Status::OK();
+}
+
+YBqlReadOpPtr Executor::TakePrefetchedPage(const YBqlReadOpPtr& select_op) {
+  const auto& prefetched_pages = ql_env_->ql_session()->prefetched_pages();
+  if (prefetched_pages == nullptr) {
+    return nullptr;
+  }
+  const StatementParameters& params = exec_context_->params();
+  select_op->mutable_request()->set_request_id(params.request_id());
+  YBqlReadOpPtr op = prefetched_pages->Take(
+      params.paging_state().SerializeAsString(), select_op->request(),
+      select_op->yb_consistency_level());
+  if (op == nullptr || op->mutable_rows_data()->empty()) {
+    return nullptr;
+  }
+  return op;
+}
+
 Result<bool> Executor::FetchRowsByKeys(const PTSelectStmt* tnode,
                                        const YBqlReadOpPtr& select_op,
                                        const QLRowBlock& keys,
@@ -1782,7 +1982,8 @@ Result<bool> Executor::ProcessTnodeResults(TnodeContext* tnode_context) {
     // Apply any op that has not been applied and executed.
     if (!op->response().has_status()) {
       DCHECK_EQ(op->type(), YBOperation::Type::QL_WRITE);
-      if (write_batch_.Add(std::static_pointer_cast<YBqlWriteOp>(op))) {
+      if (!check_write_dependency_ ||
+          write_batch_.Add(std::static_pointer_cast<YBqlWriteOp>(op))) {
         YBSessionPtr session = GetSession(exec_context_);
         TRACE("Apply");
         RETURN_NOT_OK(session->Apply(op));
@@ -2127,10 +2328,18 @@ Status Executor::AddOperation(const YBqlReadOpPtr& op, TnodeContext *tnode_conte
 Status Executor::AddOperation(const YBqlWriteOpPtr& op, TnodeContext *tnode_context) {
   tnode_context->AddOperation(op);
 
+  // Pages read ahead before the write must not be returned to the connection after it. Pages read
+  // while the write is in flight are dropped again once the statement has been executed.
+  const auto& prefetched_pages = ql_env_->ql_session()->prefetched_pages();
+  if (prefetched_pages != nullptr) {
+    prefetched_pages->InvalidateTable(op->table()->id());
+    written_table_ids_.insert(op->table()->id());
+  }
+
   // Check for inter-dependency in the current write batch before applying the write operation.
   // Apply it in the transactional session in exec_context for the current statement if there is
   // one. Otherwise, apply to the non-transactional session in the executor.
-  if (write_batch_.Add(op)) {
+  if (!check_write_dependency_ || write_batch_.Add(op)) {
     YBSessionPtr session = GetSession(exec_context_);
     TRACE("Apply");
     RETURN_NOT_OK(session->Apply(op));
@@ -2312,6 +2521,12 @@ void Executor::StatementExecuted(const Status& s) {
     ql_metrics_->num_flushes_to_execute_ql_->Increment(num_flushes_);
   }
 
+  // Drop the pages read ahead while the writes were in flight, before the writes are acknowledged.
+  const auto& prefetched_pages = ql_env_->ql_session()->prefetched_pages();
+  for (const auto& table_id : written_table_ids_) {
+    prefetched_pages->InvalidateTable(table_id);
+  }
+
   // Clean up and invoke statement-executed callback.
   ExecutedResult::SharedPtr result = s.ok() ? std::move(result_) : nullptr;
   StatementExecutedCallback cb = std::move(cb_);
@@ -2328,6 +2543,8 @@ void Executor::Reset() {
   result_ = nullptr;
   cb_.Reset();
   returns_status_batch_opt_ = boost::none;
+  check_write_dependency_ = true;
+  written_table_ids_.clear();
 }
 
 QLExpressionPB* CreateQLExpression(QLWriteRequestPB *req, const ColumnDesc& col_desc) {
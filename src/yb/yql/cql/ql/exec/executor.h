@@ -18,6 +18,8 @@
 #ifndef YB_YQL_CQL_QL_EXEC_EXECUTOR_H_
 #define YB_YQL_CQL_QL_EXEC_EXECUTOR_H_
 
+#include <unordered_set>
+
 #include "yb/client/yb_op.h"
 #include "yb/common/ql_expr.h"
 #include "yb/common/ql_rowblock.h"
@@ -220,6 +222,23 @@ class Executor : public QLExprExecutor {
                              TnodeContext* tnode_context,
                              ExecContext* exec_context);
 
+  // Send reads of the partitions following the current one of a multi-partition select (i.e. with
+  // 'IN' condition on hash cols) in parallel with the read of the current partition by 'op'.
+  CHECKED_STATUS PrefetchPartitions(const PTSelectStmt* tnode,
+                                    const client::YBqlReadOpPtr& op,
+                                    TnodeContext* tnode_context);
+
+  // Read ahead the page of a paging select that the client is to request next with the paging
+  // state just returned, while the client is consuming the current page.
+  CHECKED_STATUS PrefetchNextPage(const PTSelectStmt* tnode,
+                                  const client::YBqlReadOpPtr& op,
+                                  const QLPagingStatePB& paging_state,
+                                  const std::string& encoded_paging_state);
+
+  // Take the page read ahead for a select continuing from the paging state in the statement
+  // parameters. Returns nullptr if there is none or it was not read by the same request.
+  client::YBqlReadOpPtr TakePrefetchedPage(const client::YBqlReadOpPtr& select_op);
+
   // Fetch rows for a select statement using primary keys selected from an uncovered index.
   Result<bool> FetchRowsByKeys(const PTSelectStmt* tnode,
                                const client::YBqlReadOpPtr& select_op,
@@ -419,6 +438,9 @@ class Executor : public QLExprExecutor {
   // Batch of outstanding write operations that are being applied.
   WriteBatch write_batch_;
 
+  // Tables written to by the statements in execution whose pages read ahead are to be dropped.
+  std::unordered_set<TableId> written_table_ids_;
+
   // Session to apply non-transactional read/write operations. Transactional read/write operations
   // are applied using the corresponding transactional session in ExecContext.
   const client::YBSessionPtr session_;
@@ -444,6 +466,11 @@ class Executor : public QLExprExecutor {
   // Whether this is a batch with statements that returns status.
   boost::optional<bool> returns_status_batch_opt_;
 
+  // Whether the write operations being executed may depend on each other and need to be checked
+  // by write_batch_. It is false for batches whose statements neither read the rows they write nor
+  // update secondary indexes.
+  bool check_write_dependency_ = true;
+
   class ProcessAsyncResultsTask : public rpc::ThreadPoolTask {
    public:
     ProcessAsyncResultsTask& Bind(Executor* executor) {
@@ -481,10 +481,33 @@ Status PTTablePropertyMap::SetTableProperty(yb::TableProperties *table_property)
   }
   switch (iterator->second) {
     case PropertyMapType::kCaching: FALLTHROUGH_INTENDED;
-    case PropertyMapType::kCompaction: FALLTHROUGH_INTENDED;
     case PropertyMapType::kCompression:
       LOG(WARNING) << "Ignoring table property " << table_property_name;
       break;
+    case PropertyMapType::kCompaction:
+      for (const auto& subproperty : map_elements_->node_list()) {
+        string subproperty_name;
+        ToLowerCase(subproperty->lhs()->c_str(), &subproperty_name);
+        if (subproperty_name != "class") {
+          continue;
+        }
+        string class_name;
+        RETURN_NOT_OK(
+            GetStringValueFromExpr(subproperty->rhs(), false, subproperty_name, &class_name));
+        if (class_name.find('.') == string::npos) {
+          class_name.insert(0, Compaction::kClassPrefix);
+        }
+        // Other strategies are accepted for compatibility, but use universal compaction.
+        if (class_name == Compaction::kLeveledClass) {
+          table_property->SetCompactionStyle(TableCompactionStyle::LEVEL_COMPACTION_STYLE);
+        } else {
+          if (class_name != Compaction::kSizeTieredClass) {
+            LOG(WARNING) << "Using universal compaction for compaction strategy " << class_name;
+          }
+          table_property->SetCompactionStyle(TableCompactionStyle::UNIVERSAL_COMPACTION_STYLE);
+        }
+      }
+      break;
     case PropertyMapType::kTransactions:
       for (const auto& subproperty : map_elements_->node_list()) {
         string subproperty_name;
@@ -855,8 +878,13 @@ Transactions::kSubpropertyDataTypes = {
     {"consistency_level", Transactions::Subproperty::kConsistencyLevel}
 };
 
+const char* const Compaction::kSizeTieredClass =
+    "org.apache.cassandra.db.compaction.SizeTieredCompactionStrategy";
+const char* const Compaction::kLeveledClass =
+    "org.apache.cassandra.db.compaction.LeveledCompactionStrategy";
+
 const std::map<std::string, std::set<Compaction::Subproperty>> Compaction::kClassSubproperties = {
-    {"org.apache.cassandra.db.compaction.SizeTieredCompactionStrategy",
+    {Compaction::kSizeTieredClass,
         {
             Compaction::Subproperty::kBucketHigh,
             Compaction::Subproperty::kBucketLow,
@@ -886,7 +914,7 @@ const std::map<std::string, std::set<Compaction::Subproperty>> Compaction::kClas
             Compaction::Subproperty::kUncheckedTombstoneCompaction
         }
     },
-    {"org.apache.cassandra.db.compaction.LeveledCompactionStrategy",
+    {Compaction::kLeveledClass,
         {
             Compaction::Subproperty::kEnabled,
             Compaction::Subproperty::kLogAll,
@@ -262,6 +262,10 @@ struct Compaction {
   static constexpr auto kClassPrefix = "org.apache.cassandra.db.compaction.";
   static const auto kClassPrefixLen = std::strlen(kClassPrefix);
 
+  // Strategies mapped to the universal and level compaction styles of the table.
+  static const char* const kSizeTieredClass;
+  static const char* const kLeveledClass;
+
   static const std::map<std::string, std::set<Subproperty>> kClassSubproperties;
 
   static std::set<std::string> kWindowUnits;
@@ -30,6 +30,8 @@
 namespace yb {
 namespace ql {
 
+class PrefetchedPages;
+
 static const char* const kUndefinedKeyspace = ""; // Must be empty string.
 static const char* const kUndefinedRoleName = ""; // Must be empty string.
 
@@ -67,6 +69,15 @@ class QLSession {
     current_role_name_ = role_name;
   }
 
+  // Access functions for the pages of SELECT results read ahead for the client connection. They
+  // are set when the session is created only, so no locking is needed.
+  const std::shared_ptr<PrefetchedPages>& prefetched_pages() const {
+    return prefetched_pages_;
+  }
+  void set_prefetched_pages(std::shared_ptr<PrefetchedPages> prefetched_pages) {
+    prefetched_pages_ = std::move(prefetched_pages);
+  }
+
  private:
   // Mutex to protect access to current_keyspace_.
   mutable boost::shared_mutex current_keyspace_mutex_;
@@ -75,6 +86,8 @@ class QLSession {
   std::string current_keyspace_;
   // TODO (Bristy) : After Login has been done, test this.
   std::string current_role_name_;
+  // Pages read ahead for the connection. Null if the connection does not read pages ahead.
+  std::shared_ptr<PrefetchedPages> prefetched_pages_;
 
 };
 
@@ -260,6 +260,37 @@ TEST_F(TestQLCreateTable, TestQLCreateTableWithTTL) {
   EXPECT_EQ(1000, properties_pb.default_time_to_live());
 }
 
+TEST_F(TestQLCreateTable, TestQLCreateTableWithCompaction) {
+  // Init the simulated cluster.
+  ASSERT_NO_FATALS(CreateSimulatedCluster());
+
+  // Get an available processor.
+  TestQLProcessor *processor = GetQLProcessor();
+
+  EXEC_VALID_STMT("CREATE TABLE leveled (c1 int PRIMARY KEY, c2 int) WITH "
+                      "compaction = { 'class' : 'LeveledCompactionStrategy' };");
+  EXEC_VALID_STMT("CREATE TABLE size_tiered (c1 int PRIMARY KEY, c2 int) WITH compaction = { "
+                      "'class' : 'org.apache.cassandra.db.compaction.SizeTieredCompactionStrategy' "
+                      "};");
+  EXEC_VALID_STMT("CREATE TABLE time_window (c1 int PRIMARY KEY, c2 int) WITH "
+                      "compaction = { 'class' : 'TimeWindowCompactionStrategy' };");
+
+  // Verify the compaction style was stored in syscatalog table.
+  master::CatalogManager *catalog_manager = cluster_->mini_master()->master()->catalog_manager();
+  for (const auto& table_and_style : {
+      std::make_pair("leveled", TableCompactionStyle::LEVEL_COMPACTION_STYLE),
+      std::make_pair("size_tiered", TableCompactionStyle::UNIVERSAL_COMPACTION_STYLE),
+      std::make_pair("time_window", TableCompactionStyle::UNIVERSAL_COMPACTION_STYLE)}) {
+    master::GetTableSchemaRequestPB request_pb;
+    master::GetTableSchemaResponsePB response_pb;
+    request_pb.mutable_table()->mutable_namespace_()->set_name(kDefaultKeyspaceName);
+    request_pb.mutable_table()->set_table_name(table_and_style.first);
+    CHECK_OK(catalog_manager->GetTableSchema(&request_pb, &response_pb));
+    EXPECT_EQ(table_and_style.second,
+              response_pb.schema().table_properties().compaction_style()) << table_and_style.first;
+  }
+}
+
 TEST_F(TestQLCreateTable, TestQLCreateTableWithClusteringOrderBy) {
   // Init the simulated cluster.
   ASSERT_NO_FATALS(CreateSimulatedCluster());
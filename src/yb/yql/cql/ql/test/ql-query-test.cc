@@ -31,6 +31,9 @@ using std::unique_ptr;
 using std::shared_ptr;
 using strings::Substitute;
 
+DECLARE_int32(cql_select_max_parallel_partitions);
+DECLARE_bool(cql_prefetch_next_page);
+
 namespace yb {
 namespace ql {
 
@@ -864,6 +867,110 @@ TEST_F(TestQLQuery, TestPagingState) {
   }
 }
 
+TEST_F(TestQLQuery, TestParallelPartitionsPagingState) {
+  // Init the simulated cluster.
+  ASSERT_NO_FATALS(CreateSimulatedCluster());
+
+  // Get a processor.
+  TestQLProcessor *processor = GetQLProcessor();
+
+  CHECK_VALID_STMT("CREATE TABLE t (h int, r int, v int, primary key((h), r));");
+  for (int h = 1; h <= 4; h++) {
+    for (int r = 1; r <= 3; r++) {
+      CHECK_VALID_STMT(
+          Substitute("INSERT INTO t (h, r, v) VALUES ($0, $1, $2);", h, r, h * 10 + r));
+    }
+  }
+
+  // Verify that the partitions of the IN condition are returned in order and that the pages
+  // resume from the right place whether the partitions are read one at a time or in parallel.
+  for (int max_parallel_partitions : {1, 2, 16}) {
+    FLAGS_cql_select_max_parallel_partitions = max_parallel_partitions;
+    LOG(INFO) << "Reading with up to " << max_parallel_partitions << " partitions in parallel";
+
+    VerifyPaginationSelect(processor,
+        "SELECT h, r, v FROM t WHERE h IN (1, 2, 3, 4) AND r > 1;", 3,
+        "{ { int32:1, int32:2, int32:12 }, { int32:1, int32:3, int32:13 }, "
+        "{ int32:2, int32:2, int32:22 } }"
+        "{ { int32:2, int32:3, int32:23 }, { int32:3, int32:2, int32:32 }, "
+        "{ int32:3, int32:3, int32:33 } }"
+        "{ { int32:4, int32:2, int32:42 }, { int32:4, int32:3, int32:43 } }");
+
+    VerifyPaginationSelect(processor,
+        "SELECT h, r, v FROM t WHERE h IN (1, 2, 3, 4) AND r > 1 LIMIT 5;", 3,
+        "{ { int32:1, int32:2, int32:12 }, { int32:1, int32:3, int32:13 }, "
+        "{ int32:2, int32:2, int32:22 } }"
+        "{ { int32:2, int32:3, int32:23 }, { int32:3, int32:2, int32:32 } }");
+  }
+}
+
+TEST_F(TestQLQuery, TestPrefetchNextPage) {
+  // Init the simulated cluster.
+  ASSERT_NO_FATALS(CreateSimulatedCluster());
+
+  // Get a processor and let it read pages ahead.
+  TestQLProcessor *processor = GetQLProcessor();
+  auto mem_tracker = MemTracker::CreateTracker("Prefetched Pages");
+  auto prefetched_pages = std::make_shared<PrefetchedPages>(mem_tracker);
+  processor->SetPrefetchedPages(prefetched_pages);
+  FLAGS_cql_prefetch_next_page = true;
+
+  CHECK_VALID_STMT("CREATE TABLE t (h int, r int, v int, primary key((h), r));");
+  for (int r = 1; r <= 10; r++) {
+    CHECK_VALID_STMT(Substitute("INSERT INTO t (h, r, v) VALUES (1, $0, $1);", r, r * 10));
+  }
+
+  // A page read ahead may or may not have been read by the time it is requested, so request the
+  // pages both back to back and with a pause in between.
+  for (int delay_ms : {0, 100}) {
+    StatementParameters params;
+    params.set_page_size(3);
+    std::vector<int> values;
+    while (true) {
+      ASSERT_OK(processor->Run("SELECT r, v FROM t WHERE h = 1;", params));
+      std::shared_ptr<QLRowBlock> row_block = processor->row_block();
+      for (const QLRow& row : row_block->rows()) {
+        ASSERT_EQ(row.column(0).int32_value() * 10, row.column(1).int32_value());
+        values.push_back(row.column(0).int32_value());
+      }
+      if (processor->rows_result()->paging_state().empty()) {
+        break;
+      }
+      ASSERT_OK(params.SetPagingState(processor->rows_result()->paging_state()));
+      SleepFor(MonoDelta::FromMilliseconds(delay_ms));
+    }
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}), values);
+  }
+
+  // The pages requested after a pause have been read ahead by then.
+  ASSERT_GT(prefetched_pages->num_pages_served(), 0);
+
+  // A page read ahead is not returned after the connection wrote to the table. The page read
+  // again is read at the read time of the paging state, which is before the write.
+  {
+    StatementParameters params;
+    params.set_page_size(3);
+    ASSERT_OK(processor->Run("SELECT r, v FROM t WHERE h = 1;", params));
+    ASSERT_OK(params.SetPagingState(processor->rows_result()->paging_state()));
+    SleepFor(MonoDelta::FromMilliseconds(100));
+    CHECK_VALID_STMT("UPDATE t SET v = 0 WHERE h = 1 AND r = 4;");
+    const size_t num_pages_served = prefetched_pages->num_pages_served();
+    ASSERT_OK(processor->Run("SELECT r, v FROM t WHERE h = 1;", params));
+    ASSERT_EQ(num_pages_served, prefetched_pages->num_pages_served());
+    ASSERT_EQ("{ { int32:4, int32:40 }, { int32:5, int32:50 }, { int32:6, int32:60 } }",
+              processor->row_block()->ToString());
+    CHECK_VALID_STMT("UPDATE t SET v = 40 WHERE h = 1 AND r = 4;");
+  }
+
+  // The page read ahead for a select with a LIMIT clause stops at the limit.
+  VerifyPaginationSelect(processor, "SELECT r, v FROM t WHERE h = 1 LIMIT 4;", 3,
+      "{ { int32:1, int32:10 }, { int32:2, int32:20 }, { int32:3, int32:30 } }"
+      "{ { int32:4, int32:40 } }");
+
+  // Pages that have been taken no longer hold memory.
+  ASSERT_EQ(0, mem_tracker->consumption());
+}
+
 #define RUN_PAGINATION_WITH_DESC_TEST(processor, type, values, rows)                               \
 do {                                                                                               \
   /* Creating the table. */                                                                        \
@@ -18,6 +18,7 @@
 
 #include "yb/yql/cql/ql/ql_processor.h"
 #include "yb/yql/cql/ql/util/ql_env.h"
+#include "yb/yql/cql/ql/util/prefetched_pages.h"
 
 #include "yb/integration-tests/mini_cluster.h"
 #include "yb/master/mini_master.h"
@@ -159,6 +160,10 @@ class TestQLProcessor : public ClockHolder, public QLProcessor {
 
   std::string CurrentKeyspace() const { return ql_env_.CurrentKeyspace(); }
 
+  void SetPrefetchedPages(const std::shared_ptr<PrefetchedPages>& prefetched_pages) {
+    ql_env_.ql_session()->set_prefetched_pages(prefetched_pages);
+  }
+
   CHECKED_STATUS UseKeyspace(const std::string& keyspace_name) {
     return ql_env_.UseKeyspace(keyspace_name);
   }
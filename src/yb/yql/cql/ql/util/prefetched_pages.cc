@@ -0,0 +1,173 @@
+//--------------------------------------------------------------------------------------------------
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "yb/yql/cql/ql/util/prefetched_pages.h"
+
+#include "yb/client/session.h"
+#include "yb/client/table.h"
+#include "yb/client/yb_op.h"
+
+namespace yb {
+namespace ql {
+
+using client::YBqlReadOpPtr;
+using client::YBSessionPtr;
+
+namespace {
+
+// The hash codes of a request are set from its hash column values or paging state when it is
+// sent (see YBqlReadOp::GetPartitionKey()), so they are left out when comparing requests.
+std::string PagingRequestKey(const QLReadRequestPB& request) {
+  QLReadRequestPB key(request);
+  key.clear_hash_code();
+  key.clear_max_hash_code();
+  return key.SerializeAsString();
+}
+
+} // namespace
+
+struct PrefetchedPages::Page {
+  YBqlReadOpPtr op;
+  YBSessionPtr session;
+  TableId table_id;
+  CoarseTimePoint deadline;
+  bool done = false;
+  ScopedTrackedConsumption consumption;
+};
+
+PrefetchedPages::PrefetchedPages(MemTrackerPtr mem_tracker)
+    : mem_tracker_(std::move(mem_tracker)) {
+}
+
+PrefetchedPages::~PrefetchedPages() {
+}
+
+void PrefetchedPages::Prefetch(const std::string& paging_state,
+                               const YBqlReadOpPtr& op,
+                               const YBSessionPtr& session,
+                               const CoarseTimePoint deadline) {
+  auto page = std::make_shared<Page>();
+  page->op = op;
+  page->session = session;
+  page->table_id = op->table()->id();
+  page->deadline = deadline;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveExpiredPagesUnlocked(CoarseMonoClock::now());
+    if (pages_.size() >= kMaxPages || !pages_.emplace(paging_state, page).second) {
+      return;
+    }
+  }
+
+  // The connection may be closed before the read completes, so the callback must not keep this
+  // object alive nor access it after it is gone.
+  std::weak_ptr<PrefetchedPages> weak_self = shared_from_this();
+  session->ReadAsync(op, [weak_self, paging_state, page](const Status& status) {
+    auto self = weak_self.lock();
+    if (self) {
+      self->ReadDone(paging_state, page, status);
+    }
+  });
+}
+
+void PrefetchedPages::ReadDone(const std::string& paging_state,
+                               const std::shared_ptr<Page>& page,
+                               const Status& status) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto itr = pages_.find(paging_state);
+  if (itr == pages_.end() || itr->second != page) {
+    return;
+  }
+
+  // Drop a page that failed to be read, or that would exceed the memory limit. The client's
+  // request for it is then served by reading the page again.
+  const auto& response = page->op->response();
+  if (!status.ok() || !response.has_status() || response.status() != QLResponsePB::YQL_STATUS_OK) {
+    pages_.erase(itr);
+    return;
+  }
+  const int64_t size = page->op->mutable_rows_data()->size();
+  if (!mem_tracker_->TryConsume(size)) {
+    VLOG(2) << "Dropping prefetched page of " << size << " bytes over the memory limit";
+    pages_.erase(itr);
+    return;
+  }
+  page->consumption = ScopedTrackedConsumption(mem_tracker_, size, AlreadyConsumed::kTrue);
+  page->session = nullptr;
+  page->done = true;
+}
+
+YBqlReadOpPtr PrefetchedPages::Take(const std::string& paging_state,
+                                    const QLReadRequestPB& request,
+                                    const YBConsistencyLevel consistency_level) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto itr = pages_.find(paging_state);
+  if (itr == pages_.end()) {
+    return nullptr;
+  }
+  const std::shared_ptr<Page> page = std::move(itr->second);
+  pages_.erase(itr);
+
+  // A page still being read is not waited for. The read completes in the background and its
+  // result is discarded.
+  if (!page->done || page->deadline < CoarseMonoClock::now()) {
+    return nullptr;
+  }
+
+  // The client may continue the select with a different page size or consistency level, or even
+  // different bind variables, so the page is used only if it was read by the same request. The
+  // paging state is the same, so is the read time.
+  if (page->op->yb_consistency_level() != consistency_level ||
+      PagingRequestKey(page->op->request()) != PagingRequestKey(request)) {
+    return nullptr;
+  }
+
+  ++num_pages_served_;
+  return page->op;
+}
+
+void PrefetchedPages::InvalidateTable(const TableId& table_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto itr = pages_.begin(); itr != pages_.end(); ) {
+    if (itr->second->table_id == table_id) {
+      itr = pages_.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+}
+
+size_t PrefetchedPages::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pages_.size();
+}
+
+size_t PrefetchedPages::num_pages_served() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_pages_served_;
+}
+
+void PrefetchedPages::RemoveExpiredPagesUnlocked(const CoarseTimePoint now) {
+  for (auto itr = pages_.begin(); itr != pages_.end(); ) {
+    if (itr->second->deadline < now) {
+      itr = pages_.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+}
+
+}  // namespace ql
+}  // namespace yb
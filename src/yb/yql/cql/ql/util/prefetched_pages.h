@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------------------------------
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+//
+// Pages of SELECT results read ahead for a client connection while the client is consuming the
+// current page. A page is keyed by the paging state the client sends back to fetch it. Pages of a
+// table are dropped when the connection writes to the table, and a page is served only if it was
+// read recently enough compared to the request for it.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef YB_YQL_CQL_QL_UTIL_PREFETCHED_PAGES_H_
+#define YB_YQL_CQL_QL_UTIL_PREFETCHED_PAGES_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "yb/client/client_fwd.h"
+
+#include "yb/common/common.pb.h"
+#include "yb/common/entity_ids.h"
+#include "yb/common/ql_protocol.pb.h"
+
+#include "yb/util/mem_tracker.h"
+#include "yb/util/monotime.h"
+#include "yb/util/status.h"
+
+namespace yb {
+namespace ql {
+
+class PrefetchedPages : public std::enable_shared_from_this<PrefetchedPages> {
+ public:
+  // Public types.
+  typedef std::shared_ptr<PrefetchedPages> SharedPtr;
+
+  // Maximum number of pages read ahead for a connection at a time.
+  static constexpr size_t kMaxPages = 16;
+
+  explicit PrefetchedPages(MemTrackerPtr mem_tracker);
+  ~PrefetchedPages();
+
+  // Start reading the page with the given paging state in the session, whose read point must be
+  // set to the read time of the paging state. The page is dropped if it is not taken by the deadline, if the connection has too many
+  // pages read ahead already, or if its rows do not fit in the memory limit of the mem tracker.
+  void Prefetch(const std::string& paging_state,
+                const client::YBqlReadOpPtr& op,
+                const client::YBSessionPtr& session,
+                CoarseTimePoint deadline);
+
+  // Take the page read ahead for the paging state. Returns nullptr if there is no such page, if
+  // the read has not completed or has failed, if the page has expired, or if it was not read by
+  // the given request.
+  client::YBqlReadOpPtr Take(const std::string& paging_state,
+                             const QLReadRequestPB& request,
+                             YBConsistencyLevel consistency_level);
+
+  // Drop the pages of the table, including those still being read. Called when the connection
+  // writes to the table, so that its later reads observe its writes.
+  void InvalidateTable(const TableId& table_id);
+
+  size_t size() const;
+
+  // Number of pages returned by Take().
+  size_t num_pages_served() const;
+
+ private:
+  struct Page;
+
+  void ReadDone(const std::string& paging_state, const std::shared_ptr<Page>& page,
+                const Status& status);
+
+  // Remove the pages whose deadline has passed. Must be called with mutex_ held.
+  void RemoveExpiredPagesUnlocked(CoarseTimePoint now);
+
+  const MemTrackerPtr mem_tracker_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<Page>> pages_;
+  size_t num_pages_served_ = 0;
+};
+
+}  // namespace ql
+}  // namespace yb
+
+#endif  // YB_YQL_CQL_QL_UTIL_PREFETCHED_PAGES_H_
@@ -50,6 +50,10 @@ class StatementParameters {
   // Set paging state.
   CHECKED_STATUS SetPagingState(const std::string& paging_state);
 
+  const QLPagingStatePB& paging_state() const {
+    return paging_state_ != nullptr ? *paging_state_ : QLPagingStatePB::default_instance();
+  }
+
   // Accessor functions for paging state fields.
   const std::string& table_id() const { return paging_state().table_id(); }
 
@@ -92,10 +96,6 @@ class StatementParameters {
   }
 
  private:
-  const QLPagingStatePB& paging_state() const {
-    return paging_state_ != nullptr ? *paging_state_ : QLPagingStatePB::default_instance();
-  }
-
   // Limit of the number of rows to return set as page size.
   uint64_t page_size_;
 
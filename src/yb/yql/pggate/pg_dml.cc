@@ -257,8 +257,14 @@ Status PgDml::Fetch(int32_t natts,
         return Status::OK();
       }
 
-      // Read from cache.
-      RETURN_NOT_OK(doc_op_->GetResult(&row_batch_));
+      // Read from cache. The partial values of a GROUP BY aggregate are all read and merged first.
+      if (!group_by_.empty()) {
+        RETURN_NOT_OK(MergeAggregateGroups(&row_batch_));
+      } else if (!batch_ybctids_.empty()) {
+        RETURN_NOT_OK(OrderBatchedRows(&row_batch_));
+      } else {
+        RETURN_NOT_OK(doc_op_->GetResult(&row_batch_));
+      }
       RETURN_NOT_OK(PgDocData::LoadCache(row_batch_, &row_count, &cursor_));
     }
 
@@ -268,13 +274,16 @@ Status PgDml::Fetch(int32_t natts,
   // Read the tuple from cached buffer and write it to postgres buffer.
   *has_data = true;
   PgTuple pg_tuple(values, isnulls, syscols);
-  RETURN_NOT_OK(WritePgTuple(&pg_tuple));
+  RETURN_NOT_OK(WritePgTuple(natts, &pg_tuple));
 
   return Status::OK();
 }
 
-Status PgDml::WritePgTuple(PgTuple *pg_tuple) {
-  int attr_num = 0;
+Status PgDml::WritePgTuple(int32_t natts, PgTuple *pg_tuple) {
+  // Aggregate values are written in order at the start of the tuple. For GROUP BY, the group-by
+  // columns are written at their attribute positions, so the aggregate values follow the table
+  // columns at the end of the tuple.
+  int attr_num = group_by_.empty() ? 0 : natts - static_cast<int>(targets_.size());
   for (const PgExpr *target : targets_) {
     if (!target->is_colref() && !target->is_aggregate()) {
       return STATUS(InternalError,
@@ -288,6 +297,168 @@ Status PgDml::WritePgTuple(PgTuple *pg_tuple) {
     PgWireDataHeader header = PgDocData::ReadDataHeader(&cursor_);
     target->TranslateData(&cursor_, header, attr_num - 1, pg_tuple);
   }
+  for (const PgExpr *group_by : group_by_) {
+    attr_num = static_cast<const PgColumnRef *>(group_by)->attr_num();
+    PgWireDataHeader header = PgDocData::ReadDataHeader(&cursor_);
+    group_by->TranslateData(&cursor_, header, attr_num - 1, pg_tuple);
+  }
+  return Status::OK();
+}
+
+namespace {
+
+// Combine a partial aggregate value of a group with the value computed so far.
+Status MergeAggregateValue(PgExpr::Opcode opcode, const QLValue& value, QLValue *result) {
+  if (value.IsNull()) {
+    return Status::OK();
+  }
+  if (result->IsNull()) {
+    *result = value;
+    return Status::OK();
+  }
+
+  switch (opcode) {
+    case PgExpr::Opcode::PG_EXPR_MAX:
+      if (*result < value) {
+        *result = value;
+      }
+      return Status::OK();
+
+    case PgExpr::Opcode::PG_EXPR_MIN:
+      if (*result > value) {
+        *result = value;
+      }
+      return Status::OK();
+
+    case PgExpr::Opcode::PG_EXPR_COUNT: FALLTHROUGH_INTENDED;
+    case PgExpr::Opcode::PG_EXPR_SUM:
+      // Integer sums and counts are computed as 8-byte integers by DocDB.
+      switch (value.type()) {
+        case InternalType::kInt64Value:
+          result->set_int64_value(result->int64_value() + value.int64_value());
+          return Status::OK();
+        case InternalType::kFloatValue:
+          result->set_float_value(result->float_value() + value.float_value());
+          return Status::OK();
+        case InternalType::kDoubleValue:
+          result->set_double_value(result->double_value() + value.double_value());
+          return Status::OK();
+        default:
+          break;
+      }
+      break;
+
+    default:
+      break;
+  }
+  return STATUS_FORMAT(NotSupported, "Unexpected partial aggregate value $0 for operator $1",
+                       value, static_cast<int>(opcode));
+}
+
+} // namespace
+
+Status PgDml::MergeAggregateGroups(string *result_set) {
+  // DocDB returns a row of partial aggregate values per group for every tablet and page it reads.
+  // The row holds the aggregate values followed by the group-by values.
+  std::vector<InternalType> column_types;
+  for (const PgExpr *target : targets_) {
+    column_types.push_back(target->internal_type());
+  }
+  for (const PgExpr *group_by : group_by_) {
+    column_types.push_back(group_by->internal_type());
+  }
+
+  // Groups are keyed by the wire format of their group-by values.
+  std::unordered_map<string, std::vector<QLValue>> groups;
+  string batch;
+  while (!VERIFY_RESULT(doc_op_->EndOfResult())) {
+    batch.clear();
+    RETURN_NOT_OK(doc_op_->GetResult(&batch));
+    if (batch.empty()) {
+      continue;
+    }
+
+    int64_t row_count = 0;
+    Slice cursor;
+    RETURN_NOT_OK(PgDocData::LoadCache(batch, &row_count, &cursor));
+    for (int64_t row = 0; row < row_count; row++) {
+      std::vector<QLValue> values(column_types.size());
+      const char *group_key_start = nullptr;
+      for (size_t col = 0; col < column_types.size(); col++) {
+        if (col == targets_.size()) {
+          group_key_start = cursor.cdata();
+        }
+        RETURN_NOT_OK(PgDocData::ReadColumn(&cursor, column_types[col], &values[col]));
+      }
+
+      string group_key(group_key_start, cursor.cdata() - group_key_start);
+      auto iter = groups.find(group_key);
+      if (iter == groups.end()) {
+        groups.emplace(std::move(group_key), std::move(values));
+        continue;
+      }
+      for (size_t col = 0; col < targets_.size(); col++) {
+        RETURN_NOT_OK(MergeAggregateValue(targets_[col]->opcode(), values[col],
+                                          &iter->second[col]));
+      }
+    }
+  }
+
+  faststring buffer;
+  PgDocData::WriteInt64(groups.size(), &buffer);
+  for (const auto& group : groups) {
+    for (const QLValue& value : group.second) {
+      RETURN_NOT_OK(PgDocData::WriteColumn(value, &buffer));
+    }
+  }
+  *result_set = buffer.ToString();
+  return Status::OK();
+}
+
+Status PgDml::OrderBatchedRows(string *result_set) {
+  // DocDB returns the rows of each tablet separately, so the rows are placed by their ybctids.
+  std::vector<std::string> rows(batch_ybctids_.size());
+  std::vector<bool> found(batch_ybctids_.size(), false);
+  int64_t found_count = 0;
+  string batch;
+  QLValue value;
+  while (!VERIFY_RESULT(doc_op_->EndOfResult())) {
+    batch.clear();
+    RETURN_NOT_OK(doc_op_->GetResult(&batch));
+    if (batch.empty()) {
+      continue;
+    }
+
+    int64_t row_count = 0;
+    Slice cursor;
+    RETURN_NOT_OK(PgDocData::LoadCache(batch, &row_count, &cursor));
+    for (int64_t row = 0; row < row_count; row++) {
+      const char *row_start = cursor.cdata();
+      for (const PgExpr *target : targets_) {
+        RETURN_NOT_OK(PgDocData::ReadColumn(&cursor, target->internal_type(), &value));
+      }
+      const char *row_end = cursor.cdata();
+
+      RETURN_NOT_OK(PgDocData::ReadColumn(&cursor, InternalType::kBinaryValue, &value));
+      auto iter = batch_ybctid_positions_.find(value.binary_value());
+      SCHECK(iter != batch_ybctid_positions_.end(), Corruption,
+             "Unexpected ybctid in the result of batched key lookup");
+      if (!found[iter->second]) {
+        found[iter->second] = true;
+        found_count++;
+      }
+      rows[iter->second].assign(row_start, row_end - row_start);
+    }
+  }
+
+  faststring buffer;
+  PgDocData::WriteInt64(found_count, &buffer);
+  for (size_t i = 0; i < rows.size(); i++) {
+    if (found[i]) {
+      buffer.append(rows[i]);
+    }
+  }
+  *result_set = buffer.ToString();
   return Status::OK();
 }
 
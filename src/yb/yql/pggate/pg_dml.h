@@ -62,7 +62,7 @@ class PgDml : public PgStatement {
                        bool *isnulls,
                        PgSysColumns *syscols,
                        bool *has_data);
-  CHECKED_STATUS WritePgTuple(PgTuple *pg_tuple);
+  CHECKED_STATUS WritePgTuple(int32_t natts, PgTuple *pg_tuple);
 
   // Build tuple id (ybctid) of the given Postgres tuple.
   Result<std::string> BuildYBTupleId(const PgAttrValueDescriptor *attrs, int32_t nattrs);
@@ -97,6 +97,14 @@ class PgDml : public PgStatement {
   // Indicate in the protobuf what columns must be read before the statement is processed.
   static void SetColumnRefIds(PgTableDesc::ScopedRefPtr table_desc, PgsqlColumnRefsPB *column_refs);
 
+  // Read all partial aggregate values of a GROUP BY aggregate from DocDB and combine the values of
+  // each group, returning a batch of rows with one row per group.
+  CHECKED_STATUS MergeAggregateGroups(string *result_set);
+
+  // Read all rows of a batched key lookup from DocDB and return them in the order of their
+  // ybctids in batch_ybctids_. Each row read from DocDB is followed by its ybctid.
+  CHECKED_STATUS OrderBatchedRows(string *result_set);
+
   // -----------------------------------------------------------------------------------------------
   // Data members that define the DML statement.
   //
@@ -108,6 +116,9 @@ class PgDml : public PgStatement {
   // Postgres targets of statements. These are either selected or returned expressions.
   std::vector<PgExpr*> targets_;
 
+  // Group-by columns of an aggregate SELECT.
+  std::vector<PgExpr*> group_by_;
+
   // -----------------------------------------------------------------------------------------------
   // Data members for generated protobuf.
   // NOTE:
@@ -123,6 +134,10 @@ class PgDml : public PgStatement {
   // * Bind values are used to identify the selected rows to be operated on.
   // * Set values are used to hold columns' new values in the selected rows.
   bool ybctid_bind_ = false;
+
+  // Distinct ybctids of a batched key lookup in the order they are bound, and their positions.
+  std::vector<std::string> batch_ybctids_;
+  std::unordered_map<std::string, size_t> batch_ybctid_positions_;
   std::unordered_map<PgsqlExpressionPB*, PgExpr*> expr_binds_;
   std::unordered_map<PgsqlExpressionPB*, PgExpr*> expr_assigns_;
 
@@ -15,23 +15,58 @@
 #include "yb/yql/pggate/pg_doc_op.h"
 #include "yb/yql/pggate/pg_txn_manager.h"
 
+#include <algorithm>
+
 #include <boost/algorithm/string.hpp>
 
 #include "yb/client/table.h"
 
 #include "yb/yql/pggate/pggate_flags.h"
+#include "yb/yql/pggate/util/pg_doc_data.h"
 
 // TODO: include a header for PgTxnManager specifically.
 #include "yb/yql/pggate/pggate_if_cxx_decl.h"
 
+#include "yb/common/partition.h"
 #include "yb/common/pgsql_error.h"
 #include "yb/common/transaction_error.h"
+#include "yb/docdb/doc_key.h"
 #include "yb/util/yb_pg_errcodes.h"
 #include "yb/yql/pggate/ybc_pggate.h"
 
+namespace {
+
+// Number of concurrent sub-scans a full-table scan is split into. Set by the session's
+// "yb_select_parallelism" setting.
+int select_parallelism = 1;
+
+} // namespace
+
+extern "C" {
+
+void YBCAssignSelectParallelism(int newval, void* extra) {
+  select_parallelism = newval;
+}
+
+}
+
 namespace yb {
 namespace pggate {
 
+namespace {
+
+// Whether a serialized result set contains any rows.
+bool HasRows(const string& rows_data) {
+  if (rows_data.empty()) {
+    return false;
+  }
+  int64_t row_count = 0;
+  Slice cursor;
+  return PgDocData::LoadCache(rows_data, &row_count, &cursor).ok() && row_count > 0;
+}
+
+} // namespace
+
 PgDocOp::PgDocOp(PgSession::ScopedRefPtr pg_session)
     : pg_session_(std::move(pg_session)) {
   exec_params_.limit_count = FLAGS_ysql_prefetch_limit;
@@ -80,14 +115,14 @@ Result<RequestSent> PgDocOp::Execute() {
   // This refers to the sequence of operations between this layer and the underlying tablet
   // server / DocDB layer, not to the sequence of operations between the PostgreSQL layer and this
   // layer.
-  InitUnlocked(&lock);
+  RETURN_NOT_OK(InitUnlocked(&lock));
 
   RETURN_NOT_OK(SendRequestUnlocked());
 
   return RequestSent(waiting_for_response_);
 }
 
-void PgDocOp::InitUnlocked(std::unique_lock<std::mutex>* lock) {
+Status PgDocOp::InitUnlocked(std::unique_lock<std::mutex>* lock) {
   CHECK(!is_canceled_);
   if (waiting_for_response_) {
     LOG(DFATAL) << __PRETTY_FUNCTION__
@@ -100,6 +135,7 @@ void PgDocOp::InitUnlocked(std::unique_lock<std::mutex>* lock) {
   result_cache_.clear();
   end_of_data_ = false;
   has_cached_data_ = false;
+  return Status::OK();
 }
 
 Status PgDocOp::GetResult(string *result_set) {
@@ -194,15 +230,115 @@ PgDocReadOp::PgDocReadOp(
 PgDocReadOp::~PgDocReadOp() {
 }
 
-void PgDocReadOp::InitUnlocked(std::unique_lock<std::mutex>* lock) {
-  PgDocOp::InitUnlocked(lock);
+Status PgDocReadOp::InitUnlocked(std::unique_lock<std::mutex>* lock) {
+  RETURN_NOT_OK(PgDocOp::InitUnlocked(lock));
 
   read_op_->mutable_request()->set_return_paging_state(true);
+  if (read_op_->request().batch_ybctids_size() > 0) {
+    return InitBatchOpsUnlocked();
+  }
+  InitParallelOpsUnlocked();
+  return Status::OK();
 }
 
-void PgDocReadOp::SetRequestPrefetchLimit() {
+Status PgDocReadOp::InitBatchOpsUnlocked() {
+  parallel_ops_.clear();
+
+  // Group the ybctids by the tablet that holds their rows. A table that is not hash-partitioned
+  // has a single tablet.
+  const client::YBTable* table = read_op_->table();
+  const bool is_hash_partitioned = table->partition_schema().IsHashPartitioning();
+  const std::vector<std::string>& partitions = table->GetPartitions();
+  std::vector<std::vector<std::string>> partition_ybctids(partitions.size());
+  for (const std::string& ybctid : read_op_->request().batch_ybctids()) {
+    size_t partition = 0;
+    if (is_hash_partitioned) {
+      const uint16_t hash_code = VERIFY_RESULT(docdb::DocKey::DecodeHash(ybctid));
+      const std::string partition_key = PartitionSchema::EncodeMultiColumnHashValue(hash_code);
+      partition = std::upper_bound(partitions.begin(), partitions.end(), partition_key) -
+                  partitions.begin() - 1;
+    }
+    partition_ybctids[partition].push_back(ybctid);
+  }
+
+  // The requests are sent and received together like the sub-scans of a parallel scan. Each one is
+  // bounded to the hash range of its tablet, which also routes it to that tablet.
+  for (size_t i = 0; i < partitions.size(); i++) {
+    std::vector<std::string>& ybctids = partition_ybctids[i];
+    if (ybctids.empty()) {
+      continue;
+    }
+    std::sort(ybctids.begin(), ybctids.end());
+
+    std::shared_ptr<client::YBPgsqlReadOp> op = read_op_->DeepCopy();
+    PgsqlReadRequestPB* op_req = op->mutable_request();
+    op_req->clear_batch_ybctids();
+    for (std::string& ybctid : ybctids) {
+      op_req->add_batch_ybctids(std::move(ybctid));
+    }
+    if (is_hash_partitioned) {
+      op_req->set_hash_code(partitions[i].empty()
+          ? 0 : PartitionSchema::DecodeMultiColumnHashValue(partitions[i]));
+      op_req->set_max_hash_code(i + 1 < partitions.size()
+          ? PartitionSchema::DecodeMultiColumnHashValue(partitions[i + 1]) - 1
+          : PartitionSchema::kMaxPartitionKey);
+    }
+    parallel_ops_.push_back(std::move(op));
+  }
+  return Status::OK();
+}
+
+void PgDocReadOp::InitParallelOpsUnlocked() {
+  parallel_ops_.clear();
+  if (select_parallelism <= 1) {
+    return;
+  }
+
+  // Only a forward full scan of a hash-partitioned table is fanned out. Rows of such a scan have no
+  // defined order across tablets, so the results of the sub-scans can be merged as they arrive.
+  // Scans with a LIMIT are kept serial as they usually need only the first tablet(s).
+  const PgsqlReadRequestPB& req = read_op_->request();
+  if (!req.partition_column_values().empty() ||
+      req.has_ybctid_column_value() ||
+      req.has_index_request() ||
+      req.has_paging_state() ||
+      req.has_hash_code() ||
+      req.has_max_hash_code() ||
+      !req.is_forward_scan() ||
+      !exec_params_.limit_use_default) {
+    return;
+  }
+
+  const client::YBTable* table = read_op_->table();
+  if (!table->partition_schema().IsHashPartitioning()) {
+    return;
+  }
+
+  // Each sub-scan covers a contiguous range of tablets and walks them serially using its own
+  // paging state. The tablet servers stop paging at the max hash code of the request.
+  const std::vector<std::string>& partitions = table->GetPartitions();
+  const size_t num_ops = std::min<size_t>(select_parallelism, partitions.size());
+  if (num_ops <= 1) {
+    return;
+  }
+
+  parallel_ops_.reserve(num_ops);
+  for (size_t i = 0; i < num_ops; i++) {
+    const size_t start = partitions.size() * i / num_ops;
+    const size_t end = partitions.size() * (i + 1) / num_ops;
+    std::shared_ptr<client::YBPgsqlReadOp> op = read_op_->DeepCopy();
+    PgsqlReadRequestPB* op_req = op->mutable_request();
+    op_req->set_hash_code(partitions[start].empty()
+        ? 0 : PartitionSchema::DecodeMultiColumnHashValue(partitions[start]));
+    op_req->set_max_hash_code(end < partitions.size()
+        ? PartitionSchema::DecodeMultiColumnHashValue(partitions[end]) - 1
+        : PartitionSchema::kMaxPartitionKey);
+    parallel_ops_.push_back(std::move(op));
+  }
+}
+
+void PgDocReadOp::SetRequestPrefetchLimit(PgsqlReadRequestPB* req) {
   // Predict the maximum prefetch-limit using the associated gflags.
-  PgsqlReadRequestPB *req = read_op_->mutable_request();
   int predicted_limit = FLAGS_ysql_prefetch_limit;
   if (!req->is_forward_scan()) {
     // Backward scan is slower than forward scan, so predicted limit is a smaller number.
@@ -223,9 +359,7 @@ void PgDocReadOp::SetRequestPrefetchLimit() {
   req->set_limit(limit_count);
 }
 
-void PgDocReadOp::SetRowMark() {
-  PgsqlReadRequestPB *const req = read_op_->mutable_request();
-
+void PgDocReadOp::SetRowMark(PgsqlReadRequestPB* req) {
   if (exec_params_.rowmark < 0) {
     req->clear_row_mark_type();
   } else {
@@ -236,8 +370,16 @@ void PgDocReadOp::SetRowMark() {
 Status PgDocReadOp::SendRequestUnlocked() {
   CHECK(!waiting_for_response_);
 
-  SetRequestPrefetchLimit();
-  SetRowMark();
+  if (!parallel_ops_.empty()) {
+    return SendParallelRequestsUnlocked();
+  }
+
+  SetRequestPrefetchLimit(read_op_->mutable_request());
+  SetRowMark(read_op_->mutable_request());
+
+  if (LookupSharedCatalogCacheUnlocked()) {
+    return Status::OK();
+  }
 
   auto apply_outcome = VERIFY_RESULT(pg_session_->PgApplyAsync(read_op_, &read_time_));
   SCHECK_EQ(apply_outcome.buffered, OpBuffered::kFalse,
@@ -254,6 +396,30 @@ Status PgDocReadOp::SendRequestUnlocked() {
   return Status::OK();
 }
 
+Status PgDocReadOp::SendParallelRequestsUnlocked() {
+  // All sub-scans go to the same session, so one flush sends them to their tablets concurrently.
+  client::YBSessionPtr yb_session;
+  for (const auto& op : parallel_ops_) {
+    SetRequestPrefetchLimit(op->mutable_request());
+    SetRowMark(op->mutable_request());
+
+    auto apply_outcome = VERIFY_RESULT(pg_session_->PgApplyAsync(op, &read_time_));
+    SCHECK_EQ(apply_outcome.buffered, OpBuffered::kFalse,
+              IllegalState, "YSQL read operation should not be buffered");
+    yb_session = apply_outcome.yb_session;
+  }
+
+  waiting_for_response_ = true;
+  Status s = pg_session_->PgFlushAsync([self = shared_from(this)](const Status& s) {
+                                         self->ReceiveResponse(s);
+                                       }, yb_session);
+  if (!s.ok()) {
+    waiting_for_response_ = false;
+    return s;
+  }
+  return Status::OK();
+}
+
 void PgDocReadOp::ReceiveResponse(Status exec_status) {
   std::unique_lock<std::mutex> lock(mtx_);
   CHECK(waiting_for_response_);
@@ -261,6 +427,11 @@ void PgDocReadOp::ReceiveResponse(Status exec_status) {
   waiting_for_response_ = false;
   exec_status_ = exec_status;
 
+  if (!parallel_ops_.empty()) {
+    ReceiveParallelResponsesUnlocked();
+    return;
+  }
+
   if (exec_status.ok()) {
     HandleResponseStatus(read_op_.get());
   }
@@ -272,34 +443,120 @@ void PgDocReadOp::ReceiveResponse(Status exec_status) {
   }
 
   if (!is_canceled_) {
+    // Publish catalog reads that fit in one page and found a row to the shared catalog cache.
+    // Inserts that don't change the catalog version may add the rows that were not found. This
+    // copies the rows because saving them to our own cache moves them out of the operation.
+    if (!catalog_cache_key_.empty() && !read_op_->response().has_paging_state() &&
+        HasRows(*read_op_->mutable_rows_data())) {
+      pg_session_->UpdateSharedCatalogCache(
+          catalog_cache_version_, std::move(catalog_cache_key_), *read_op_->mutable_rows_data());
+    }
+    catalog_cache_key_.clear();
+
     // Save it to cache.
     WriteToCacheUnlocked(read_op_);
 
     // Setup request for the next batch of data.
-    const PgsqlResponsePB& res = read_op_->response();
-    if (res.has_paging_state()) {
-      PgsqlReadRequestPB *req = read_op_->mutable_request();
-      // Set up paging state for next request.
-      // A query request can be nested, and paging state belong to the innermost query which is
-      // the read operator that is operated first and feeds data to other queries.
-      // Recursive Proto Message:
-      //     PgsqlReadRequestPB { PgsqlReadRequestPB index_request; }
-      PgsqlReadRequestPB *innermost_req = req;
-      while (innermost_req->has_index_request()) {
-        innermost_req = innermost_req->mutable_index_request();
+    end_of_data_ = !SetupNextPageUnlocked(read_op_.get());
+  } else {
+    end_of_data_ = true;
+  }
+}
+
+void PgDocReadOp::ReceiveParallelResponsesUnlocked() {
+  if (exec_status_.ok()) {
+    for (const auto& op : parallel_ops_) {
+      HandleResponseStatus(op.get());
+      if (!exec_status_.ok()) {
+        break;
       }
-      *innermost_req->mutable_paging_state() = res.paging_state();
-      // Parse/Analysis/Rewrite catalog version has already been checked on the first request.
-      // The docdb layer will check the target table's schema version is compatible.
-      // This allows long-running queries to continue in the presence of other DDL statements
-      // as long as they do not affect the table(s) being queried.
-      req->clear_ysql_catalog_version();
-    } else {
-      end_of_data_ = true;
     }
-  } else {
+  }
+
+  if (!exec_status_.ok() || is_canceled_) {
+    parallel_ops_.clear();
     end_of_data_ = true;
+    return;
+  }
+
+  // Save the results in partition order and keep only the sub-scans that have more data to read.
+  std::vector<std::shared_ptr<client::YBPgsqlReadOp>> active_ops;
+  active_ops.reserve(parallel_ops_.size());
+  for (auto& op : parallel_ops_) {
+    WriteToCacheUnlocked(op);
+    if (SetupNextPageUnlocked(op.get())) {
+      active_ops.push_back(std::move(op));
+    }
+  }
+  parallel_ops_.swap(active_ops);
+  end_of_data_ = parallel_ops_.empty();
+}
+
+bool PgDocReadOp::LookupSharedCatalogCacheUnlocked() {
+  catalog_cache_key_.clear();
+  const PgsqlReadRequestPB& req = read_op_->request();
+  if (!read_op_->IsYsqlCatalogOp() || req.has_paging_state() || req.has_row_mark_type()) {
+    return false;
+  }
+  // Only primary key lookups are shared: an insert cannot add another row with the key they found,
+  // so only writes that change the catalog version can change their results.
+  if (req.has_index_request() ||
+      (!req.has_ybctid_column_value() &&
+       implicit_cast<size_t>(req.partition_column_values_size() + req.range_column_values_size()) !=
+           read_op_->table()->schema().num_key_columns())) {
+    return false;
+  }
+  auto catalog_version = pg_session_->GetSharedCatalogCacheVersion();
+  if (!catalog_version) {
+    return false;
+  }
+
+  // The key is the request itself, without the fields that differ between identical reads.
+  PgsqlReadRequestPB key_req(req);
+  key_req.clear_client();
+  key_req.clear_stmt_id();
+  key_req.clear_ysql_catalog_version();
+  string key;
+  key_req.AppendToString(&key);
+
+  string rows_data;
+  if (!pg_session_->LookupSharedCatalogCache(*catalog_version, key, &rows_data)) {
+    catalog_cache_key_ = std::move(key);
+    catalog_cache_version_ = *catalog_version;
+    return false;
+  }
+
+  if (!rows_data.empty()) {
+    result_cache_.push_back(std::move(rows_data));
+    has_cached_data_ = true;
+  }
+  end_of_data_ = true;
+  return true;
+}
+
+bool PgDocReadOp::SetupNextPageUnlocked(client::YBPgsqlReadOp* op) {
+  const PgsqlResponsePB& res = op->response();
+  if (!res.has_paging_state()) {
+    return false;
+  }
+
+  PgsqlReadRequestPB *req = op->mutable_request();
+  // Set up paging state for next request.
+  // A query request can be nested, and paging state belong to the innermost query which is
+  // the read operator that is operated first and feeds data to other queries.
+  // Recursive Proto Message:
+  //     PgsqlReadRequestPB { PgsqlReadRequestPB index_request; }
+  PgsqlReadRequestPB *innermost_req = req;
+  while (innermost_req->has_index_request()) {
+    innermost_req = innermost_req->mutable_index_request();
   }
+  *innermost_req->mutable_paging_state() = res.paging_state();
+  // Parse/Analysis/Rewrite catalog version has already been checked on the first request.
+  // The docdb layer will check the target table's schema version is compatible.
+  // This allows long-running queries to continue in the presence of other DDL statements
+  // as long as they do not affect the table(s) being queried.
+  req->clear_ysql_catalog_version();
+  return true;
 }
 
 //--------------------------------------------------------------------------------------------------
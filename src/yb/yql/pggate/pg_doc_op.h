@@ -17,6 +17,7 @@
 
 #include <mutex>
 #include <condition_variable>
+#include <vector>
 
 #include "yb/util/locks.h"
 #include "yb/client/yb_op.h"
@@ -66,7 +67,7 @@ class PgDocOp : public std::enable_shared_from_this<PgDocOp> {
   }
 
  protected:
-  virtual void InitUnlocked(std::unique_lock<std::mutex>* lock);
+  virtual CHECKED_STATUS InitUnlocked(std::unique_lock<std::mutex>* lock);
   virtual CHECKED_STATUS SendRequestUnlocked() = 0;
 
   // Caching and reading return result.
@@ -140,18 +141,48 @@ class PgDocReadOp : public PgDocOp {
 
  private:
   // Process response from DocDB.
-  void InitUnlocked(std::unique_lock<std::mutex>* lock) override;
+  CHECKED_STATUS InitUnlocked(std::unique_lock<std::mutex>* lock) override;
   CHECKED_STATUS SendRequestUnlocked() override;
   virtual void ReceiveResponse(Status exec_status);
 
   // Analyze options and pick the appropriate prefetch limit.
-  void SetRequestPrefetchLimit();
+  void SetRequestPrefetchLimit(PgsqlReadRequestPB* req);
 
-  // Set the row_mark_type field of our read request based on our exec control parameter.
-  void SetRowMark();
+  // Set the row_mark_type field of a read request based on our exec control parameter.
+  void SetRowMark(PgsqlReadRequestPB* req);
+
+  // Split a full scan of a hash-partitioned table into up to "yb_select_parallelism" sub-scans,
+  // each bounded to a contiguous range of tablets. Leaves parallel_ops_ empty if the request
+  // cannot or should not be parallelized.
+  void InitParallelOpsUnlocked();
+
+  // Split a batched key lookup into one request per tablet holding some of the rows. Each request
+  // reads its ybctids in sorted order.
+  CHECKED_STATUS InitBatchOpsUnlocked();
+
+  // Send all unfinished sub-scans in one flush so that they are executed concurrently.
+  CHECKED_STATUS SendParallelRequestsUnlocked();
+  void ReceiveParallelResponsesUnlocked();
+
+  // Set up the paging state of "op" for its next batch of data. Returns false if "op" is done.
+  bool SetupNextPageUnlocked(client::YBPgsqlReadOp* op);
+
+  // Serve a catalog read from the catalog cache shared through the local tserver. Returns true on
+  // hit. On miss, prepares catalog_cache_key_ so that a single-page result gets published.
+  bool LookupSharedCatalogCacheUnlocked();
 
   // Operator.
   std::shared_ptr<client::YBPgsqlReadOp> read_op_;
+
+  // Key and catalog version under which the result of read_op_ is published to the shared
+  // catalog cache. Empty key if the result is not to be published.
+  std::string catalog_cache_key_;
+  uint64_t catalog_cache_version_ = 0;
+
+  // Sub-scans of read_op_ that have not reached the end of their partition range, in partition
+  // order, or the per-tablet requests of a batched key lookup. Empty when the scan is executed
+  // serially by read_op_ itself.
+  std::vector<std::shared_ptr<client::YBPgsqlReadOp>> parallel_ops_;
 };
 
 class PgDocWriteOp : public PgDocOp {
@@ -42,6 +42,11 @@ const std::unordered_map<string, PgExpr::Opcode> kOperatorNames = {
   { ">=", PgExpr::Opcode::PG_EXPR_GE },
   { "<", PgExpr::Opcode::PG_EXPR_LT },
   { "<=", PgExpr::Opcode::PG_EXPR_LE },
+  { "and", PgExpr::Opcode::PG_EXPR_AND },
+  { "or", PgExpr::Opcode::PG_EXPR_OR },
+  { "is_null", PgExpr::Opcode::PG_EXPR_IS_NULL },
+  { "is_not_null", PgExpr::Opcode::PG_EXPR_IS_NOT_NULL },
+  { "in", PgExpr::Opcode::PG_EXPR_IN },
 
   { "avg", PgExpr::Opcode::PG_EXPR_AVG },
   { "sum", PgExpr::Opcode::PG_EXPR_SUM },
@@ -110,6 +115,50 @@ bfpg::TSOpcode PgExpr::PGOpcodeToTSOpcode(const PgExpr::Opcode opcode) {
   }
 }
 
+QLOperator PgExpr::PGOpcodeToQLOperator(const PgExpr::Opcode opcode) {
+  switch (opcode) {
+    case Opcode::PG_EXPR_NOT:
+      return QL_OP_NOT;
+
+    case Opcode::PG_EXPR_EQ:
+      return QL_OP_EQUAL;
+
+    case Opcode::PG_EXPR_NE:
+      return QL_OP_NOT_EQUAL;
+
+    case Opcode::PG_EXPR_GE:
+      return QL_OP_GREATER_THAN_EQUAL;
+
+    case Opcode::PG_EXPR_GT:
+      return QL_OP_GREATER_THAN;
+
+    case Opcode::PG_EXPR_LE:
+      return QL_OP_LESS_THAN_EQUAL;
+
+    case Opcode::PG_EXPR_LT:
+      return QL_OP_LESS_THAN;
+
+    case Opcode::PG_EXPR_AND:
+      return QL_OP_AND;
+
+    case Opcode::PG_EXPR_OR:
+      return QL_OP_OR;
+
+    case Opcode::PG_EXPR_IS_NULL:
+      return QL_OP_IS_NULL;
+
+    case Opcode::PG_EXPR_IS_NOT_NULL:
+      return QL_OP_IS_NOT_NULL;
+
+    case Opcode::PG_EXPR_IN:
+      return QL_OP_IN;
+
+    default:
+      LOG(DFATAL) << "No supported QLOperator for PG opcode: " << static_cast<int32_t>(opcode);
+      return QL_OP_NOOP;
+  }
+}
+
 bfpg::TSOpcode PgExpr::OperandTypeToSumTSOpcode(InternalType type) {
   switch (type) {
     case InternalType::kInt8Value:
@@ -662,6 +711,22 @@ void PgOperator::AppendArg(PgExpr *arg) {
 }
 
 Status PgOperator::PrepareForRead(PgDml *pg_stmt, PgsqlExpressionPB *expr_pb) {
+  if (is_condition()) {
+    PgsqlConditionPB *condition = expr_pb->mutable_condition();
+    condition->set_op(PGOpcodeToQLOperator(opcode_));
+    if (opcode_ == Opcode::PG_EXPR_IN) {
+      // "col IN (c1, c2, ...)" is sent as a column and a list value. The list is filled by Eval().
+      SCHECK_GE(args_.size(), 2U, InvalidArgument, "IN operator requires at least one value");
+      RETURN_NOT_OK(args_.front()->PrepareForRead(pg_stmt, condition->add_operands()));
+      condition->add_operands()->mutable_value()->mutable_list_value();
+      return Status::OK();
+    }
+    for (const auto& arg : args_) {
+      RETURN_NOT_OK(arg->PrepareForRead(pg_stmt, condition->add_operands()));
+    }
+    return Status::OK();
+  }
+
   PgsqlBCallPB *tscall = expr_pb->mutable_tscall();
   bfpg::TSOpcode tsopcode;
   if (opcode_ == Opcode::PG_EXPR_SUM) {
@@ -678,5 +743,29 @@ Status PgOperator::PrepareForRead(PgDml *pg_stmt, PgsqlExpressionPB *expr_pb) {
   return Status::OK();
 }
 
+Status PgOperator::Eval(PgDml *pg_stmt, PgsqlExpressionPB *expr_pb) {
+  if (!is_condition()) {
+    // Operands of other operators are fully set up by PrepareForRead().
+    return Status::OK();
+  }
+
+  PgsqlConditionPB *condition = expr_pb->mutable_condition();
+  if (opcode_ == Opcode::PG_EXPR_IN) {
+    QLSeqValuePB *list_value = condition->mutable_operands(1)->mutable_value()->mutable_list_value();
+    list_value->clear_elems();
+    for (auto iter = args_.begin() + 1; iter != args_.end(); iter++) {
+      RETURN_NOT_OK((*iter)->Eval(pg_stmt, list_value->add_elems()));
+    }
+    return Status::OK();
+  }
+
+  int operand_index = 0;
+  for (const auto& arg : args_) {
+    RETURN_NOT_OK(arg->Eval(pg_stmt, condition->mutable_operands(operand_index)));
+    operand_index++;
+  }
+  return Status::OK();
+}
+
 }  // namespace pggate
 }  // namespace yb
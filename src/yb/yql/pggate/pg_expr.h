@@ -31,7 +31,7 @@ class PgExpr {
     PG_EXPR_COLREF,
     PG_EXPR_VARIABLE,
 
-    // The logical expression for defining the conditions when we support WHERE clause.
+    // The logical expression for defining the conditions of the WHERE clause.
     PG_EXPR_NOT,
     PG_EXPR_EQ,
     PG_EXPR_NE,
@@ -39,6 +39,11 @@ class PgExpr {
     PG_EXPR_GT,
     PG_EXPR_LE,
     PG_EXPR_LT,
+    PG_EXPR_AND,
+    PG_EXPR_OR,
+    PG_EXPR_IS_NULL,
+    PG_EXPR_IS_NOT_NULL,
+    PG_EXPR_IN,
 
     // Aggregate functions.
     PG_EXPR_AVG,
@@ -80,6 +85,10 @@ class PgExpr {
   bool is_colref() const {
     return opcode_ == Opcode::PG_EXPR_COLREF;
   }
+  bool is_condition() const {
+    // Return true for logical expressions that are pushed down as a WHERE condition.
+    return (opcode_ >= Opcode::PG_EXPR_NOT && opcode_ <= Opcode::PG_EXPR_IN);
+  }
   bool is_aggregate() const {
     // Only return true for pushdown supported aggregates.
     return (opcode_ == Opcode::PG_EXPR_SUM ||
@@ -187,6 +196,7 @@ class PgExpr {
   static CHECKED_STATUS CheckOperatorName(const char *name);
   static Opcode NameToOpcode(const char *name);
   static bfpg::TSOpcode PGOpcodeToTSOpcode(const PgExpr::Opcode opcode);
+  static QLOperator PGOpcodeToQLOperator(const PgExpr::Opcode opcode);
   static bfpg::TSOpcode OperandTypeToSumTSOpcode(InternalType type);
 
  protected:
@@ -285,6 +295,9 @@ class PgOperator : public PgExpr {
   // Setup operator expression when constructing statement.
   virtual CHECKED_STATUS PrepareForRead(PgDml *pg_stmt, PgsqlExpressionPB *expr_pb);
 
+  // Update the operands of a condition with the current values of its constant arguments.
+  CHECKED_STATUS Eval(PgDml *pg_stmt, PgsqlExpressionPB *expr_pb) override;
+
  private:
   const string opname_;
   std::vector<PgExpr*> args_;
@@ -17,6 +17,7 @@
 #include "yb/yql/pggate/util/pg_doc_data.h"
 #include "yb/client/yb_op.h"
 #include "yb/docdb/primitive_value.h"
+#include "yb/yql/pggate/pggate_flags.h"
 
 namespace yb {
 namespace pggate {
@@ -32,6 +33,16 @@ PgSelect::PgSelect(PgSession::ScopedRefPtr pg_session, const PgObjectId& table_i
 }
 
 PgSelect::~PgSelect() {
+  if (doc_op_) {
+    // Wait until the request is no longer in flight before handing its memory over.
+    doc_op_->AbortAndWait();
+    pg_session_->SaveReadRequestTemplate(ReadRequestTemplateKey(), read_req_);
+  }
+}
+
+std::string PgSelect::ReadRequestTemplateKey() const {
+  return index_id_.IsValid() ? table_id_.GetYBTableId() + index_id_.GetYBTableId()
+                             : table_id_.GetYBTableId();
 }
 
 void PgSelect::UseIndex(const PgObjectId& index_id) {
@@ -53,6 +64,7 @@ Status PgSelect::Prepare() {
   auto doc_op = make_shared<PgDocReadOp>(
       pg_session_, table_desc_->NewPgsqlSelect());
   read_req_ = doc_op->read_op()->mutable_request();
+  pg_session_->ReuseReadRequestTemplate(ReadRequestTemplateKey(), read_req_);
   if (index_id_.IsValid()) {
     index_req_ = read_req_->mutable_index_request();
     index_req_->set_table_id(index_id_.GetYBTableId());
@@ -103,6 +115,50 @@ PgsqlExpressionPB *PgSelect::AllocIndexColumnBindPB(PgColumn *col) {
   return col->AllocBindPB(index_req_);
 }
 
+Status PgSelect::BindYbctids(int n_ybctids, PgExpr **ybctids) {
+  SCHECK(!index_id_.IsValid(), InvalidArgument, "Batched key lookup must read the base table");
+  SCHECK_GT(n_ybctids, 0, InvalidArgument, "Batched key lookup requires at least one ybctid");
+  SCHECK_LE(n_ybctids, std::max(FLAGS_ysql_max_batch_ybctids, 1), InvalidArgument,
+            "Too many ybctids in batched key lookup");
+
+  batch_ybctids_.clear();
+  batch_ybctid_positions_.clear();
+  QLValuePB value;
+  for (int i = 0; i < n_ybctids; i++) {
+    SCHECK(ybctids[i]->is_constant(), InvalidArgument, "Column ybctid must be bound to constant");
+    RETURN_NOT_OK(ybctids[i]->Eval(this, &value));
+    if (batch_ybctid_positions_.emplace(value.binary_value(), batch_ybctids_.size()).second) {
+      batch_ybctids_.push_back(value.binary_value());
+    }
+  }
+
+  ybctid_bind_ = true;
+  return Status::OK();
+}
+
+Status PgSelect::AppendQual(PgExpr *qual) {
+  SCHECK(qual->is_condition(), InvalidArgument, "Qual must be a logical condition");
+
+  // All quals are combined into one AND condition that DocDB evaluates on every scanned row.
+  PgsqlExpressionPB *where_pb = read_req_->mutable_where_expr();
+  if (!where_pb->has_condition()) {
+    where_pb->mutable_condition()->set_op(QL_OP_AND);
+  }
+  PgsqlExpressionPB *qual_pb = where_pb->mutable_condition()->add_operands();
+  RETURN_NOT_OK(qual->PrepareForRead(this, qual_pb));
+
+  // Link the qual with its protobuf so that the values of its constants are updated on execution.
+  expr_binds_[qual_pb] = qual;
+  return Status::OK();
+}
+
+Status PgSelect::AppendGroupBy(PgExpr *group_by) {
+  SCHECK(group_by->is_colref(), InvalidArgument, "Only columns can be grouped by");
+  RETURN_NOT_OK(group_by->PrepareForRead(this, read_req_->add_group_by_exprs()));
+  group_by_.push_back(group_by);
+  return Status::OK();
+}
+
 PgsqlExpressionPB *PgSelect::AllocColumnAssignPB(PgColumn *col) {
   // SELECT statement should not have an assign expression (SET clause).
   LOG(FATAL) << "Pure virtual function is being call";
@@ -229,6 +285,23 @@ Status PgSelect::Exec(const PgExecParameters *exec_params) {
   // Set execution control parameters.
   doc_op_->SetExecParams(exec_params);
 
+  // Send the ybctids of a batched key lookup. Their rows are sent back in tablet order, so each row
+  // is followed by its ybctid for pggate to restore the order of the ybctids.
+  read_req_->clear_batch_ybctids();
+  if (!batch_ybctids_.empty()) {
+    SCHECK(!has_aggregate_targets(), InvalidArgument,
+           "Aggregate pushdown is not supported with batched key lookup");
+    for (const string& ybctid : batch_ybctids_) {
+      read_req_->add_batch_ybctids(ybctid);
+    }
+    if (!has_batch_ybctid_target_) {
+      PgColumn *col = nullptr;
+      RETURN_NOT_OK(FindColumn(static_cast<int>(PgSystemAttrNum::kYBTupleId), &col));
+      AllocTargetPB()->set_column_id(col->id());
+      has_batch_ybctid_target_ = true;
+    }
+  }
+
   // Set column references in protobuf and whether query is aggregate.
   SetColumnRefIds(table_desc_, read_req_->mutable_column_refs());
   read_req_->set_is_aggregate(has_aggregate_targets());
@@ -62,6 +62,17 @@ class PgSelect : public PgDml {
   // Bind a column with an IN condition.
   CHECKED_STATUS BindColumnCondIn(int attnum, int n_attr_values, PgExpr **attr_values);
 
+  // Bind a batch of ybctids to look up. The rows are read with one request per tablet and are
+  // returned in the order of their ybctids. A ybctid that is bound more than once is read once.
+  // At most ysql_max_batch_ybctids ybctids can be bound.
+  CHECKED_STATUS BindYbctids(int n_ybctids, PgExpr **ybctids);
+
+  // Push down a qual of the WHERE clause. DocDB only returns rows for which all quals are true.
+  CHECKED_STATUS AppendQual(PgExpr *qual);
+
+  // Group the aggregate targets by a column. DocDB computes partial aggregate values per group.
+  CHECKED_STATUS AppendGroupBy(PgExpr *group_by);
+
   // Set forward (or backward) scan.
   void SetForwardScan(const bool is_forward_scan) {
     DCHECK_NOTNULL(read_req_)->set_is_forward_scan(is_forward_scan);
@@ -93,6 +104,9 @@ class PgSelect : public PgDml {
   // Load index.
   CHECKED_STATUS LoadIndex();
 
+  // Key of the read request template of this statement's relation and index.
+  std::string ReadRequestTemplateKey() const;
+
   PgObjectId index_id_;
   PgTableDesc::ScopedRefPtr index_desc_;
 
@@ -100,6 +114,9 @@ class PgSelect : public PgDml {
   std::shared_ptr<client::YBPgsqlReadOp> read_op_;
   PgsqlReadRequestPB *read_req_ = nullptr;
   PgsqlReadRequestPB *index_req_ = nullptr;
+
+  // Whether the ybctid target that follows every row of a batched key lookup has been allocated.
+  bool has_batch_ybctid_target_ = false;
 };
 
 }  // namespace pggate
@@ -13,6 +13,7 @@
 //
 //--------------------------------------------------------------------------------------------------
 
+#include <algorithm>
 #include <memory>
 
 #include "yb/util/logging.h"
@@ -36,6 +37,7 @@
 #include "yb/common/row_mark.h"
 
 #include "yb/tserver/tserver_shared_mem.h"
+#include "yb/tserver/tserver_service.proxy.h"
 
 #include "yb/util/string_util.h"
 #include "yb/util/random_util.h"
@@ -104,14 +106,20 @@ PgSession::PgSession(
     const string& database_name,
     scoped_refptr<PgTxnManager> pg_txn_manager,
     scoped_refptr<server::HybridClock> clock,
-    const tserver::TServerSharedObject* tserver_shared_object)
+    const tserver::TServerSharedObject* tserver_shared_object,
+    const tserver::YsqlCatalogCacheSharedObject* ysql_catalog_cache_object)
     : client_(client),
       session_(client_->NewSession()),
       pg_txn_manager_(std::move(pg_txn_manager)),
       clock_(std::move(clock)),
-      tserver_shared_object_(tserver_shared_object) {
+      tserver_shared_object_(tserver_shared_object),
+      ysql_catalog_cache_object_(ysql_catalog_cache_object) {
   session_->SetTimeout(MonoDelta::FromMilliseconds(FLAGS_pg_yb_session_timeout_ms));
   session_->SetForceConsistentRead(client::ForceConsistentRead::kTrue);
+  if (tserver_shared_object_ && ysql_catalog_cache_object_) {
+    tablet_server_proxy_ = std::make_unique<tserver::TabletServerServiceProxy>(
+        &client_->proxy_cache(), HostPort((**tserver_shared_object_).endpoint()));
+  }
 }
 
 PgSession::~PgSession() {
@@ -445,6 +453,14 @@ Result<PgTableDesc::ScopedRefPtr> PgSession::LoadTable(const PgObjectId& table_i
   return make_scoped_refptr<PgTableDesc>(table);
 }
 
+void PgSession::SaveReadRequestTemplate(const string& key, PgsqlReadRequestPB* request) {
+  read_request_templates_.Save(key, request, FLAGS_ysql_read_request_template_cache_size);
+}
+
+void PgSession::ReuseReadRequestTemplate(const string& key, PgsqlReadRequestPB* request) {
+  read_request_templates_.Reuse(key, request);
+}
+
 void PgSession::InvalidateTableCache(const PgObjectId& table_id) {
   const TableId yb_table_id = table_id.GetYBTableId();
   table_cache_.erase(yb_table_id);
@@ -455,6 +471,35 @@ Status PgSession::StartBufferingWriteOperations() {
   return Status::OK();
 }
 
+Status PgSession::StartBulkLoadWriteOperations() {
+  bulk_load_write_ops_ = true;
+  return StartBufferingWriteOperations();
+}
+
+Status PgSession::PrepareBulkLoadWriteOperations(PgsqlOpBuffer* write_ops) {
+  // Rows of a COPY arrive in file order. Sorting them by partition key makes every flushed chunk
+  // cover a contiguous key range, so each chunk reaches few tablets with large, sorted batches.
+  // The batches are still written through the memtable. Ingesting them as SST files does not pay
+  // off, since RocksDB refuses files that overlap existing data or are added while snapshots are
+  // held.
+  std::vector<std::pair<std::string, std::shared_ptr<client::YBPgsqlOp>>> keyed_ops;
+  keyed_ops.reserve(write_ops->size());
+  for (auto& op : *write_ops) {
+    SCHECK(op->type() == YBOperation::Type::PGSQL_WRITE, IllegalState,
+           "Only write operations can be bulk loaded");
+    string partition_key;
+    RETURN_NOT_OK(op->GetPartitionKey(&partition_key));
+    keyed_ops.emplace_back(std::move(partition_key), std::move(op));
+  }
+  std::stable_sort(keyed_ops.begin(), keyed_ops.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  write_ops->clear();
+  for (auto& keyed_op : keyed_ops) {
+    write_ops->push_back(std::move(keyed_op.second));
+  }
+  return Status::OK();
+}
+
 Status PgSession::FlushBufferedWriteOperations(PgsqlOpBuffer* write_ops, bool transactional) {
   Status final_status;
   if (!write_ops->empty()) {
@@ -523,6 +568,15 @@ Status PgSession::FlushBufferedWriteOperations() {
   }
   Status final_status;
   Status s;
+  if (bulk_load_write_ops_) {
+    bulk_load_write_ops_ = false;
+    s = PrepareBulkLoadWriteOperations(&buffered_write_ops_);
+    if (!s.ok()) {
+      buffered_write_ops_.clear();
+      buffered_txn_write_ops_.clear();
+      return s;
+    }
+  }
   s = FlushBufferedWriteOperations(&buffered_write_ops_, false /* transactional */);
   final_status = CombineStatuses(final_status, s);
   if (YBCIsInitDbModeEnvVarSet()) {
@@ -554,6 +608,14 @@ Result<PgApplyOutcome> PgSession::PgApplyAsync(
   // We allow read ops while buffering writes because it can happen when building indexes for sys
   // catalog tables during initdb. Continuing read ops to scan the table can be issued while
   // writes to its index are being buffered.
+  if (tablet_server_proxy_ && op->type() == YBOperation::Type::PGSQL_WRITE &&
+      down_cast<client::YBPgsqlWriteOp*>(op.get())->request().is_ysql_catalog_change()) {
+    // The change becomes visible to other backends with the next catalog version, and so must
+    // the entries this session reads from the shared catalog cache. Writes that don't change the
+    // version cannot change the entries the shared cache holds.
+    shared_catalog_cache_min_version_ = (**tserver_shared_object_).ysql_catalog_version() + 1;
+  }
+
   if (buffer_write_ops_ > 0 && op->type() == YBOperation::Type::PGSQL_WRITE) {
     bool use_txn = ShouldBufferTransactionally(op.get());
     if (use_txn) {
@@ -696,5 +758,45 @@ Result<uint64_t> PgSession::GetSharedCatalogVersion() {
   }
 }
 
+boost::optional<uint64_t> PgSession::GetSharedCatalogCacheVersion() {
+  if (!tablet_server_proxy_ || pg_txn_manager_->IsDdlMode()) {
+    return boost::none;
+  }
+  const uint64_t catalog_version = (**tserver_shared_object_).ysql_catalog_version();
+  if (catalog_version < shared_catalog_cache_min_version_) {
+    return boost::none;
+  }
+  return catalog_version;
+}
+
+bool PgSession::LookupSharedCatalogCache(uint64_t catalog_version, const std::string& key,
+                                         std::string* rows_data) {
+  DCHECK(ysql_catalog_cache_object_);
+  return (**ysql_catalog_cache_object_).Lookup(catalog_version, key, rows_data);
+}
+
+void PgSession::UpdateSharedCatalogCache(uint64_t catalog_version, std::string key,
+                                         std::string rows_data) {
+  DCHECK(tablet_server_proxy_);
+  struct UpdateCall {
+    tserver::UpdateYsqlCatalogCacheRequestPB req;
+    tserver::UpdateYsqlCatalogCacheResponsePB resp;
+    rpc::RpcController controller;
+  };
+  auto call = std::make_shared<UpdateCall>();
+  call->req.set_access_token((**ysql_catalog_cache_object_).access_token());
+  call->req.set_ysql_catalog_version(catalog_version);
+  call->req.set_key(std::move(key));
+  call->req.set_value(std::move(rows_data));
+  call->controller.set_timeout(MonoDelta::FromMilliseconds(FLAGS_pg_yb_session_timeout_ms));
+  // The cache is best effort, so nobody waits for the response.
+  tablet_server_proxy_->UpdateYsqlCatalogCacheAsync(
+      call->req, &call->resp, &call->controller, [call] {
+        if (!call->controller.status().ok()) {
+          VLOG(1) << "Failed to update shared catalog cache: " << call->controller.status();
+        }
+      });
+}
+
 }  // namespace pggate
 }  // namespace yb
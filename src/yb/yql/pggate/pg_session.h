@@ -33,8 +33,15 @@
 #include "yb/yql/pggate/pg_env.h"
 #include "yb/yql/pggate/pg_column.h"
 #include "yb/yql/pggate/pg_tabledesc.h"
+#include "yb/yql/pggate/util/pg_read_request_templates.h"
 
 namespace yb {
+namespace tserver {
+
+class TabletServerServiceProxy;
+
+}  // namespace tserver
+
 namespace pggate {
 
 YB_STRONGLY_TYPED_BOOL(OpBuffered);
@@ -61,7 +68,8 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
             const string& database_name,
             scoped_refptr<PgTxnManager> pg_txn_manager,
             scoped_refptr<server::HybridClock> clock,
-            const tserver::TServerSharedObject* tserver_shared_object);
+            const tserver::TServerSharedObject* tserver_shared_object,
+            const tserver::YsqlCatalogCacheSharedObject* ysql_catalog_cache_object);
   virtual ~PgSession();
 
   //------------------------------------------------------------------------------------------------
@@ -141,6 +149,10 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
   CHECKED_STATUS StartBufferingWriteOperations();
   CHECKED_STATUS FlushBufferedWriteOperations();
 
+  // Buffer write operations of a non-transactional bulk load (COPY FROM). Buffered rows are
+  // sorted by partition key before they are flushed.
+  CHECKED_STATUS StartBulkLoadWriteOperations();
+
   // Apply the given operation to read and write database content. If the operation is a write
   // op, return true if the operation is buffered and should not be flushed except in bulk
   // by FlushBufferedWriteOperations(). False otherwise.
@@ -190,8 +202,14 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
 
   void InvalidateCache() {
     table_cache_.clear();
+    read_request_templates_.Clear();
   }
 
+  // Read request templates. A finished SELECT leaves its request protobuf behind, keyed by the
+  // relation it read, and the next SELECT on that relation rebuilds its request in the same memory.
+  void SaveReadRequestTemplate(const std::string& key, PgsqlReadRequestPB* request);
+  void ReuseReadRequestTemplate(const std::string& key, PgsqlReadRequestPB* request);
+
   // Check if initdb has already been run before. Needed to make initdb idempotent.
   Result<bool> IsInitDbDone();
 
@@ -199,6 +217,17 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
   // the shared memory has not been initialized (e.g. in initdb).
   Result<uint64_t> GetSharedCatalogVersion();
 
+  // Returns the catalog version at which catalog reads may use the catalog cache shared through
+  // the local tserver, or none if they must go to the master.
+  boost::optional<uint64_t> GetSharedCatalogCacheVersion();
+
+  // Looks up the rows cached for a catalog read in the shared catalog cache.
+  bool LookupSharedCatalogCache(uint64_t catalog_version, const std::string& key,
+                                std::string* rows_data);
+
+  // Asynchronously publishes the rows of a catalog read to the shared catalog cache.
+  void UpdateSharedCatalogCache(uint64_t catalog_version, std::string key, std::string rows_data);
+
  private:
   // Returns the appropriate session to use, in most cases the one used by the current transaction.
   // read_only_op - whether this is being done in the context of a read-only operation. For
@@ -225,6 +254,9 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
   // Flush buffered write operations from the given buffer.
   Status FlushBufferedWriteOperations(PgsqlOpBuffer* write_ops, bool transactional);
 
+  // Sort the given non-transactional buffer by partition key.
+  CHECKED_STATUS PrepareBulkLoadWriteOperations(PgsqlOpBuffer* write_ops);
+
   // Whether we should buffer and execute the given operation transactionally.
   bool ShouldBufferTransactionally(client::YBPgsqlOp* op);
 
@@ -251,15 +283,29 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
 
   std::unordered_map<TableId, std::shared_ptr<client::YBTable>> table_cache_;
 
+  PgReadRequestTemplates read_request_templates_;
+
   // Should write operations be buffered?
   uint buffer_write_ops_ = 0;
   PgsqlOpBuffer buffered_write_ops_;
   PgsqlOpBuffer buffered_txn_write_ops_;
 
+  // Are the buffered non-transactional write operations part of a bulk load?
+  bool bulk_load_write_ops_ = false;
+
   // True if the read request has a row mark.
   bool has_row_mark_ = false;
 
+  // Proxy to the local tserver, used to publish entries to the shared catalog cache.
+  std::unique_ptr<tserver::TabletServerServiceProxy> tablet_server_proxy_;
+
+  // This session changed the catalog, so its own catalog reads must not use the shared catalog
+  // cache until the catalog version reaches this value.
+  uint64_t shared_catalog_cache_min_version_ = 0;
+
   const tserver::TServerSharedObject* const tserver_shared_object_;
+
+  const tserver::YsqlCatalogCacheSharedObject* const ysql_catalog_cache_object_;
 };
 
 }  // namespace pggate
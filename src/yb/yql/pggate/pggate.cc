@@ -85,6 +85,17 @@ std::unique_ptr<tserver::TServerSharedObject> InitTServerSharedObject() {
       tserver::TServerSharedObject::OpenReadOnly(FLAGS_pggate_tserver_shm_fd)));
 }
 
+std::unique_ptr<tserver::YsqlCatalogCacheSharedObject> InitYsqlCatalogCacheSharedObject() {
+  // The tserver only allocates the cache when the shared catalog cache is enabled.
+  if (YBCIsInitDbModeEnvVarSet() || FLAGS_pggate_ignore_tserver_shm ||
+      !FLAGS_ysql_enable_shared_catalog_cache || FLAGS_pggate_ysql_catalog_cache_shm_fd == -1) {
+    return nullptr;
+  }
+  return std::make_unique<tserver::YsqlCatalogCacheSharedObject>(CHECK_RESULT(
+      tserver::YsqlCatalogCacheSharedObject::OpenReadOnly(
+          FLAGS_pggate_ysql_catalog_cache_shm_fd)));
+}
+
 } // namespace
 
 using std::make_shared;
@@ -136,6 +147,7 @@ PgApiImpl::PgApiImpl(const YBCPgTypeEntity *YBCDataTypeArray, int count)
                          messenger_holder_.messenger.get()),
       clock_(new server::HybridClock()),
       tserver_shared_object_(InitTServerSharedObject()),
+      ysql_catalog_cache_object_(InitYsqlCatalogCacheSharedObject()),
       pg_txn_manager_(new PgTxnManager(&async_client_init_, clock_, tserver_shared_object_.get())) {
   CHECK_OK(clock_->Init());
 
@@ -178,7 +190,8 @@ Status PgApiImpl::InitSession(const PgEnv *pg_env,
                               const string& database_name) {
   CHECK(!pg_session_);
   auto session = make_scoped_refptr<PgSession>(
-      client(), database_name, pg_txn_manager_, clock_, tserver_shared_object_.get());
+      client(), database_name, pg_txn_manager_, clock_, tserver_shared_object_.get(),
+      ysql_catalog_cache_object_.get());
   if (!database_name.empty()) {
     RETURN_NOT_OK(session->ConnectDatabase(database_name));
   }
@@ -644,6 +657,30 @@ Status PgApiImpl::DmlBindColumnCondIn(PgStatement *handle, int attr_num, int n_a
   return down_cast<PgSelect*>(handle)->BindColumnCondIn(attr_num, n_attr_values, attr_values);
 }
 
+Status PgApiImpl::DmlBindYbctids(PgStatement *handle, int n_ybctids, PgExpr **ybctids) {
+  if (!PgStatement::IsValidStmt(handle, StmtOp::STMT_SELECT)) {
+    // Invalid handle.
+    return STATUS(InvalidArgument, "Invalid statement handle");
+  }
+  return down_cast<PgSelect*>(handle)->BindYbctids(n_ybctids, ybctids);
+}
+
+Status PgApiImpl::DmlAppendQual(PgStatement *handle, PgExpr *qual) {
+  if (!PgStatement::IsValidStmt(handle, StmtOp::STMT_SELECT)) {
+    // Invalid handle.
+    return STATUS(InvalidArgument, "Invalid statement handle");
+  }
+  return down_cast<PgSelect*>(handle)->AppendQual(qual);
+}
+
+Status PgApiImpl::DmlAppendGroupBy(PgStatement *handle, PgExpr *group_by) {
+  if (!PgStatement::IsValidStmt(handle, StmtOp::STMT_SELECT)) {
+    // Invalid handle.
+    return STATUS(InvalidArgument, "Invalid statement handle");
+  }
+  return down_cast<PgSelect*>(handle)->AppendGroupBy(group_by);
+}
+
 Status PgApiImpl::DmlBindIndexColumn(PgStatement *handle, int attr_num, PgExpr *attr_value) {
   if (!PgStatement::IsValidStmt(handle, StmtOp::STMT_SELECT)) {
     // Invalid handle.
@@ -677,6 +714,10 @@ Status PgApiImpl::FlushBufferedWriteOperations() {
   return pg_session_->FlushBufferedWriteOperations();
 }
 
+Status PgApiImpl::StartBulkLoadWriteOperations() {
+  return pg_session_->StartBulkLoadWriteOperations();
+}
+
 Status PgApiImpl::DmlExecWriteOp(PgStatement *handle, int32_t *rows_affected_count) {
   switch (handle->stmt_op()) {
     case StmtOp::STMT_INSERT:
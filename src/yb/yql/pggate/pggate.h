@@ -278,6 +278,15 @@ class PgApiImpl {
   CHECKED_STATUS DmlBindColumnCondIn(YBCPgStatement handle, int attr_num, int n_attr_values,
       YBCPgExpr *attr_value);
 
+  // API for batched key lookup by ybctids.
+  CHECKED_STATUS DmlBindYbctids(PgStatement *handle, int n_ybctids, PgExpr **ybctids);
+
+  // API for pushing down WHERE clause quals of a SELECT.
+  CHECKED_STATUS DmlAppendQual(PgStatement *handle, PgExpr *qual);
+
+  // API for pushing down the GROUP BY columns of an aggregate SELECT.
+  CHECKED_STATUS DmlAppendGroupBy(PgStatement *handle, PgExpr *group_by);
+
   // API for SET clause.
   CHECKED_STATUS DmlAssignColumn(YBCPgStatement handle, int attr_num, YBCPgExpr attr_value);
 
@@ -311,6 +320,7 @@ class PgApiImpl {
   // Buffer write operations.
   CHECKED_STATUS StartBufferingWriteOperations();
   CHECKED_STATUS FlushBufferedWriteOperations();
+  CHECKED_STATUS StartBulkLoadWriteOperations();
 
   //------------------------------------------------------------------------------------------------
   // Insert.
@@ -413,6 +423,9 @@ class PgApiImpl {
   // Local tablet-server shared memory segment handle.
   std::unique_ptr<tserver::TServerSharedObject> tserver_shared_object_;
 
+  // Local tablet-server shared YSQL catalog cache, null if the cache is disabled.
+  std::unique_ptr<tserver::YsqlCatalogCacheSharedObject> ysql_catalog_cache_object_;
+
   scoped_refptr<PgTxnManager> pg_txn_manager_;
 
   // Mapping table of YugaByte and PostgreSQL datatypes.
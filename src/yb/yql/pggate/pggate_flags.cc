@@ -42,6 +42,9 @@ DEFINE_string(pggate_master_addresses, "",
 DEFINE_int32(pggate_tserver_shm_fd, -1,
               "File descriptor of the local tablet server's shared memory.");
 
+DEFINE_int32(pggate_ysql_catalog_cache_shm_fd, -1,
+              "File descriptor of the local tablet server's shared YSQL catalog cache.");
+
 DEFINE_test_flag(bool, pggate_ignore_tserver_shm, false,
               "Ignore the shared memory of the local tablet server.");
 
@@ -55,6 +58,15 @@ DEFINE_int32(ysql_session_max_batch_size, 512,
              "Maximum batch size for buffered writes between PostgreSQL server and YugaByte DocDB "
              "services");
 
+DEFINE_int32(ysql_read_request_template_cache_size, 256,
+             "Maximum number of read requests of finished SELECT statements that a session keeps "
+             "to build the requests of later SELECT statements on the same relation in already "
+             "allocated protobuf memory. Zero disables the cache.");
+
+DEFINE_int32(ysql_max_batch_ybctids, 128,
+             "Maximum number of base table rows that a secondary index scan looks up by ybctid in "
+             "one batched read. Values of 1 or less look the rows up one at a time.");
+
 DEFINE_bool(ysql_non_txn_copy, false,
             "Execute COPY inserts non-transactionally.");
 
@@ -87,6 +99,11 @@ DEFINE_bool(ysql_enable_manual_sys_table_txn_ctl, false,
             "Enable manual transaction control for YSQL system tables. Mostly needed for testing. "
             "This flag should go away once full transactional DDL is implemented.");
 
+DEFINE_bool(ysql_enable_shared_catalog_cache, false,
+            "Whether postgres backends look up catalog reads in the catalog cache that the local "
+            "tserver keeps in shared memory, and publish the results of missed reads to it. "
+            "The tserver only allocates the cache when this flag is set.");
+
 DEFINE_bool(ysql_serializable_isolation_for_ddl_txn, false,
             "Whether to use serializable isolation for separate DDL-only transactions. "
             "By default, repeatable read isolation is used. "
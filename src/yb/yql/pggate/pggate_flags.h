@@ -22,10 +22,13 @@ DECLARE_int32(pggate_ybclient_reactor_threads);
 DECLARE_string(pggate_proxy_bind_address);
 DECLARE_string(pggate_master_addresses);
 DECLARE_int32(pggate_tserver_shm_fd);
+DECLARE_int32(pggate_ysql_catalog_cache_shm_fd);
 DECLARE_bool(pggate_ignore_tserver_shm);
 DECLARE_int32(ysql_prefetch_limit);
 DECLARE_double(ysql_backward_prefetch_scale_factor);
 DECLARE_int32(ysql_session_max_batch_size);
+DECLARE_int32(ysql_read_request_template_cache_size);
+DECLARE_int32(ysql_max_batch_ybctids);
 DECLARE_bool(ysql_non_txn_copy);
 DECLARE_int32(ysql_max_read_restart_attempts);
 DECLARE_int32(ysql_output_buffer_size);
@@ -37,5 +40,6 @@ DECLARE_bool(ysql_beta_feature_roles);
 DECLARE_bool(ysql_beta_feature_extension);
 DECLARE_bool(ysql_enable_manual_sys_table_txn_ctl);
 DECLARE_bool(ysql_serializable_isolation_for_ddl_txn);
+DECLARE_bool(ysql_enable_shared_catalog_cache);
 
 #endif  // YB_YQL_PGGATE_PGGATE_FLAGS_H
@@ -119,6 +119,9 @@ YBCStatus YBCTestNewConstantFloat8(YBCPgStatement stmt, double value, bool is_nu
 YBCStatus YBCTestNewConstantText(YBCPgStatement stmt, const char *value, bool is_null,
                                  YBCPgExpr *expr_handle);
 
+// Condition expressions.
+YBCStatus YBCTestNewCondition(YBCPgStatement stmt, const char *opname, YBCPgExpr *expr_handle);
+
 }  // namespace pggate
 }  // namespace yb
 
@@ -0,0 +1,89 @@
+//--------------------------------------------------------------------------------------------------
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <string>
+
+#include "yb/tserver/tserver.pb.h"
+#include "yb/util/test_util.h"
+#include "yb/yql/pggate/util/pg_read_request_templates.h"
+
+namespace yb {
+namespace pggate {
+
+class PggateTestReadRequestTemplates : public YBTest {
+};
+
+TEST_F(PggateTestReadRequestTemplates, TestReuse) {
+  const std::string kKey = "table";
+  PgReadRequestTemplates templates;
+
+  // Build a request like a SELECT with three targets and a bound hash column.
+  PgsqlReadRequestPB request;
+  request.set_table_id(kKey);
+  for (int i = 0; i < 3; i++) {
+    request.add_targets()->set_column_id(i);
+  }
+  request.add_partition_column_values()->mutable_value()->set_int64_value(1);
+  const PgsqlExpressionPB* target = &request.targets(0);
+  const PgsqlExpressionPB* bind = &request.partition_column_values(0);
+
+  // The client swaps the request into the RPC while it is sent and swaps it back with the response,
+  // so the statement still holds its memory when it is done.
+  tserver::ReadRequestPB rpc_request;
+  rpc_request.add_pgsql_batch()->Swap(&request);
+  ASSERT_EQ(request.targets_size(), 0);
+  request.Swap(rpc_request.mutable_pgsql_batch(0));
+  ASSERT_EQ(&request.targets(0), target);
+
+  templates.Save(kKey, &request, 1 /* max_templates */);
+  ASSERT_EQ(templates.size(), 1);
+
+  // No more requests are kept once the limit is reached.
+  PgsqlReadRequestPB other_request;
+  other_request.add_targets()->set_column_id(0);
+  templates.Save(kKey, &other_request, 1 /* max_templates */);
+  ASSERT_EQ(templates.size(), 1);
+  ASSERT_EQ(other_request.targets_size(), 1);
+
+  // Unusually large requests are not kept.
+  PgsqlReadRequestPB large_request;
+  large_request.set_table_id(std::string(PgReadRequestTemplates::kMaxTemplateSize + 1, 'x'));
+  templates.Save(kKey, &large_request, 2 /* max_templates */);
+  ASSERT_EQ(templates.size(), 1);
+
+  // A new request of another relation gets no template.
+  PgsqlReadRequestPB new_request;
+  new_request.set_table_id(kKey);
+  new_request.set_schema_version(2);
+  ASSERT_FALSE(templates.Reuse("other_table", &new_request));
+
+  // A new request of the same relation starts empty, keeps its own header fields, and is rebuilt
+  // in the protobuf objects of the saved request.
+  ASSERT_TRUE(templates.Reuse(kKey, &new_request));
+  ASSERT_EQ(templates.size(), 0);
+  ASSERT_EQ(new_request.targets_size(), 0);
+  ASSERT_EQ(new_request.partition_column_values_size(), 0);
+  ASSERT_EQ(new_request.table_id(), kKey);
+  ASSERT_EQ(new_request.schema_version(), 2);
+  ASSERT_EQ(new_request.add_targets(), target);
+  ASSERT_EQ(new_request.add_partition_column_values(), bind);
+
+  // The template was handed out once.
+  PgsqlReadRequestPB another_request;
+  ASSERT_FALSE(templates.Reuse(kKey, &another_request));
+}
+
+} // namespace pggate
+} // namespace yb
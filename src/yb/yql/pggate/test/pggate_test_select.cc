@@ -258,6 +258,72 @@ TEST_F(PggateTestSelect, TestSelectOneTablet) {
 
   CHECK_YBC_STATUS(YBCPgDeleteStatement(pg_stmt));
   pg_stmt = nullptr;
+
+  // SELECT ----------------------------------------------------------------------------------------
+  LOG(INFO) << "Test SELECTing from non-partitioned table with pushed down WHERE quals";
+  CHECK_YBC_STATUS(YBCPgNewSelect(kDefaultDatabaseOid, tab_oid, kInvalidOid, &pg_stmt));
+
+  // Specify the selected expressions.
+  YBCTestNewColumnRef(pg_stmt, 2, DataType::INT32, &colref);
+  CHECK_YBC_STATUS(YBCPgDmlAppendTarget(pg_stmt, colref));
+  YBCTestNewColumnRef(pg_stmt, 6, DataType::STRING, &colref);
+  CHECK_YBC_STATUS(YBCPgDmlAppendTarget(pg_stmt, colref));
+
+  // Set partition column for SELECT.
+  CHECK_YBC_STATUS(YBCTestNewConstantInt8(pg_stmt, 0, false, &expr_hash));
+  CHECK_YBC_STATUS(YBCPgDmlBindColumn(pg_stmt, 1, expr_hash));
+
+  // SELECT ... WHERE id > 2 AND
+  //                  (job IN ('Job_title_3', 'Job_title_5', 'None') OR dependent_count IS NULL).
+  YBCPgExpr qual;
+  YBCPgExpr expr_value;
+  CHECK_YBC_STATUS(YBCTestNewCondition(pg_stmt, ">", &qual));
+  YBCTestNewColumnRef(pg_stmt, 2, DataType::INT32, &colref);
+  CHECK_YBC_STATUS(YBCPgOperatorAppendArg(qual, colref));
+  CHECK_YBC_STATUS(YBCTestNewConstantInt4(pg_stmt, 2, false, &expr_value));
+  CHECK_YBC_STATUS(YBCPgOperatorAppendArg(qual, expr_value));
+  CHECK_YBC_STATUS(YBCPgDmlAppendQual(pg_stmt, qual));
+
+  YBCPgExpr in_qual;
+  CHECK_YBC_STATUS(YBCTestNewCondition(pg_stmt, "in", &in_qual));
+  YBCTestNewColumnRef(pg_stmt, 6, DataType::STRING, &colref);
+  CHECK_YBC_STATUS(YBCPgOperatorAppendArg(in_qual, colref));
+  for (const char *job_name : { "Job_title_3", "Job_title_5", "None" }) {
+    CHECK_YBC_STATUS(YBCTestNewConstantText(pg_stmt, job_name, false, &expr_value));
+    CHECK_YBC_STATUS(YBCPgOperatorAppendArg(in_qual, expr_value));
+  }
+  YBCPgExpr null_qual;
+  CHECK_YBC_STATUS(YBCTestNewCondition(pg_stmt, "is_null", &null_qual));
+  YBCTestNewColumnRef(pg_stmt, 3, DataType::INT16, &colref);
+  CHECK_YBC_STATUS(YBCPgOperatorAppendArg(null_qual, colref));
+  CHECK_YBC_STATUS(YBCTestNewCondition(pg_stmt, "or", &qual));
+  CHECK_YBC_STATUS(YBCPgOperatorAppendArg(qual, in_qual));
+  CHECK_YBC_STATUS(YBCPgOperatorAppendArg(qual, null_qual));
+  CHECK_YBC_STATUS(YBCPgDmlAppendQual(pg_stmt, qual));
+
+  // Execute select statement.
+  YBCPgExecSelect(pg_stmt, nullptr /* exec_params */);
+
+  // Fetching rows and check that only the matching ones are returned.
+  std::vector<int32_t> selected_ids;
+  while (true) {
+    bool has_data = false;
+    YBCPgDmlFetch(pg_stmt, col_count, values, isnulls, &syscols, &has_data);
+    if (!has_data) {
+      break;
+    }
+
+    int32_t id = values[0];
+    string selected_job_name = reinterpret_cast<char*>(values[1]);
+    CHECK_EQ(selected_job_name, strings::Substitute("Job_title_$0", id));
+    selected_ids.push_back(id);
+  }
+  CHECK_EQ(selected_ids.size(), 2U) << "Unexpected row count";
+  CHECK_EQ(selected_ids[0], 3);
+  CHECK_EQ(selected_ids[1], 5);
+
+  CHECK_YBC_STATUS(YBCPgDeleteStatement(pg_stmt));
+  pg_stmt = nullptr;
 }
 
 } // namespace pggate
@@ -13,8 +13,14 @@
 //
 //--------------------------------------------------------------------------------------------------
 
+#include <set>
+#include <vector>
+
 #include "yb/yql/pggate/test/pggate_test.h"
 #include "yb/common/ybc-internal.h"
+#include "yb/yql/pggate/pggate_flags.h"
+
+extern "C" void YBCAssignSelectParallelism(int newval, void* extra);
 
 namespace yb {
 namespace pggate {
@@ -267,6 +273,129 @@ TEST_F(PggateTestSelectMultiTablets, TestSelectMultiTablets) {
 
   CHECK_YBC_STATUS(YBCPgDeleteStatement(pg_stmt));
   pg_stmt = nullptr;
+
+  // SELECT ----------------------------------------------------------------------------------------
+  LOG(INFO) << "Test SELECTing from partitioned table with parallel sub-scans";
+  YBCAssignSelectParallelism(4, nullptr /* extra */);
+  CHECK_YBC_STATUS(YBCPgNewSelect(kDefaultDatabaseOid, tab_oid, kInvalidOid, &pg_stmt));
+
+  // Specify the selected expressions.
+  YBCTestNewColumnRef(pg_stmt, 1, DataType::INT64, &colref);
+  CHECK_YBC_STATUS(YBCPgDmlAppendTarget(pg_stmt, colref));
+  YBCTestNewColumnRef(pg_stmt, 2, DataType::INT32, &colref);
+  CHECK_YBC_STATUS(YBCPgDmlAppendTarget(pg_stmt, colref));
+
+  // Execute select statement.
+  YBCPgExecSelect(pg_stmt, nullptr /* exec_params */);
+
+  // Every row must be fetched exactly once, in any order.
+  std::set<uint64_t> selected_ids;
+  while (true) {
+    bool has_data = false;
+    YBCPgDmlFetch(pg_stmt, col_count, values, isnulls, nullptr, &has_data);
+    if (!has_data) {
+      break;
+    }
+    CHECK(selected_ids.insert(values[0]).second) << "Row fetched twice: " << values[0];
+    CHECK_EQ(values[1], values[0]);
+  }
+  CHECK_EQ(selected_ids.size(), static_cast<size_t>(insert_row_count))
+      << "Not all inserted rows are fetched";
+
+  CHECK_YBC_STATUS(YBCPgDeleteStatement(pg_stmt));
+  pg_stmt = nullptr;
+  YBCAssignSelectParallelism(1, nullptr /* extra */);
+
+  // SELECT ----------------------------------------------------------------------------------------
+  LOG(INFO) << "Test SELECTing GROUP BY aggregate from partitioned table";
+  CHECK_YBC_STATUS(YBCPgNewSelect(kDefaultDatabaseOid, tab_oid, kInvalidOid, &pg_stmt));
+
+  // SELECT dependent_count, count(id) ... GROUP BY dependent_count.
+  YBCPgExpr count_op;
+  CHECK_YBC_STATUS(YBCPgNewOperator(pg_stmt, "count", YBCPgFindTypeEntity(INT8OID), &count_op));
+  YBCTestNewColumnRef(pg_stmt, 2, DataType::INT32, &colref);
+  CHECK_YBC_STATUS(YBCPgOperatorAppendArg(count_op, colref));
+  CHECK_YBC_STATUS(YBCPgDmlAppendTarget(pg_stmt, count_op));
+  YBCTestNewColumnRef(pg_stmt, 3, DataType::INT16, &colref);
+  CHECK_YBC_STATUS(YBCPgDmlAppendGroupBy(pg_stmt, colref));
+
+  // Execute select statement.
+  YBCPgExecSelect(pg_stmt, nullptr /* exec_params */);
+
+  // The group-by column is fetched at its attribute position and the count follows the table
+  // columns. Every group must be fetched exactly once.
+  const int group_natts = col_count + 1;
+  values = static_cast<uint64_t*>(YBCPAlloc(group_natts * sizeof(uint64_t)));
+  isnulls = static_cast<bool*>(YBCPAlloc(group_natts * sizeof(bool)));
+  std::set<uint64_t> selected_groups;
+  while (true) {
+    bool has_data = false;
+    YBCPgDmlFetch(pg_stmt, group_natts, values, isnulls, nullptr, &has_data);
+    if (!has_data) {
+      break;
+    }
+    CHECK(selected_groups.insert(values[2]).second) << "Group fetched twice: " << values[2];
+    CHECK_EQ(values[col_count], 1) << "Unexpected count for group " << values[2];
+  }
+  CHECK_EQ(selected_groups.size(), static_cast<size_t>(insert_row_count))
+      << "Not all groups are fetched";
+
+  CHECK_YBC_STATUS(YBCPgDeleteStatement(pg_stmt));
+  pg_stmt = nullptr;
+
+  // SELECT ----------------------------------------------------------------------------------------
+  LOG(INFO) << "Test SELECTing a batch of rows by ybctid from partitioned table";
+  CHECK_YBC_STATUS(YBCPgNewSelect(kDefaultDatabaseOid, tab_oid, kInvalidOid, &pg_stmt));
+
+  // Specify the selected expressions.
+  YBCTestNewColumnRef(pg_stmt, 1, DataType::INT64, &colref);
+  CHECK_YBC_STATUS(YBCPgDmlAppendTarget(pg_stmt, colref));
+  YBCTestNewColumnRef(pg_stmt, 2, DataType::INT32, &colref);
+  CHECK_YBC_STATUS(YBCPgDmlAppendTarget(pg_stmt, colref));
+
+  // Look up the rows of the given seeds. Seed 9 has no row and seed 2 is looked up twice.
+  const std::vector<int> lookup_seeds = { 5, 2, 9, 7, 2, 1 };
+  std::vector<YBCPgExpr> ybctids;
+  for (int lookup_seed : lookup_seeds) {
+    YBCPgAttrValueDescriptor attrs[] = {
+      { 1, static_cast<uint64_t>(lookup_seed), false, YBCPgFindTypeEntity(INT8OID) },
+      { 2, static_cast<uint64_t>(lookup_seed), false, YBCPgFindTypeEntity(INT4OID) },
+    };
+    uint64_t ybctid = 0;
+    CHECK_YBC_STATUS(YBCPgDmlBuildYBTupleId(pg_stmt, attrs, 2, &ybctid));
+    YBCPgExpr expr_ybctid;
+    CHECK_YBC_STATUS(YBCPgNewConstant(pg_stmt, YBCPgFindTypeEntity(BYTEAOID), ybctid,
+                                      false /* is_null */, &expr_ybctid));
+    ybctids.push_back(expr_ybctid);
+  }
+
+  // A batch larger than ysql_max_batch_ybctids is rejected.
+  FLAGS_ysql_max_batch_ybctids = static_cast<int32_t>(lookup_seeds.size()) - 1;
+  YBCStatus status = YBCPgDmlBindYbctids(pg_stmt, ybctids.size(), ybctids.data());
+  CHECK(status != nullptr) << "Batch above ysql_max_batch_ybctids must be rejected";
+  YBCFreeStatus(status);
+  FLAGS_ysql_max_batch_ybctids = static_cast<int32_t>(lookup_seeds.size());
+  CHECK_YBC_STATUS(YBCPgDmlBindYbctids(pg_stmt, ybctids.size(), ybctids.data()));
+
+  // Execute select statement.
+  YBCPgExecSelect(pg_stmt, nullptr /* exec_params */);
+
+  // The rows must be fetched once each in the order of their first lookup.
+  const std::vector<uint64_t> expected_ids = { 5, 2, 7, 1 };
+  std::vector<uint64_t> batch_ids;
+  while (true) {
+    bool has_data = false;
+    YBCPgDmlFetch(pg_stmt, col_count, values, isnulls, nullptr, &has_data);
+    if (!has_data) {
+      break;
+    }
+    CHECK_EQ(values[1], values[0]);
+    batch_ids.push_back(values[0]);
+  }
+  CHECK(batch_ids == expected_ids) << "Unexpected rows from batched lookup";
+
+  CHECK_YBC_STATUS(YBCPgDeleteStatement(pg_stmt));
+  pg_stmt = nullptr;
 }
 
 } // namespace pggate
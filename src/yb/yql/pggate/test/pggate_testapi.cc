@@ -157,5 +157,11 @@ YBCStatus YBCTestNewConstantText(YBCPgStatement stmt, const char *value, bool is
   return YBCPgNewConstant(stmt, type_entity, datum, is_null, expr_handle);
 }
 
+//--------------------------------------------------------------------------------------------------
+
+YBCStatus YBCTestNewCondition(YBCPgStatement stmt, const char *opname, YBCPgExpr *expr_handle) {
+  return YBCPgNewOperator(stmt, opname, YBCPgFindTypeEntity(BOOLOID), expr_handle);
+}
+
 } // namespace pggate
 } // namespace yb
@@ -122,6 +122,22 @@ Datum YBCTestFloat8ToDatum(const void *void_data, int64 bytes, const YBCPgTypeAt
   return YBCTestInt64ToDatum(void_data, 0, nullptr);
 }
 
+/*
+ * BYTEA conversion. The datum points to the data size followed by the data.
+ */
+void YBCTestDatumToBinary(Datum datum, void *void_data, int64 *bytes) {
+  const int64 *size = reinterpret_cast<const int64*>(datum);
+  *reinterpret_cast<const uint8_t**>(void_data) = reinterpret_cast<const uint8_t*>(size + 1);
+  *bytes = *size;
+}
+
+Datum YBCTestBinaryToDatum(const void *void_data, int64 bytes, const YBCPgTypeAttrs *type_attrs) {
+  int64 *size = static_cast<int64*>(PggateTestAlloc(sizeof(int64) + bytes));
+  *size = bytes;
+  memcpy(size + 1, void_data, bytes);
+  return reinterpret_cast<Datum>(size);
+}
+
 /***************************************************************************************************
  * Conversion Table
  **************************************************************************************************/
@@ -157,6 +173,10 @@ static const YBCPgTypeEntity YBCTestTypeEntityTable[] = {
   { FLOAT8OID, YB_YQL_DATA_TYPE_DOUBLE, true, 8,
     (YBCPgDatumToData)YBCTestDatumToFloat8,
     (YBCPgDatumFromData)YBCTestFloat8ToDatum },
+
+  { BYTEAOID, YB_YQL_DATA_TYPE_BINARY, true, -1,
+    (YBCPgDatumToData)YBCTestDatumToBinary,
+    (YBCPgDatumFromData)YBCTestBinaryToDatum },
 };
 
 void YBCTestGetTypeTable(const YBCPgTypeEntity **type_table, int *count) {
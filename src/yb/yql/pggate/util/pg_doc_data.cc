@@ -151,5 +151,95 @@ PgWireDataHeader PgDocData::ReadDataHeader(Slice *cursor) {
   return PgWireDataHeader(header_data);
 }
 
+Status PgDocData::ReadColumn(Slice *cursor, InternalType type, QLValue *col_value) {
+  const PgWireDataHeader header = ReadDataHeader(cursor);
+  if (header.is_null()) {
+    col_value->SetNull();
+    return Status::OK();
+  }
+
+  switch (type) {
+    case InternalType::kBoolValue: {
+      bool value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_bool_value(value);
+      break;
+    }
+    case InternalType::kInt8Value: {
+      int8 value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_int8_value(value);
+      break;
+    }
+    case InternalType::kInt16Value: {
+      int16 value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_int16_value(value);
+      break;
+    }
+    case InternalType::kInt32Value: {
+      int32 value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_int32_value(value);
+      break;
+    }
+    case InternalType::kInt64Value: {
+      int64 value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_int64_value(value);
+      break;
+    }
+    case InternalType::kUint32Value: {
+      uint32 value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_uint32_value(value);
+      break;
+    }
+    case InternalType::kUint64Value: {
+      uint64 value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_uint64_value(value);
+      break;
+    }
+    case InternalType::kFloatValue: {
+      float value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_float_value(value);
+      break;
+    }
+    case InternalType::kDoubleValue: {
+      double value;
+      cursor->remove_prefix(ReadNumber(cursor, &value));
+      col_value->set_double_value(value);
+      break;
+    }
+    case InternalType::kStringValue: FALLTHROUGH_INTENDED;
+    case InternalType::kDecimalValue: {
+      // Text is written with its null terminator.
+      int64_t data_size;
+      cursor->remove_prefix(ReadNumber(cursor, &data_size));
+      SCHECK_GT(data_size, 0, Corruption, "Text value is missing its null terminator");
+      string value(cursor->cdata(), data_size - 1);
+      if (type == InternalType::kStringValue) {
+        col_value->set_string_value(std::move(value));
+      } else {
+        col_value->set_decimal_value(std::move(value));
+      }
+      cursor->remove_prefix(data_size);
+      break;
+    }
+    case InternalType::kBinaryValue: {
+      int64_t data_size;
+      cursor->remove_prefix(ReadNumber(cursor, &data_size));
+      col_value->set_binary_value(cursor->data(), data_size);
+      cursor->remove_prefix(data_size);
+      break;
+    }
+    default:
+      return STATUS_FORMAT(NotSupported, "Unexpected data type $0 to read from database", type);
+  }
+  return Status::OK();
+}
+
 }  // namespace pggate
 }  // namespace yb
@@ -32,6 +32,9 @@ class PgDocData : public PgWire {
   static CHECKED_STATUS LoadCache(const string& data, int64_t *total_row_count, Slice *cursor);
 
   static PgWireDataHeader ReadDataHeader(Slice *cursor);
+
+  // Read a column value that was written by WriteColumn() given the internal type of the value.
+  static CHECKED_STATUS ReadColumn(Slice *cursor, InternalType type, QLValue *col_value);
 };
 
 }  // namespace pggate
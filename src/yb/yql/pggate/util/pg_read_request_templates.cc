@@ -0,0 +1,57 @@
+//--------------------------------------------------------------------------------------------------
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//--------------------------------------------------------------------------------------------------
+
+#include "yb/yql/pggate/util/pg_read_request_templates.h"
+
+namespace yb {
+namespace pggate {
+
+constexpr size_t PgReadRequestTemplates::kMaxTemplateSize;
+
+void PgReadRequestTemplates::Save(const std::string& key, PgsqlReadRequestPB* request,
+                                  int max_templates) {
+  if (num_templates_ >= max_templates || request->SpaceUsedLong() > kMaxTemplateSize) {
+    return;
+  }
+  auto saved = std::make_unique<PgsqlReadRequestPB>();
+  saved->Swap(request);
+  templates_[key].push_back(std::move(saved));
+  num_templates_++;
+}
+
+bool PgReadRequestTemplates::Reuse(const std::string& key, PgsqlReadRequestPB* request) {
+  auto it = templates_.find(key);
+  if (it == templates_.end() || it->second.empty()) {
+    return false;
+  }
+  std::unique_ptr<PgsqlReadRequestPB> saved = std::move(it->second.back());
+  it->second.pop_back();
+  num_templates_--;
+
+  // Keep the header fields of the new request and swap in the memory of the saved one.
+  saved->Clear();
+  saved->set_client(request->client());
+  saved->set_table_id(request->table_id());
+  saved->set_schema_version(request->schema_version());
+  request->Swap(saved.get());
+  return true;
+}
+
+void PgReadRequestTemplates::Clear() {
+  templates_.clear();
+  num_templates_ = 0;
+}
+
+}  // namespace pggate
+}  // namespace yb
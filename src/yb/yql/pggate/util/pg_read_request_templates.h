@@ -0,0 +1,59 @@
+//--------------------------------------------------------------------------------------------------
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef YB_YQL_PGGATE_UTIL_PG_READ_REQUEST_TEMPLATES_H_
+#define YB_YQL_PGGATE_UTIL_PG_READ_REQUEST_TEMPLATES_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "yb/common/pgsql_protocol.pb.h"
+
+namespace yb {
+namespace pggate {
+
+// Read request protobufs of finished SELECT statements, keyed by the relation they read. The next
+// SELECT on that relation rebuilds its whole request in the memory of a saved one. Clearing a
+// protobuf keeps its sub-messages, strings and repeated elements allocated, so the targets, binds,
+// index request and column refs of a repeated statement are written without new allocations.
+class PgReadRequestTemplates {
+ public:
+  // Take over the memory of the request, unless max_templates are kept already or the request is
+  // unusually large.
+  void Save(const std::string& key, PgsqlReadRequestPB* request, int max_templates);
+
+  // Swap the memory of a saved request into the given newly created request. The client, table id
+  // and schema version of the new request are kept. Returns false if no request is saved for key.
+  bool Reuse(const std::string& key, PgsqlReadRequestPB* request);
+
+  void Clear();
+
+  int size() const {
+    return num_templates_;
+  }
+
+  // Requests larger than this, e.g. with long IN lists, are not kept.
+  static constexpr size_t kMaxTemplateSize = 64 * 1024;
+
+ private:
+  std::unordered_map<std::string, std::vector<std::unique_ptr<PgsqlReadRequestPB>>> templates_;
+  int num_templates_ = 0;
+};
+
+}  // namespace pggate
+}  // namespace yb
+
+#endif // YB_YQL_PGGATE_UTIL_PG_READ_REQUEST_TEMPLATES_H_
@@ -426,6 +426,18 @@ YBCStatus YBCPgDmlBindIndexColumn(YBCPgStatement handle, int attr_num, YBCPgExpr
   return ToYBCStatus(pgapi->DmlBindIndexColumn(handle, attr_num, attr_value));
 }
 
+YBCStatus YBCPgDmlBindYbctids(YBCPgStatement handle, int n_ybctids, YBCPgExpr *ybctids) {
+  return ToYBCStatus(pgapi->DmlBindYbctids(handle, n_ybctids, ybctids));
+}
+
+YBCStatus YBCPgDmlAppendQual(YBCPgStatement handle, YBCPgExpr qual) {
+  return ToYBCStatus(pgapi->DmlAppendQual(handle, qual));
+}
+
+YBCStatus YBCPgDmlAppendGroupBy(YBCPgStatement handle, YBCPgExpr group_by) {
+  return ToYBCStatus(pgapi->DmlAppendGroupBy(handle, group_by));
+}
+
 YBCStatus YBCPgDmlAssignColumn(YBCPgStatement handle,
                                int attr_num,
                                YBCPgExpr attr_value) {
@@ -445,6 +457,10 @@ YBCStatus YBCPgFlushBufferedWriteOperations() {
   return ToYBCStatus(pgapi->FlushBufferedWriteOperations());
 }
 
+YBCStatus YBCPgStartBulkLoadWriteOperations() {
+  return ToYBCStatus(pgapi->StartBulkLoadWriteOperations());
+}
+
 YBCStatus YBCPgDmlExecWriteOp(YBCPgStatement handle, int32_t *rows_affected_count) {
   return ToYBCStatus(pgapi->DmlExecWriteOp(handle, rows_affected_count));
 }
@@ -653,6 +669,10 @@ int32_t YBCGetOutputBufferSize() {
   return FLAGS_ysql_output_buffer_size;
 }
 
+int32_t YBCGetMaxBatchYbctids() {
+  return FLAGS_ysql_max_batch_ybctids;
+}
+
 bool YBCPgIsYugaByteEnabled() {
   return pgapi;
 }
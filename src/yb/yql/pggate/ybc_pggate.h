@@ -259,6 +259,22 @@ YBCStatus YBCPgDmlBindColumnCondIn(YBCPgStatement handle, int attr_num, int n_at
     YBCPgExpr *attr_values);
 YBCStatus YBCPgDmlBindIndexColumn(YBCPgStatement handle, int attr_num, YBCPgExpr attr_value);
 
+// Look up a batch of rows of the base table by their ybctids, which are bound as constants. The rows
+// are read with one request per tablet and fetched in the order of the ybctids. The ybctids of
+// rows that do not exist are skipped, and a ybctid that is bound more than once is read once.
+// At most YBCGetMaxBatchYbctids() ybctids can be bound.
+YBCStatus YBCPgDmlBindYbctids(YBCPgStatement handle, int n_ybctids, YBCPgExpr *ybctids);
+
+// Push down a qual of the WHERE clause of a SELECT. The qual is built with YBCPgNewOperator() using
+// the "=", "<>", "<", "<=", ">", ">=", "and", "or", "is_null", "is_not_null" and "in" operators.
+// DocDB drops the rows for which a qual is false or NULL before returning them.
+YBCStatus YBCPgDmlAppendQual(YBCPgStatement handle, YBCPgExpr qual);
+
+// Group the aggregate targets of a SELECT by a column. The aggregate values of each group are
+// returned after the table columns: a fetched tuple holds the group-by column values at their
+// attribute positions and the aggregate values in the last positions.
+YBCStatus YBCPgDmlAppendGroupBy(YBCPgStatement handle, YBCPgExpr group_by);
+
 // API for SET clause.
 YBCStatus YBCPgDmlAssignColumn(YBCPgStatement handle,
                                int attr_num,
@@ -291,6 +307,10 @@ YBCStatus YBCPgDmlBuildYBTupleId(YBCPgStatement handle, const YBCPgAttrValueDesc
 YBCStatus YBCPgStartBufferingWriteOperations();
 YBCStatus YBCPgFlushBufferedWriteOperations();
 
+// Buffer the write operations of a non-transactional bulk load (COPY FROM). They are flushed,
+// sorted by partition key, by YBCPgFlushBufferedWriteOperations().
+YBCStatus YBCPgStartBulkLoadWriteOperations();
+
 // INSERT ------------------------------------------------------------------------------------------
 YBCStatus YBCPgNewInsert(YBCPgOid database_oid,
                          YBCPgOid table_oid,
@@ -377,6 +397,9 @@ int32_t YBCGetMaxReadRestartAttempts();
 // Retrieves value of ysql_output_buffer_size gflag
 int32_t YBCGetOutputBufferSize();
 
+// Retrieves value of ysql_max_batch_ybctids gflag
+int32_t YBCGetMaxBatchYbctids();
+
 bool YBCPgIsYugaByteEnabled();
 
 #ifdef __cplusplus
@@ -20,6 +20,11 @@
 #include "yb/master/sys_catalog_constants.h"
 #include "yb/master/sys_catalog_initialization.h"
 
+#include "yb/rocksdb/statistics.h"
+
+#include "yb/tablet/tablet.h"
+#include "yb/tablet/tablet_peer.h"
+
 #include "yb/tserver/mini_tablet_server.h"
 #include "yb/tserver/tablet_server.h"
 
@@ -47,6 +52,7 @@ DECLARE_int64(retryable_rpc_single_call_timeout_ms);
 DECLARE_uint64(max_clock_skew_usec);
 DECLARE_int64(db_write_buffer_size);
 DECLARE_bool(ysql_enable_manual_sys_table_txn_ctl);
+DECLARE_bool(rocksdb_disable_compactions);
 
 namespace yb {
 namespace pgwrapper {
@@ -86,6 +92,8 @@ class PgMiniTest : public YBMiniClusterTestBase<MiniCluster> {
         pg_ts->options()->fs_opts.data_paths.front() + "/pg_data",
         pg_ts->server()->GetSharedMemoryFd()));
     pg_process_conf.master_addresses = pg_ts->options()->master_addresses_flag;
+    pg_process_conf.ysql_catalog_cache_shm_fd =
+        pg_ts->server()->GetYsqlCatalogCacheSharedMemoryFd();
     pg_process_conf.force_disable_log_file = true;
 
     LOG(INFO) << "Starting PostgreSQL server listening on "
@@ -604,6 +612,26 @@ TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_SANITIZERS(SelectModifySelect)) {
   }
 }
 
+TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_SANITIZERS(FloatNaNConditions)) {
+  auto conn = ASSERT_RESULT(Connect());
+
+  ASSERT_OK(conn.Execute("CREATE TABLE t (key INT PRIMARY KEY, f4 REAL, f8 DOUBLE PRECISION)"));
+  ASSERT_OK(conn.Execute(
+      "INSERT INTO t VALUES (1, 1, 1), (2, 'NaN', 'NaN'), (3, '-Infinity', '-Infinity')"));
+
+  // Postgres orders NaN above all other values and finds it equal to itself only.
+  for (const auto& column : {"f4", "f8"}) {
+    for (const auto& condition_and_count : std::vector<std::pair<std::string, int64_t>>{
+             {"> 0", 2}, {">= 1", 2}, {"< 'NaN'", 2}, {"<= 'NaN'", 3}, {"<> 1", 2},
+             {"= 'NaN'", 1}, {"= 1", 1}, {"IN (1, 'NaN')", 2}}) {
+      const auto query = Format(
+          "SELECT COUNT(*) FROM t WHERE $0 $1", column, condition_and_count.first);
+      ASSERT_EQ(condition_and_count.second, ASSERT_RESULT(conn.FetchValue<int64_t>(query)))
+          << query;
+    }
+  }
+}
+
 class PgMiniSmallWriteBufferTest : public PgMiniTest {
  public:
   void SetUp() override {
@@ -675,6 +703,83 @@ TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(BulkCopyWithRestart), PgMiniSmallW
   }, 5s, "Intents cleanup", 200ms));
 }
 
+class PgMiniNoCompactionsTest : public PgMiniTest {
+ public:
+  void SetUp() override {
+    // Keep every flushed file, so that reads have several files to skip.
+    FLAGS_rocksdb_disable_compactions = true;
+    PgMiniTest::SetUp();
+  }
+};
+
+// Point reads of a range sharded table should skip the files whose bloom filter does not contain
+// the leading range component of the key, and still find the rows of the files that contain it.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(RangeShardedBloomFilter), PgMiniNoCompactionsTest) {
+  const std::string kTableName = "range_sharded";
+  constexpr int kNumFiles = 4;
+  constexpr int kKeysPerFile = 10;
+  // Rows with this leading component are written to every file.
+  constexpr int kSharedKey = 1000;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.ExecuteFormat(
+      "CREATE TABLE $0 (r1 INT, r2 INT, v TEXT, PRIMARY KEY (r1 ASC, r2 ASC))", kTableName));
+
+  // Every file gets its own leading components and the shared one, so the key range of every file
+  // contains the leading components between them.
+  for (int file = 0; file != kNumFiles; ++file) {
+    for (int i = 0; i != kKeysPerFile; ++i) {
+      ASSERT_OK(conn.ExecuteFormat(
+          "INSERT INTO $0 VALUES ($1, $2, 'value_$1_$2')",
+          kTableName, file * kKeysPerFile + i, file));
+    }
+    ASSERT_OK(conn.ExecuteFormat(
+        "INSERT INTO $0 VALUES ($1, $2, 'value_$1_$2')", kTableName, kSharedKey, file));
+    ASSERT_OK(cluster_->FlushTablets());
+  }
+
+  auto peers = ListTabletPeers(cluster_.get(), [&kTableName](const auto& peer) {
+    return peer->tablet()->metadata()->table_name() == kTableName;
+  });
+  ASSERT_FALSE(peers.empty());
+  auto bloom_filter_useful = [&peers] {
+    uint64_t result = 0;
+    for (const auto& peer : peers) {
+      result += peer->tablet()->rocksdb_statistics()->getTickerCount(
+          rocksdb::BLOOM_FILTER_USEFUL);
+    }
+    return result;
+  };
+
+  // Missing leading components within the key range of every file, so that only the filter could
+  // skip the files.
+  for (int r1 : {kNumFiles * kKeysPerFile, kSharedKey / 2, kSharedKey - 1}) {
+    const auto useful_before = bloom_filter_useful();
+    ASSERT_RESULT(conn.FetchMatrix(
+        Format("SELECT v FROM $0 WHERE r1 = $1", kTableName, r1), 0, 1));
+    ASSERT_RESULT(conn.FetchMatrix(
+        Format("SELECT v FROM $0 WHERE r1 = $1 AND r2 = 0", kTableName, r1), 0, 1));
+    ASSERT_GE(bloom_filter_useful() - useful_before, 2U * kNumFiles) << "r1: " << r1;
+  }
+
+  for (int file = 0; file != kNumFiles; ++file) {
+    const int r1 = file * kKeysPerFile + kKeysPerFile / 2;
+    auto value = ASSERT_RESULT(conn.FetchValue<std::string>(Format(
+        "SELECT v FROM $0 WHERE r1 = $1 AND r2 = $2", kTableName, r1, file)));
+    ASSERT_EQ(Format("value_$0_$1", r1, file), value);
+  }
+
+  // The rows of the shared leading component are found in every file.
+  auto result = ASSERT_RESULT(conn.FetchMatrix(
+      Format("SELECT r2, v FROM $0 WHERE r1 = $1 ORDER BY r2", kTableName, kSharedKey),
+      kNumFiles, 2));
+  for (int file = 0; file != kNumFiles; ++file) {
+    ASSERT_EQ(file, ASSERT_RESULT(GetInt32(result.get(), file, 0)));
+    ASSERT_EQ(Format("value_$0_$1", kSharedKey, file),
+              ASSERT_RESULT(GetString(result.get(), file, 1)));
+  }
+}
+
 void PgMiniTest::TestForeignKey(IsolationLevel isolation_level) {
   const std::string kDataTable = "data";
   const std::string kReferenceTable = "reference";
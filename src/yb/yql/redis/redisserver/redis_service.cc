@@ -611,7 +611,7 @@ class TabletOperations {
     if (!data.block) {
       ArenaAllocator<Block> alloc(arena);
       data.block = std::allocate_shared<Block>(
-          alloc, context, alloc, metrics_internal[static_cast<size_t>(OperationType::kRead)]);
+          alloc, context, alloc, metrics_internal[static_cast<size_t>(type)]);
       if (last_conflict_type_ == OperationType::kLocal) {
         last_local_block_->SetNext(data.block);
         last_conflict_type_ = type;
@@ -825,6 +825,7 @@ class BatchContextImpl : public BatchContext {
         call_(call),
         consumption_(impl_data->server_->mem_tracker(), 0),
         operations_(&arena_),
+        lookups_(&arena_),
         tablets_(&arena_) {
   }
 
@@ -876,15 +877,40 @@ class BatchContextImpl : public BatchContext {
       for (auto& operation : operations_) {
         operation.Respond(table.status());
       }
+      return;
+    }
+
+    // Pipelined commands often address the same key, so the tablet is looked up once per distinct
+    // partition key rather than once per command. Lookups are only appended to, because a lookup
+    // that completes synchronously could start a retry while the loop below is still running.
+    const size_t first_lookup = lookups_.size();
+    {
+      std::unordered_map<Slice, size_t, Slice::Hash> lookup_indexes;
+      for (auto& operation : operations_) {
+        if (operation.responded()) {
+          continue;
+        }
+        auto it = lookup_indexes.emplace(operation.partition_key(), lookups_.size()).first;
+        if (it->second == lookups_.size()) {
+          lookups_.emplace_back(&arena_);
+        }
+        lookups_[it->second].push_back(&operation);
+      }
     }
+    const size_t end_lookup = lookups_.size();
+    if (first_lookup == end_lookup) {
+      return;
+    }
+
     auto deadline = CoarseMonoClock::Now() + FLAGS_redis_service_yb_client_timeout_millis * 1ms;
-    lookups_left_.store(operations_.size(), std::memory_order_release);
+    lookups_left_.store(end_lookup - first_lookup, std::memory_order_release);
     retry_lookups_.store(false, std::memory_order_release);
-    for (auto& operation : operations_) {
+    for (size_t i = first_lookup; i != end_lookup; ++i) {
+      auto* operations = &lookups_[i];
       impl_data_->client_->LookupTabletByKey(
-          table->get(), operation.partition_key(), deadline,
+          table->get(), operations->front()->partition_key(), deadline,
           std::bind(
-              &BatchContextImpl::LookupDone, scoped_refptr<BatchContextImpl>(this), &operation,
+              &BatchContextImpl::LookupDone, scoped_refptr<BatchContextImpl>(this), operations,
               retries, _1));
     }
   }
@@ -928,17 +954,22 @@ class BatchContextImpl : public BatchContext {
   }
 
   void LookupDone(
-      Operation* operation, int retries, const Result<client::internal::RemoteTabletPtr>& result) {
+      MCVector<Operation*>* operations, int retries,
+      const Result<client::internal::RemoteTabletPtr>& result) {
     const int kMaxRetries = 2;
     if (!result.ok()) {
       auto status = result.status();
       if (status.IsNotFound() && retries < kMaxRetries) {
-        retry_lookups_.store(false, std::memory_order_release);
+        retry_lookups_.store(true, std::memory_order_release);
       } else {
-        operation->Respond(status);
+        for (auto* operation : *operations) {
+          operation->Respond(status);
+        }
       }
     } else {
-      operation->SetTablet(*result);
+      for (auto* operation : *operations) {
+        operation->SetTablet(*result);
+      }
     }
     if (lookups_left_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
       return;
@@ -976,6 +1007,8 @@ class BatchContextImpl : public BatchContext {
 
   Arena arena_;
   MCDeque<Operation> operations_;
+  // Operations grouped by partition key, each group sharing one tablet lookup.
+  MCDeque<MCVector<Operation*>> lookups_;
   std::atomic<bool> retry_lookups_;
   std::atomic<size_t> lookups_left_;
   MCUnorderedMap<Slice, TabletOperations, Slice::Hash> tablets_;
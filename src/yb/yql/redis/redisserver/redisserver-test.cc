@@ -51,6 +51,8 @@ DECLARE_uint64(redis_max_queued_bytes);
 DECLARE_int64(redis_rpc_block_size);
 DECLARE_bool(redis_safe_batch);
 DECLARE_bool(emulate_redis_responses);
+DECLARE_bool(redis_maintain_collection_cardinality);
+DECLARE_int32(redis_timeseries_chunk_max_points);
 DECLARE_bool(test_tserver_timeout);
 DECLARE_bool(enable_backpressure_mode_for_testing);
 DECLARE_bool(yedis_enable_flush);
@@ -1337,6 +1339,19 @@ TEST_F_EX(TestRedisService, SafeBatchPipeline, TestRedisServiceSafeBatch) {
   LOG(INFO) << yb::Format("Safe set: $0ms, get: $1ms", set_time.count(), get_time.count());
 }
 
+TEST_F_EX(TestRedisService, SafeBatchSameKey, TestRedisServiceSafeBatch) {
+  // All commands share one tablet lookup, but still have to be applied in the order sent.
+  constexpr size_t kSets = 100;
+  std::string command;
+  std::string response;
+  for (size_t i = 0; i != kSets; ++i) {
+    const std::string value = std::to_string(ValueForKey(i));
+    command += yb::Format("set key $0\r\nget key\r\n", value);
+    response += yb::Format("+OK\r\n$$$0\r\n$1\r\n", value.length(), value);
+  }
+  SendCommandAndExpectResponse(__LINE__, command, response);
+}
+
 TEST_F(TestRedisService, BatchedCommandMulti) {
   SendCommandAndExpectResponse(
       __LINE__,
@@ -3666,6 +3681,91 @@ TEST_F(TestRedisService, TestZRange) {
   VerifyCallbacks();
 }
 
+TEST_F(TestRedisService, TestCollectionCardinality) {
+  DoRedisTestOk(__LINE__, {"HMSET", "h_card", "f1", "v1", "f2", "v2"});
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"HSET", "h_card", "f3", "v3"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"HSET", "h_card", "f1", "v4"}, 0);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"HINCRBY", "h_card", "f4", "1"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"HLEN", "h_card"}, 4);
+  DoRedisTestInt(__LINE__, {"HDEL", "h_card", "f1", "fne"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"HLEN", "h_card"}, 3);
+  DoRedisTestArray(__LINE__, {"HGETALL", "h_card"}, {"f2", "v2", "f3", "v3", "f4", "1"});
+
+  DoRedisTestInt(__LINE__, {"SADD", "s_card", "a", "b", "c"}, 3);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"SADD", "s_card", "c", "d"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"SREM", "s_card", "a", "z"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"SCARD", "s_card"}, 3);
+  DoRedisTestArray(__LINE__, {"SMEMBERS", "s_card"}, {"b", "c", "d"});
+
+  // Writes made while the cardinality is not maintained invalidate it, and it is counted again.
+  FLAGS_redis_maintain_collection_cardinality = false;
+  DoRedisTestInt(__LINE__, {"SADD", "s_card", "e"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"HDEL", "h_card", "f2"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"SCARD", "s_card"}, 4);
+  DoRedisTestInt(__LINE__, {"HLEN", "h_card"}, 2);
+  FLAGS_redis_maintain_collection_cardinality = true;
+  DoRedisTestInt(__LINE__, {"SADD", "s_card", "f"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"HSET", "h_card", "f5", "v5"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"SCARD", "s_card"}, 5);
+  DoRedisTestInt(__LINE__, {"HLEN", "h_card"}, 3);
+
+  SyncClient();
+  VerifyCallbacks();
+}
+
+TEST_F(TestRedisService, TestZRangeAcrossScoreBlocks) {
+  // Scores far apart fall in different blocks of the rank index, so that the ranges below start
+  // from the middle of the set.
+  DoRedisTestInt(__LINE__, {"ZADD", "z_blocks", "-1e9", "v0", "-1", "v1", "0", "v2", "0.5", "v3",
+      "1", "v4", "2", "v5", "1e9", "v6"}, 7);
+  SyncClient();
+
+  DoRedisTestArray(__LINE__, {"ZRANGE", "z_blocks", "3", "4"}, {"v3", "v4"});
+  DoRedisTestArray(__LINE__, {"ZRANGE", "z_blocks", "5", "-1"}, {"v5", "v6"});
+  DoRedisTestArray(__LINE__, {"ZRANGE", "z_blocks", "6", "100"}, {"v6"});
+  DoRedisTestArray(__LINE__, {"ZREVRANGE", "z_blocks", "0", "2"}, {"v6", "v5", "v4"});
+  DoRedisTestArray(__LINE__, {"ZREVRANGE", "z_blocks", "4", "5"}, {"v2", "v1"});
+  SyncClient();
+
+  // Remove members and move others to other blocks.
+  DoRedisTestInt(__LINE__, {"ZREM", "z_blocks", "v1", "v3"}, 2);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"ZADD", "z_blocks", "-2e9", "v6", "3", "v2"}, 0);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"ZADD", "z_blocks", "INCR", "2", "v4"}, 0);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"ZCARD", "z_blocks"}, 5);
+  DoRedisTestScoreValueArray(__LINE__, {"ZRANGE", "z_blocks", "0", "-1", "WITHSCORES"},
+                             {-2e9, -1e9, 2, 3, 3}, {"v6", "v0", "v5", "v2", "v4"});
+  DoRedisTestArray(__LINE__, {"ZRANGE", "z_blocks", "2", "3"}, {"v5", "v2"});
+  DoRedisTestArray(__LINE__, {"ZRANGE", "z_blocks", "4", "4"}, {"v4"});
+  DoRedisTestArray(__LINE__, {"ZREVRANGE", "z_blocks", "3", "4"}, {"v0", "v6"});
+  SyncClient();
+
+  // A set added again after being deleted does not count the members of the deleted one.
+  DoRedisTestInt(__LINE__, {"DEL", "z_blocks"}, 1);
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"ZADD", "z_blocks", "1", "w0", "1e9", "w1"}, 2);
+  SyncClient();
+  DoRedisTestArray(__LINE__, {"ZRANGE", "z_blocks", "1", "1"}, {"w1"});
+  DoRedisTestArray(__LINE__, {"ZREVRANGE", "z_blocks", "1", "1"}, {"w0"});
+
+  SyncClient();
+  VerifyCallbacks();
+}
+
 TEST_F(TestRedisService, TestZScore) {
   // The default value is true, but we explicitly set this here for clarity.
   FLAGS_emulate_redis_responses = true;
@@ -4284,6 +4384,52 @@ TEST_F(TestRedisService, TestTsRem) {
   VerifyCallbacks();
 }
 
+TEST_F(TestRedisService, TestTsChunks) {
+  FLAGS_redis_timeseries_chunk_max_points = 4;
+  DoRedisTestOk(__LINE__, {"TSADD", "ts_chunks",
+      "10", "v1", "20", "v2", "30", "v3", "40", "v4", "50", "v5",
+      "60", "v6", "70", "v7", "80", "v8", "90", "v9", "100", "v10"});
+  SyncClient();
+  // Splits the chunk of the first points.
+  DoRedisTestOk(__LINE__, {"TSADD", "ts_chunks", "25", "v25"});
+  SyncClient();
+  // Points with an expiration and points written while new chunks are disabled are stored
+  // individually, and replace the ones in chunks.
+  DoRedisTestOk(__LINE__, {"TSADD", "ts_chunks", "110", "v11", "EXPIRE_IN", "3600"});
+  SyncClient();
+  FLAGS_redis_timeseries_chunk_max_points = -1;
+  DoRedisTestOk(__LINE__, {"TSADD", "ts_chunks", "60", "v60"});
+  SyncClient();
+
+  DoRedisTestInt(__LINE__, {"TSCARD", "ts_chunks"}, 12);
+  DoRedisTestBulkString(__LINE__, {"TSGET", "ts_chunks", "25"}, "v25");
+  DoRedisTestBulkString(__LINE__, {"TSGET", "ts_chunks", "60"}, "v60");
+  DoRedisTestBulkString(__LINE__, {"TSGET", "ts_chunks", "110"}, "v11");
+  DoRedisTestNull(__LINE__, {"TSGET", "ts_chunks", "35"});
+  DoRedisTestArray(__LINE__, {"TSRANGEBYTIME", "ts_chunks", "20", "60"},
+      {"20", "v2", "25", "v25", "30", "v3", "40", "v4", "50", "v5", "60", "v60"});
+  DoRedisTestArray(__LINE__, {"TSREVRANGEBYTIME", "ts_chunks", "(20", "(60"},
+      {"50", "v5", "40", "v4", "30", "v3", "25", "v25"});
+  DoRedisTestArray(__LINE__, {"TSRANGEBYTIME", "ts_chunks", "-inf", "+inf"},
+      {"10", "v1", "20", "v2", "25", "v25", "30", "v3", "40", "v4", "50", "v5", "60", "v60",
+          "70", "v7", "80", "v8", "90", "v9", "100", "v10", "110", "v11"});
+  DoRedisTestArray(__LINE__, {"TSLASTN", "ts_chunks", "3"},
+      {"90", "v9", "100", "v10", "110", "v11"});
+  SyncClient();
+
+  DoRedisTestOk(__LINE__, {"TSREM", "ts_chunks", "25", "30", "60", "110"});
+  SyncClient();
+  DoRedisTestInt(__LINE__, {"TSCARD", "ts_chunks"}, 8);
+  DoRedisTestNull(__LINE__, {"TSGET", "ts_chunks", "30"});
+  DoRedisTestArray(__LINE__, {"TSLASTN", "ts_chunks", "3"},
+      {"80", "v8", "90", "v9", "100", "v10"});
+  DoRedisTestArray(__LINE__, {"TSRANGEBYTIME", "ts_chunks", "-inf", "60"},
+      {"10", "v1", "20", "v2", "40", "v4", "50", "v5"});
+
+  SyncClient();
+  VerifyCallbacks();
+}
+
 TEST_F(TestRedisService, TestOverwrites) {
   // The default value is true, but we explicitly set this here for clarity.
   FLAGS_emulate_redis_responses = true;